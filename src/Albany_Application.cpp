@@ -4,6 +4,7 @@
 
 #include "Albany_Application.hpp"
 
+#include <algorithm>
 #include <string>
 
 #include "AAdapt_Erosion.hpp"
@@ -13,16 +14,19 @@
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_DummyParameterAccessor.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
 #include "Albany_ScalarResponseFunction.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "PHAL_SDirichlet.hpp"
 #include "PHAL_Utilities.hpp"
 #include "SolutionSniffer.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 #include "Thyra_MultiVectorStdOps.hpp"
 #include "Thyra_VectorBase.hpp"
 #include "Thyra_VectorStdOps.hpp"
+#include "utility/PerformanceContext.hpp"
 
 using Teuchos::ArrayRCP;
 using Teuchos::getFancyOStream;
@@ -58,6 +62,31 @@ calcTangentDerivDimension(const Teuchos::RCP<Teuchos::ParameterList>& problemPar
   }
   return std::max(1, np);
 }
+
+// Local part of an exact comparison of two (possibly null) vectors.
+bool
+sameLocalData(Teuchos::RCP<Thyra_Vector const> const& a, Teuchos::RCP<Thyra_Vector const> const& b)
+{
+  if (a.is_null() || b.is_null()) return a.is_null() && b.is_null();
+  auto const a_data = Albany::getLocalData(a);
+  auto const b_data = Albany::getLocalData(b);
+  if (a_data.size() != b_data.size()) return false;
+  return std::equal(a_data.begin(), a_data.end(), b_data.begin());
+}
+
+// Copy v into cache, allocating cache on first use or if the space changed.
+void
+copyForReuse(Teuchos::RCP<Thyra_Vector const> const& v, Teuchos::RCP<Thyra_Vector>& cache)
+{
+  if (v.is_null()) {
+    cache = Teuchos::null;
+    return;
+  }
+  if (cache.is_null() || cache->space()->dim() != v->space()->dim()) {
+    cache = Thyra::createMember(v->space());
+  }
+  cache->assign(*v);
+}
 }  // namespace
 
 namespace Albany {
@@ -365,6 +394,8 @@ Application::initialSetUp(const RCP<Teuchos::ParameterList>& params)
 void
 Application::createMeshSpecs()
 {
+  MemoryScope memory(MemoryTag::Discretization);
+
   // Get mesh specification object: worksetSize, cell topology, etc
   meshSpecs = discFactory->createMeshSpecs();
 }
@@ -372,6 +403,8 @@ Application::createMeshSpecs()
 void
 Application::createMeshSpecs(Teuchos::RCP<AbstractMeshStruct> mesh)
 {
+  MemoryScope memory(MemoryTag::Discretization);
+
   // Get mesh specification object: worksetSize, cell topology, etc
   meshSpecs = discFactory->createMeshSpecs(mesh);
 }
@@ -424,28 +457,67 @@ Application::buildProblem()
   const Teuchos::Array<unsigned int> defaultDataUnsignedInt;
   relative_responses = responseList.get("Relative Responses Markers", defaultDataUnsignedInt);
 
+  // With state capture, the residual field managers save the states they
+  // have an evaluator for, at every residual fill, so that the last fill of
+  // a converged solve leaves the states of the converged solution. The
+  // state field managers then only evaluate the other states, and are null
+  // if there are none. The reference configuration manager needs its pass.
+  auto const resid_fm = problem->getFieldManager();
+  capture_states_     = problemParams->get("Capture States From Residual", false);
+  if (capture_states_ == true && (Teuchos::nonnull(rc_mgr) || resid_fm == Teuchos::null)) {
+    *out << "Albany::Application: 'Capture States From Residual' is not supported with the reference configuration manager "
+         << "or by this problem; disabling it.\n";
+    capture_states_ = false;
+  }
+
+  // True if fm has a residual evaluator for the field of tag
+  auto is_evaluated = [](PHX::FieldManager<PHAL::AlbanyTraits>& fm, PHX::FieldTag const& tag) {
+    for (auto const& node : fm.getDagManager<PHAL::AlbanyTraits::Residual>().getDagNodes()) {
+      for (auto const& field : node.get()->evaluatedFields()) {
+        if (field->identifier() == tag.identifier()) return true;
+      }
+    }
+    return false;
+  };
+
   // Build state field manager
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->beginBuildingSfm();
   sfm.resize(meshSpecs.size());
-  Teuchos::RCP<PHX::DataLayout> dummy = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  Teuchos::RCP<PHX::DataLayout> dummy        = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  int                           num_captured = 0;
   for (int ps = 0; ps < meshSpecs.size(); ps++) {
     std::string              elementBlockName              = meshSpecs[ps]->ebName;
     std::vector<std::string> responseIDs_to_require        = stateMgr.getResidResponseIDsToRequire(elementBlockName);
     sfm[ps]                                                = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
     Teuchos::Array<Teuchos::RCP<const PHX::FieldTag>> tags = problem->buildEvaluators(*sfm[ps], *meshSpecs[ps], stateMgr, BUILD_STATE_FM, Teuchos::null);
     std::vector<std::string>::const_iterator          it;
+
+    // Number of states left to the state field manager
+    int num_required = 0;
     for (it = responseIDs_to_require.begin(); it != responseIDs_to_require.end(); it++) {
       std::string const&                              responseID = *it;
       PHX::Tag<PHAL::AlbanyTraits::Residual::ScalarT> res_response_tag(responseID, dummy);
+      if (capture_states_ == true && is_evaluated(*resid_fm[ps], res_response_tag)) {
+        resid_fm[ps]->requireField<PHAL::AlbanyTraits::Residual>(res_response_tag);
+        ++num_captured;
+        continue;
+      }
       sfm[ps]->requireField<PHAL::AlbanyTraits::Residual>(res_response_tag);
+      ++num_required;
     }
+    if (capture_states_ == true && num_required == 0) sfm[ps] = Teuchos::null;
   }
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->endBuildingSfm();
+  if (capture_states_ == true) {
+    *out << "Albany::Application: " << num_captured << " states are captured from the residual fill.\n";
+  }
 }
 
 void
 Application::createDiscretization()
 {
+  MemoryScope memory(MemoryTag::Discretization);
+
   // Create the full mesh
   disc = discFactory->createDiscretization(
       neq,
@@ -598,6 +670,30 @@ Application::finalSetUp(const Teuchos::RCP<Teuchos::ParameterList>& params, Teuc
 
   perturbBetaForDirichlets = problemParams->get("Perturb Dirichlet", 0.0);
 
+  // The residual of a Jacobian fill matches that of a residual fill only
+  // when neither SDBCs nor scaling modify the two differently, and when no
+  // other application contributes to it (Schwarz). A Jacobian fill does not
+  // save the states, which state capture needs from the last residual fill,
+  // and does not initialize the reference configuration manager.
+  reuse_residual_ = problemParams->get("Reuse Residual From Jacobian Fill", false);
+  if (reuse_residual_ == true) {
+    bool const is_coupled = is_schwarz_ || apps_.size() > 0;
+    if (problem->useSDBCs() == true || scale != 1.0 || ignore_residual_in_jacobian == true || is_coupled == true || capture_states_ == true ||
+        Teuchos::nonnull(rc_mgr) == true) {
+      *out << "Albany::Application: 'Reuse Residual From Jacobian Fill' is not supported with SDBCs, scaling, "
+           << "'Ignore Residual In Jacobian', Schwarz coupling, 'Capture States From Residual' or a reference configuration "
+           << "manager; disabling it.\n";
+      reuse_residual_ = false;
+    }
+  }
+
+  bind_states_ = problemParams->get("Bind States In Place", false);
+
+  if (problemParams->get("Evaluator Timings", false) == true) {
+    std::string const traceFile = problemParams->get("Evaluator Timings Trace File", "evaluator_timings.json");
+    evaluatorTimings            = Teuchos::rcp(new PHAL::EvaluatorTimings(comm, traceFile));
+  }
+
   is_adjoint = problemParams->get("Solve Adjoint", false);
 
   // For backward compatibility, use any value at the old location of the
@@ -912,6 +1008,8 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
   std::string evalName = PHAL::evalName<EvalT>("FM", 0);
   if (phxSetup->contain_eval(evalName)) return;
 
+  MemoryScope memory(MemoryTag::PhalanxFields);
+
   for (int ps = 0; ps < fm.size(); ps++) {
     evalName = PHAL::evalName<EvalT>("FM", ps);
     phxSetup->insert_eval(evalName);
@@ -923,6 +1021,12 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
     phxSetup->update_fields();
 
     writePhalanxGraph<EvalT>(fm[ps], evalName, phxGraphVisDetail);
+    if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*fm[ps], meshSpecs[ps]->ebName);
+
+    if (bind_states_ == true) {
+      resid_binders_.resize(fm.size());
+      resid_binders_[ps] = Teuchos::rcp(new PHAL::StateFieldBinder(*fm[ps]));
+    }
   }
   if (dfm != Teuchos::null) {
     evalName = PHAL::evalName<EvalT>("DFM", 0);
@@ -935,6 +1039,7 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
     phxSetup->update_fields();
 
     writePhalanxGraph<EvalT>(dfm, evalName, phxGraphVisDetail);
+    if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*dfm, "Dirichlet");
   }
   if (nfm != Teuchos::null)
     for (int ps = 0; ps < nfm.size(); ps++) {
@@ -948,6 +1053,7 @@ Application::postRegSetup<PHAL::AlbanyTraits::Residual>()
       phxSetup->update_fields();
 
       writePhalanxGraph<EvalT>(nfm[ps], evalName, phxGraphVisDetail);
+      if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*nfm[ps], meshSpecs[ps]->ebName + " Neumann");
     }
 }
 
@@ -965,6 +1071,8 @@ Application::postRegSetupDImpl()
   std::string evalName = PHAL::evalName<EvalT>("FM", 0);
   if (phxSetup->contain_eval(evalName)) return;
 
+  MemoryScope memory(MemoryTag::PhalanxFields);
+
   for (int ps = 0; ps < fm.size(); ps++) {
     evalName = PHAL::evalName<EvalT>("FM", ps);
     phxSetup->insert_eval(evalName);
@@ -979,6 +1087,7 @@ Application::postRegSetupDImpl()
     phxSetup->update_fields();
 
     writePhalanxGraph<EvalT>(fm[ps], evalName, phxGraphVisDetail);
+    if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*fm[ps], meshSpecs[ps]->ebName);
 
     if (nfm != Teuchos::null && ps < nfm.size()) {
       evalName = PHAL::evalName<EvalT>("NFM", ps);
@@ -992,6 +1101,7 @@ Application::postRegSetupDImpl()
       phxSetup->update_fields();
 
       writePhalanxGraph<EvalT>(nfm[ps], evalName, phxGraphVisDetail);
+      if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*nfm[ps], meshSpecs[ps]->ebName + " Neumann");
     }
   }
   if (dfm != Teuchos::null) {
@@ -1010,6 +1120,7 @@ Application::postRegSetupDImpl()
     phxSetup->update_fields();
 
     writePhalanxGraph<EvalT>(dfm, evalName, phxGraphVisDetail);
+    if (evaluatorTimings != Teuchos::null) evaluatorTimings->addFieldManager<EvalT>(*dfm, "Dirichlet");
   }
 }
 
@@ -1113,18 +1224,28 @@ Application::computeGlobalResidualImpl(
 
     workset.num_worksets = numWorksets;
 
+    bool const tune = workset_size_tuner_ != Teuchos::null && active_worksets_.empty() == true;
+
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (active_worksets_.empty() == false && active_worksets_[ws] == false) continue;
+
       std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
+      if (bind_states_ == true) resid_binders_[wsPhysIndex[ws]]->bind(*workset.stateArrayPtr);
+
       // FillType template argument used to specialize Sacado
+      if (tune == true) workset_size_tuner_->startWorkset();
       fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+      if (tune == true) workset_size_tuner_->stopWorkset(wsPhysIndex[ws], wsElNodeEqID[ws].extent(0), false);
 
       if (nfm != Teuchos::null) {
         workset.workset_num = ws;
         deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
       }
     }
+
+    if (tune == true && workset_size_tuner_->endFill(false) == true) workset_size_tuner_ = Teuchos::null;
   }
 
   // Assemble the residual into a non-overlapping vector
@@ -1183,7 +1304,26 @@ Application::computeGlobalResidual(
     Teuchos::RCP<Thyra_Vector> const&       f,
     double const                            dt)
 {
-  this->computeGlobalResidualImpl(current_time, x, x_dot, x_dotdot, p, f, dt);
+  if (reuse_residual_ == true) {
+    auto& counters = util::PerformanceContext::instance().counterMonitor();
+    if (canReuseResidual(current_time, x, x_dot, x_dotdot, p, dt) == true) {
+      f->assign(*reuse_residual_f_);
+      // The residual field written to the output, before the Dirichlet
+      // conditions as in a residual fill
+      auto const overlapped_f = solMgr->get_overlapped_f();
+      solMgr->get_cas_manager()->scatter(reuse_residual_field_, overlapped_f, CombineMode::INSERT);
+      disc->setResidualField(*overlapped_f);
+      x_       = x;
+      xdot_    = x_dot;
+      xdotdot_ = x_dotdot;
+      counters["Albany Residual Reuse: Hits"]->increment();
+    } else {
+      this->computeGlobalResidualImpl(current_time, x, x_dot, x_dotdot, p, f, dt);
+      counters["Albany Residual Reuse: Misses"]->increment();
+    }
+  } else {
+    this->computeGlobalResidualImpl(current_time, x, x_dot, x_dotdot, p, f, dt);
+  }
 
   // Debut output write residual or solution to MatrixMarket
   // every time it arises or at requested count#
@@ -1273,7 +1413,8 @@ Application::computeGlobalJacobianImpl(
     f->assign(0.0);
   }
 
-  // Zero out Jacobian
+  // Zero out Jacobian. The overlapped Jacobian is fill completed at the end
+  // of every fill, so it is fill active only during the element fill.
   resumeFill(jac);
   assign(jac, 0.0);
 
@@ -1281,12 +1422,6 @@ Application::computeGlobalJacobianImpl(
     resumeFill(overlapped_jac);
   }
   assign(overlapped_jac, 0.0);
-  if (isFillActive(overlapped_jac)) {
-    fillComplete(overlapped_jac);
-  }
-  if (!isFillActive(overlapped_jac)) {
-    resumeFill(overlapped_jac);
-  }
 
   // Set data in Workset struct, and perform fill via field manager
   {
@@ -1315,15 +1450,20 @@ Application::computeGlobalJacobianImpl(
       workset.Jac_kokkos = getNonconstDeviceData(workset.Jac);
     }
     workset.num_worksets = numWorksets;
+    bool const tune = workset_size_tuner_ != Teuchos::null && active_worksets_.empty() == true;
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (active_worksets_.empty() == false && active_worksets_[ws] == false) continue;
       std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
       // FillType template argument used to specialize Sacado
+      if (tune == true) workset_size_tuner_->startWorkset();
       fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+      if (tune == true) workset_size_tuner_->stopWorkset(wsPhysIndex[ws], wsElNodeEqID[ws].extent(0), true);
       workset.workset_num = ws;
       if (Teuchos::nonnull(nfm)) deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
     }
+    if (tune == true && workset_size_tuner_->endFill(true) == true) workset_size_tuner_ = Teuchos::null;
   }
 
   // Allocate and populate scaleVec_
@@ -1340,8 +1480,9 @@ Application::computeGlobalJacobianImpl(
     // Assemble global residual
     if (Teuchos::nonnull(f)) {
       cas_manager->combine(overlapped_f, f, CombineMode::ADD);
+      if (reuse_residual_ == true) copyForReuse(f, reuse_residual_field_);
     }
-    // Assemble global Jacobian
+    // Assemble global Jacobian, communicating only the shared rows
     cas_manager->combine(overlapped_jac, jac, CombineMode::ADD);
   }
 
@@ -1394,6 +1535,9 @@ Application::computeGlobalJacobianImpl(
 
     // FillType template argument used to specialize Sacado
     dfm->evaluateFields<EvalT>(workset);
+
+    // Strong Dirichlet conditions, all at once
+    PHAL::applySDBCs(workset);
   }
   fillComplete(jac);
 
@@ -1412,11 +1556,76 @@ Application::computeGlobalJacobianImpl(
     // Makes getLocalMatrix() valid.
     fillComplete(overlapped_jac);
   }
+  if (reuse_residual_ == true) {
+    if (Teuchos::nonnull(f)) {
+      storeResidualForReuse(current_time, x, xdot, xdotdot, p, f, dt);
+    } else {
+      reuse_residual_valid_ = false;
+    }
+  }
   if (derivatives_check_ > 0) {
     checkDerivatives(*this, current_time, x, xdot, xdotdot, p, f, jac, derivatives_check_);
   }
 }  // namespace Albany
 
+bool
+Application::canReuseResidual(
+    double const                            current_time,
+    Teuchos::RCP<Thyra_Vector const> const& x,
+    Teuchos::RCP<Thyra_Vector const> const& x_dot,
+    Teuchos::RCP<Thyra_Vector const> const& x_dotdot,
+    const Teuchos::Array<ParamVec>&         p,
+    double const                            dt) const
+{
+  if (reuse_residual_valid_ == false) return false;
+  if (current_time != reuse_residual_time_ || dt != reuse_residual_dt_) return false;
+
+  int num_params = 0;
+  for (int i = 0; i < p.size(); i++) num_params += p[i].size();
+  if (num_params != reuse_residual_p_.size()) return false;
+  int k = 0;
+  for (int i = 0; i < p.size(); i++) {
+    for (unsigned int j = 0; j < p[i].size(); j++, k++) {
+      if (p[i][j].baseValue != reuse_residual_p_[k]) return false;
+    }
+  }
+
+  // Vectors may differ on some ranks only, so the decision is collective.
+  int const local_same = sameLocalData(x, reuse_residual_x_) && sameLocalData(x_dot, reuse_residual_xdot_) &&
+                                 sameLocalData(x_dotdot, reuse_residual_xdotdot_)
+                             ? 1
+                             : 0;
+  int global_same = 0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, local_same, Teuchos::outArg(global_same));
+  return global_same == 1;
+}
+
+void
+Application::storeResidualForReuse(
+    double const                            current_time,
+    Teuchos::RCP<Thyra_Vector const> const& x,
+    Teuchos::RCP<Thyra_Vector const> const& x_dot,
+    Teuchos::RCP<Thyra_Vector const> const& x_dotdot,
+    const Teuchos::Array<ParamVec>&         p,
+    Teuchos::RCP<Thyra_Vector const> const& f,
+    double const                            dt)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: Residual Reuse Store");
+  reuse_residual_time_ = current_time;
+  reuse_residual_dt_   = dt;
+  reuse_residual_p_.clear();
+  for (int i = 0; i < p.size(); i++) {
+    for (unsigned int j = 0; j < p[i].size(); j++) {
+      reuse_residual_p_.push_back(p[i][j].baseValue);
+    }
+  }
+  copyForReuse(f, reuse_residual_f_);
+  copyForReuse(x, reuse_residual_x_);
+  copyForReuse(x_dot, reuse_residual_xdot_);
+  copyForReuse(x_dotdot, reuse_residual_xdotdot_);
+  reuse_residual_valid_ = true;
+}
+
 void
 Application::computeGlobalJacobian(
     double const                            alpha,
@@ -1499,12 +1708,24 @@ Application::evaluateStateFieldManager(
     Teuchos::Ptr<Thyra_Vector const> xdotdot)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: State Residual");
+
+  // States are about to be updated, so a stored residual is no longer valid.
+  reuse_residual_valid_ = false;
+
+  // Nothing left if all the states are captured from the residual fill
+  auto&      counters = util::PerformanceContext::instance().counterMonitor();
+  bool const has_sfm  = std::any_of(sfm.begin(), sfm.end(), [](Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>> const& m) { return m != Teuchos::null; });
+  if (has_sfm == false) {
+    counters["Albany State Field Manager: Skipped"]->increment();
+    return;
+  }
   {
     std::string evalName = PHAL::evalName<PHAL::AlbanyTraits::Residual>("SFM", 0);
     if (!phxSetup->contain_eval(evalName)) {
       for (int ps = 0; ps < sfm.size(); ++ps) {
         evalName = PHAL::evalName<PHAL::AlbanyTraits::Residual>("SFM", ps);
         phxSetup->insert_eval(evalName);
+        if (sfm[ps] == Teuchos::null) continue;
 
         std::vector<PHX::index_size_type> derivative_dimensions;
         derivative_dimensions.push_back(PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(this, ps));
@@ -1516,6 +1737,10 @@ Application::evaluateStateFieldManager(
         phxSetup->update_fields();
 
         writePhalanxGraph<PHAL::AlbanyTraits::Residual>(sfm[ps], evalName, stateGraphVisDetail);
+        if (bind_states_ == true) {
+          sfm_binders_.resize(sfm.size());
+          sfm_binders_[ps] = Teuchos::rcp(new PHAL::StateFieldBinder(*sfm[ps]));
+        }
       }
     }
   }
@@ -1542,9 +1767,12 @@ Application::evaluateStateFieldManager(
   // Perform fill via field manager
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->beginEvaluatingSfm();
   for (int ws = 0; ws < numWorksets; ws++) {
+    if (sfm[wsPhysIndex[ws]] == Teuchos::null) continue;
     std::string const evalName = PHAL::evalName<PHAL::AlbanyTraits::Residual>("SFM", wsPhysIndex[ws]);
     loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws, evalName);
+    if (bind_states_ == true) sfm_binders_[wsPhysIndex[ws]]->bind(*workset.stateArrayPtr);
     sfm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+    counters["Albany State Field Manager: Worksets"]->increment();
   }
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->endEvaluatingSfm();
 }
@@ -1693,6 +1921,16 @@ Application::loadWorksetNodesetInfo(PHAL::Workset& workset)
   workset.nodeSetGIDs   = Teuchos::rcpFromRef(disc->getNodeSetGIDs());
 }
 
+void
+Application::setWorksetSizeTuner(Teuchos::RCP<WorksetSizeTuner> const& tuner)
+{
+  auto const&              mesh_specs = disc->getMeshStruct()->getMeshSpecs();
+  std::vector<std::string> blocks;
+  for (auto const& ms : mesh_specs) blocks.push_back(ms->ebName);
+  tuner->setMesh(blocks, mesh_specs[0]->worksetSize);
+  workset_size_tuner_ = tuner;
+}
+
 void
 Application::setScale(Teuchos::RCP<const Thyra_LinearOp> jac)
 {
@@ -6,6 +6,7 @@
 #define ALBANY_APPLICATION_HPP
 
 #include <set>
+#include <vector>
 
 #include "AAdapt_AdaptiveSolutionManager.hpp"
 #include "Albany_AbstractDiscretization.hpp"
@@ -13,9 +14,12 @@
 #include "Albany_AbstractResponseFunction.hpp"
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_StateManager.hpp"
+#include "Albany_WorksetSizeTuner.hpp"
 #include "Albany_config.h"
 #include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_EvaluatorTimings.hpp"
 #include "PHAL_Setup.hpp"
+#include "PHAL_StateFieldBinder.hpp"
 #include "PHAL_Workset.hpp"
 #include "Sacado_ParameterAccessor.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -209,6 +213,29 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
       Teuchos::RCP<Thyra_Vector> const&       f,
       Teuchos::RCP<Thyra_Vector const> const& x_post_SDBCs = Teuchos::null);
 
+  //! True if the residual stored by the last Jacobian fill was computed
+  //! from exactly these inputs and can be returned without a new fill.
+  bool
+  canReuseResidual(
+      double const                            current_time,
+      Teuchos::RCP<Thyra_Vector const> const& x,
+      Teuchos::RCP<Thyra_Vector const> const& x_dot,
+      Teuchos::RCP<Thyra_Vector const> const& x_dotdot,
+      const Teuchos::Array<ParamVec>&         p,
+      double const                            dt) const;
+
+  //! Store the residual computed during a Jacobian fill and the inputs
+  //! that produced it.
+  void
+  storeResidualForReuse(
+      double const                            current_time,
+      Teuchos::RCP<Thyra_Vector const> const& x,
+      Teuchos::RCP<Thyra_Vector const> const& x_dot,
+      Teuchos::RCP<Thyra_Vector const> const& x_dotdot,
+      const Teuchos::Array<ParamVec>&         p,
+      Teuchos::RCP<Thyra_Vector const> const& f,
+      double const                            dt);
+
  public:
   //! Compute global Jacobian
   /*!
@@ -526,12 +553,27 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
     return is_schwarz_alternating_;
   }
 
+  //! Restrict the residual and Jacobian fills to the worksets flagged in
+  //! active, for the explicit drivers that subcycle element blocks. Empty
+  //! for all worksets. A residual saved for reuse covers other worksets, so
+  //! it is dropped.
+  void
+  setActiveWorksets(std::vector<bool> const& active)
+  {
+    active_worksets_      = active;
+    reuse_residual_valid_ = false;
+  }
+
   Teuchos::RCP<AAdapt::AdaptiveSolutionManager>
   getSolutionManager() const
   {
     return solMgr;
   }
 
+  //! Time the workset evaluations of the first fills for the tuner
+  void
+  setWorksetSizeTuner(Teuchos::RCP<WorksetSizeTuner> const& tuner);
+
  private:
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> apps_;
 
@@ -547,6 +589,10 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
 
   bool is_schwarz_alternating_{false};
 
+  std::vector<bool> active_worksets_;
+
+  Teuchos::RCP<WorksetSizeTuner> workset_size_tuner_;
+
  public:
   //! Get Phalanx postRegistration data
   Teuchos::RCP<PHAL::Setup>
@@ -555,6 +601,13 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
     return phxSetup;
   }
 
+  //! Get the evaluator timings, null unless "Evaluator Timings" is set
+  Teuchos::RCP<PHAL::EvaluatorTimings>
+  getEvaluatorTimings()
+  {
+    return evaluatorTimings;
+  }
+
  protected:
   bool is_schwarz_{false};
   bool no_dir_bcs_{false};
@@ -640,6 +693,9 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   mutable int               phxGraphVisDetail{0};
   mutable int               stateGraphVisDetail{0};
 
+  //! Times of the evaluators of the field managers, across processes
+  Teuchos::RCP<PHAL::EvaluatorTimings> evaluatorTimings{Teuchos::null};
+
   StateManager stateMgr;
 
   bool morphFromInit{false};
@@ -655,6 +711,30 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   int derivatives_check_{0};
   int num_time_deriv{0};
 
+  // Residual reuse: a residual requested at the same state as the last
+  // Jacobian fill is returned from the copy stored by that fill.
+  bool                       reuse_residual_{false};
+  bool                       reuse_residual_valid_{false};
+  double                     reuse_residual_time_{0.0};
+  double                     reuse_residual_dt_{0.0};
+  Teuchos::Array<ST>         reuse_residual_p_;
+  Teuchos::RCP<Thyra_Vector> reuse_residual_f_{Teuchos::null};
+  Teuchos::RCP<Thyra_Vector> reuse_residual_field_{Teuchos::null};  // before the Dirichlet conditions
+  Teuchos::RCP<Thyra_Vector> reuse_residual_x_{Teuchos::null};
+  Teuchos::RCP<Thyra_Vector> reuse_residual_xdot_{Teuchos::null};
+  Teuchos::RCP<Thyra_Vector> reuse_residual_xdotdot_{Teuchos::null};
+
+  // State capture: the residual fill saves the states it can evaluate, and
+  // the state field managers only the others (null if none).
+  bool capture_states_{false};
+
+  // State binding: the Residual fields saved to or loaded from element
+  // states use the memory of the states of each workset, one binder per
+  // physics set (null for a null state field manager).
+  bool                                                 bind_states_{false};
+  Teuchos::Array<Teuchos::RCP<PHAL::StateFieldBinder>> resid_binders_;
+  Teuchos::Array<Teuchos::RCP<PHAL::StateFieldBinder>> sfm_binders_;
+
   // The following are for Jacobian/residual scaling
   Teuchos::Array<Teuchos::Array<int>> offsets_;
   std::vector<std::string>            nodeSetIDs_;
@@ -677,6 +757,7 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::s
 {
   auto const& wsElNodeEqID            = disc->getWsElNodeEqID();
   auto const& wsElNodeID              = disc->getWsElNodeID();
+  auto const& wsElColoring            = disc->getWsElColoring();
   auto const& coords                  = disc->getCoords();
   auto const& wsEBNames               = disc->getWsEBNames();
   auto const& sphereVolume            = disc->getSphereVolume();
@@ -706,6 +787,7 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::s
 
   workset.numCells             = wsElNodeEqID[ws].extent(0);
   workset.wsElNodeEqID         = wsElNodeEqID[ws];
+  workset.wsElColoring         = wsElColoring[ws];
   workset.wsElNodeID           = wsElNodeID[ws];
   workset.wsCoords             = coords[ws];
   workset.wsSphereVolume       = sphereVolume[ws];
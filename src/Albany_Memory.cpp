@@ -4,8 +4,10 @@
 
 #include "Albany_Memory.hpp"
 
+#include <Kokkos_Core.hpp>
 #include <Teuchos_CommHelpers.hpp>
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -21,6 +23,9 @@
 // For RPI BG/Q.
 #include <spi/include/kernel/memory.h>
 #endif
+#if defined(__linux__)
+#include <unistd.h>
+#endif
 
 namespace Albany {
 namespace {
@@ -252,6 +257,48 @@ class MemoryAnalyzer
     os << msg.str();
   }
 };
+
+// Resident set size of the process in bytes, 0 where it is not known
+std::int64_t
+residentSetSize()
+{
+#if defined(__linux__)
+  std::ifstream statm("/proc/self/statm");
+  long          size = 0, resident = 0;
+  statm >> size >> resident;
+  return statm ? static_cast<std::int64_t>(resident) * sysconf(_SC_PAGESIZE) : 0;
+#else
+  return 0;
+#endif
+}
+
+char const*
+tagName(MemoryTag const tag)
+{
+  switch (tag) {
+    case MemoryTag::Discretization: return "Discretization";
+    case MemoryTag::JacobianGraph: return "Jacobian Graph";
+    case MemoryTag::JacobianValues: return "Jacobian Values";
+    case MemoryTag::Preconditioner: return "Preconditioner";
+    case MemoryTag::StateArrays: return "State Arrays";
+    case MemoryTag::PhalanxFields: return "Phalanx Fields";
+    case MemoryTag::Output: return "Output";
+    default: return "Other";
+  }
+}
+
+void
+kokkosAllocate(Kokkos::Profiling::SpaceHandle const, char const*, void const* ptr, std::uint64_t const size)
+{
+  MemoryTracker::instance().allocate(ptr, size);
+}
+
+void
+kokkosDeallocate(Kokkos::Profiling::SpaceHandle const, char const*, void const* ptr, std::uint64_t const)
+{
+  MemoryTracker::instance().deallocate(ptr);
+}
+
 }  // namespace
 
 void
@@ -262,4 +309,117 @@ printMemoryAnalysis(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> con
   ma.print(os);
 }
 
+MemoryTracker&
+MemoryTracker::instance()
+{
+  static MemoryTracker tracker;
+  return tracker;
+}
+
+void
+MemoryTracker::enable()
+{
+  if (enabled_ == true) return;
+  Kokkos::Tools::Experimental::set_allocate_data_callback(&kokkosAllocate);
+  Kokkos::Tools::Experimental::set_deallocate_data_callback(&kokkosDeallocate);
+  enabled_ = true;
+}
+
+void
+MemoryTracker::push(MemoryTag const tag)
+{
+  std::int64_t const resident = residentSetSize();
+  std::lock_guard<std::mutex> lock(mutex_);
+  stack_.emplace_back(tag, resident);
+}
+
+void
+MemoryTracker::pop()
+{
+  std::int64_t const resident = residentSetSize();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stack_.empty() == true) return;
+  usage_[static_cast<int>(stack_.back().first)].resident_growth += resident - stack_.back().second;
+  stack_.pop_back();
+}
+
+void
+MemoryTracker::allocate(void const* ptr, std::uint64_t const size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  MemoryTag const             tag   = activeTag();
+  Usage&                      usage = usage_[static_cast<int>(tag)];
+  allocations_[ptr]                 = Allocation{tag, size};
+  usage.current += size;
+  usage.high_water = std::max(usage.high_water, usage.current);
+}
+
+void
+MemoryTracker::deallocate(void const* ptr)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto const                  it = allocations_.find(ptr);
+  // Allocated before the tracker was enabled
+  if (it == allocations_.end()) return;
+  usage_[static_cast<int>(it->second.tag)].current -= it->second.size;
+  allocations_.erase(it);
+}
+
+void
+MemoryTracker::report(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> const& comm, double const time)
+{
+  int const num_tags   = static_cast<int>(MemoryTag::NumTags);
+  int const num_values = 3 * num_tags + 1;
+
+  // Bytes, as doubles to use a single gather
+  std::vector<double> values(num_values);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int tag = 0; tag < num_tags; ++tag) {
+      values[3 * tag]     = usage_[tag].current;
+      values[3 * tag + 1] = usage_[tag].high_water;
+      values[3 * tag + 2] = usage_[tag].resident_growth;
+    }
+  }
+  values[num_values - 1] = residentSetSize();
+
+  int const           num_ranks = comm->getSize();
+  std::vector<double> all(comm->getRank() == 0 ? num_values * num_ranks : 1);
+  Teuchos::gather<int, double>(values.data(), num_values, all.data(), num_values, 0, *comm);
+  if (comm->getRank() != 0) return;
+
+  std::vector<double> max(num_values, 0.0);
+  std::vector<int>    max_rank(num_values, 0);
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    for (int i = 0; i < num_values; ++i) {
+      if (rank == 0 || all[rank * num_values + i] > max[i]) {
+        max[i]      = all[rank * num_values + i];
+        max_rank[i] = rank;
+      }
+    }
+  }
+
+  double const      MB = 1024.0 * 1024.0;
+  std::stringstream msg;
+  auto              value = [&](int const i) {
+    msg << " " << std::setw(12) << std::fixed << std::setprecision(1) << max[i] / MB << " " << std::setw(4) << max_rank[i];
+  };
+  msg << ">>> Albany Memory Tracker, time " << time << ", maximum over " << num_ranks << " ranks [MB] and rank holding it" << std::endl;
+  msg << std::setw(16) << "tag";
+  for (char const* column : {"current", "high water", "rss growth"}) msg << std::setw(13) << column << std::setw(5) << "proc";
+  msg << std::endl;
+  for (int tag = 0; tag < num_tags; ++tag) {
+    msg << std::setw(16) << tagName(static_cast<MemoryTag>(tag));
+    value(3 * tag);
+    value(3 * tag + 1);
+    value(3 * tag + 2);
+    msg << std::endl;
+  }
+  msg << std::setw(16) << "resident set";
+  value(num_values - 1);
+  msg << std::endl;
+  msg << "<<< Albany Memory Tracker" << std::endl;
+  os << msg.str();
+}
+
 }  // namespace Albany
@@ -6,7 +6,11 @@
 #define ALBANY_MEMORY_HPP
 
 #include <Teuchos_Comm.hpp>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Albany {
 /*! \brief Depending on configuration, report min, median, and max values over
@@ -47,6 +51,134 @@ namespace Albany {
  */
 void
 printMemoryAnalysis(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+//! Subsystems memory is attributed to
+enum class MemoryTag
+{
+  Discretization,
+  JacobianGraph,
+  JacobianValues,
+  Preconditioner,
+  StateArrays,
+  PhalanxFields,
+  Output,
+  Other,
+  NumTags
+};
+
+/*! \brief Memory accounting by subsystem.
+ *
+ *  Code that allocates memory for a subsystem opens a MemoryScope with the
+ *  tag of the subsystem. While the tracker is enabled, the Kokkos view
+ *  allocations and deallocations, which include the storage of the Tpetra
+ *  matrices and vectors, are attributed to the innermost open tag, or to
+ *  Other. For every tag, the tracker keeps the bytes currently allocated
+ *  and their high water, as well as the growth of the resident set size
+ *  between the opening and the closing of the scopes, which accounts for
+ *  the memory not allocated through Kokkos, such as the STK mesh. Scopes
+ *  nest; the resident growth of a scope includes that of its inner scopes.
+ *
+ *  Enable it with
+ *
+ *      <ParameterList name="Debug Output">
+ *        <Parameter name="Track Memory" type="bool" value="true"/>
+ *      </ParameterList>
+ *
+ *  Every output step then reports, for every tag, the maximum over ranks
+ *  and the rank holding it. Enabling the tracker replaces the allocation
+ *  callbacks of a Kokkos tool loaded through KOKKOS_PROFILE_LIBRARY.
+ *
+ *  Without a "Preconditioner Reuse" sublist, the preconditioner setups run
+ *  inside the linear solver factory, out of reach of the scopes. The
+ *  tracker then has the linear solver factory wrapped in the preconditioner
+ *  reuse factory with "Reuse Type" None, which rebuilds the preconditioner
+ *  at every Jacobian like the unwrapped factory, and says so in the output.
+ */
+class MemoryTracker
+{
+ public:
+  static MemoryTracker&
+  instance();
+
+  //! Start attributing Kokkos allocations. Kokkos must be initialized.
+  void
+  enable();
+
+  bool
+  enabled() const
+  {
+    return enabled_;
+  }
+
+  void
+  push(MemoryTag const tag);
+
+  void
+  pop();
+
+  //! Write the per-rank maximum for every tag on rank 0. Collective.
+  void
+  report(std::ostream& os, Teuchos::RCP<Teuchos::Comm<int> const> const& comm, double const time);
+
+  //! Called by the Kokkos allocation callbacks
+  void
+  allocate(void const* ptr, std::uint64_t const size);
+
+  void
+  deallocate(void const* ptr);
+
+ private:
+  struct Usage
+  {
+    std::int64_t current{0};
+    std::int64_t high_water{0};
+    std::int64_t resident_growth{0};
+  };
+
+  struct Allocation
+  {
+    MemoryTag     tag;
+    std::uint64_t size;
+  };
+
+  MemoryTag
+  activeTag() const
+  {
+    return stack_.empty() ? MemoryTag::Other : stack_.back().first;
+  }
+
+  bool                                            enabled_{false};
+  std::mutex                                      mutex_;
+  Usage                                           usage_[static_cast<int>(MemoryTag::NumTags)];
+  std::vector<std::pair<MemoryTag, std::int64_t>> stack_;  // open tags, with the resident set size when opened
+  std::unordered_map<void const*, Allocation>     allocations_;
+};
+
+//! Attributes the memory allocated during its lifetime to a tag
+class MemoryScope
+{
+ public:
+  explicit MemoryScope(MemoryTag const tag)
+  {
+    if (MemoryTracker::instance().enabled()) {
+      MemoryTracker::instance().push(tag);
+      active_ = true;
+    }
+  }
+
+  ~MemoryScope()
+  {
+    if (active_) MemoryTracker::instance().pop();
+  }
+
+  MemoryScope(MemoryScope const&) = delete;
+  MemoryScope&
+  operator=(MemoryScope const&) = delete;
+
+ private:
+  bool active_{false};
+};
+
 }  // namespace Albany
 
 #endif  // ALBANY_MEMORY_HPP
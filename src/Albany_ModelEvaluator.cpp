@@ -7,6 +7,7 @@
 #include "Albany_Application.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 
@@ -375,12 +376,15 @@ ModelEvaluator::get_p_names(int l) const
 Teuchos::RCP<Thyra_LinearOp>
 ModelEvaluator::create_W_op() const
 {
+  MemoryScope memory(MemoryTag::JacobianValues);
   return app->getDisc()->createJacobianOp();
 }
 
 Teuchos::RCP<Thyra_Preconditioner>
 ModelEvaluator::create_W_prec() const
 {
+  MemoryScope memory(MemoryTag::Preconditioner);
+
   Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec = Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
   Teuchos::RCP<Thyra_LinearOp>                   precOp = app->getPreconditioner();
 
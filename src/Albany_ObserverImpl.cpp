@@ -5,6 +5,7 @@
 
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
+#include "Albany_Memory.hpp"
 
 namespace Albany {
 
@@ -32,6 +33,9 @@ ObserverImpl::observeSolution(
         /*overlapped*/ true);
   }
 
+  if (app_->getEvaluatorTimings() != Teuchos::null) app_->getEvaluatorTimings()->recordStep(stamp);
+  if (MemoryTracker::instance().enabled()) MemoryTracker::instance().report(std::cout, app_->getComm(), stamp);
+
   StatelessObserverImpl::observeSolution(stamp, nonOverlappedSolution, nonOverlappedSolutionDot, nonOverlappedSolutionDotDot);
 }
 
@@ -40,6 +44,8 @@ ObserverImpl::observeSolution(double stamp, const Thyra_MultiVector& nonOverlapp
 {
   app_->evaluateStateFieldManager(stamp, nonOverlappedSolution);
   app_->getStateMgr().updateStates();
+  if (app_->getEvaluatorTimings() != Teuchos::null) app_->getEvaluatorTimings()->recordStep(stamp);
+  if (MemoryTracker::instance().enabled()) MemoryTracker::instance().report(std::cout, app_->getComm(), stamp);
   StatelessObserverImpl::observeSolution(stamp, nonOverlappedSolution);
 }
 
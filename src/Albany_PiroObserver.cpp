@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "Albany_PreconditionerReuse.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Thyra_VectorStdOps.hpp"
@@ -33,6 +34,7 @@ void
 PiroObserver::observeSolution(Thyra_Vector const& solution)
 {
   this->observeSolutionImpl(solution, Teuchos::ScalarTraits<ST>::zero());
+  this->reportPreconditionerReuse();
   stepper_counter_++;
 }
 
@@ -40,6 +42,7 @@ void
 PiroObserver::observeSolution(Thyra_Vector const& solution, const ST stamp)
 {
   this->observeSolutionImpl(solution, stamp);
+  this->reportPreconditionerReuse();
   stepper_counter_++;
 }
 
@@ -47,6 +50,7 @@ void
 PiroObserver::observeSolution(Thyra_Vector const& solution, Thyra_Vector const& solution_dot, const ST stamp)
 {
   this->observeSolutionImpl(solution, solution_dot, stamp);
+  this->reportPreconditionerReuse();
   stepper_counter_++;
 }
 
@@ -54,6 +58,7 @@ void
 PiroObserver::observeSolution(Thyra_Vector const& solution, Thyra_Vector const& solution_dot, Thyra_Vector const& solution_dotdot, const ST stamp)
 {
   this->observeSolutionImpl(solution, solution_dot, solution_dotdot, stamp);
+  this->reportPreconditionerReuse();
   stepper_counter_++;
 }
 
@@ -61,6 +66,7 @@ void
 PiroObserver::observeSolution(const Thyra_MultiVector& solution, const ST stamp)
 {
   this->observeSolutionImpl(solution, stamp);
+  this->reportPreconditionerReuse();
   stepper_counter_++;
 }
 
@@ -70,6 +76,16 @@ PiroObserver::parameterChanged(std::string const& param)
   impl_.parameterChanged(param);
 }
 
+void
+PiroObserver::reportPreconditionerReuse()
+{
+  if (model_.is_null() == true) return;
+  auto const reuse_factory = Teuchos::rcp_dynamic_cast<const PreconditionerReuseLOWSFactory>(model_->get_W_factory());
+  if (reuse_factory.is_null() == false && reuse_factory->reportTimings() == true) {
+    reuse_factory->report(*out);
+  }
+}
+
 void
 PiroObserver::observeSolutionImpl(Thyra_Vector const& solution, const ST defaultStamp)
 {
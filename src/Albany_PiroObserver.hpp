@@ -51,6 +51,11 @@ class PiroObserver : public Piro::ObserverBase<ST>
   void
   observeSolutionImpl(const Thyra_MultiVector& solution, const ST defaultStamp);
 
+  // Print preconditioner setup vs. apply time for the step just completed,
+  // if the linear solver uses a preconditioner reuse policy.
+  void
+  reportPreconditionerReuse();
+
   void
   observeTpetraSolutionImpl(
       const Tpetra_Vector&              solution,
@@ -0,0 +1,307 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_PreconditionerReuse.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+#include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+#include "utility/PerformanceContext.hpp"
+
+namespace {
+
+// Number of linear iterations reported by the solver, or -1 if unknown.
+int
+getIterationCount(Thyra::SolveStatus<ST> const& status)
+{
+  auto const& extra = status.extraParameters;
+  if (extra.is_null() == true) return -1;
+  if (extra->isType<int>("Belos/Iteration Count") == true) return extra->get<int>("Belos/Iteration Count");
+  if (extra->isType<int>("Iteration Count") == true) return extra->get<int>("Iteration Count");
+  return -1;
+}
+
+}  // namespace
+
+namespace Albany {
+
+//
+// PreconditionerReuseLOWS
+//
+PreconditionerReuseLOWS::PreconditionerReuseLOWS(Teuchos::RCP<Thyra_LOWS> const& lows, Teuchos::RCP<PreconditionerReuseStats> const& stats)
+    : lows_(lows), stats_(stats), timer_("Preconditioner Reuse Apply")
+{
+  ALBANY_ASSERT(lows_.is_null() == false, "PreconditionerReuseLOWS requires a valid linear solver.");
+}
+
+std::string
+PreconditionerReuseLOWS::description() const
+{
+  return "Albany::PreconditionerReuseLOWS{" + lows_->description() + "}";
+}
+
+bool
+PreconditionerReuseLOWS::opSupportedImpl(Thyra::EOpTransp M_trans) const
+{
+  return lows_->opSupported(M_trans);
+}
+
+void
+PreconditionerReuseLOWS::applyImpl(
+    Thyra::EOpTransp const                 M_trans,
+    Thyra_MultiVector const&               X,
+    Teuchos::Ptr<Thyra_MultiVector> const& Y,
+    ST const                               alpha,
+    ST const                               beta) const
+{
+  lows_->apply(M_trans, X, Y, alpha, beta);
+}
+
+bool
+PreconditionerReuseLOWS::solveSupportsImpl(Thyra::EOpTransp transp) const
+{
+  return lows_->solveSupports(transp);
+}
+
+bool
+PreconditionerReuseLOWS::solveSupportsSolveMeasureTypeImpl(Thyra::EOpTransp transp, Thyra::SolveMeasureType const& solveMeasureType) const
+{
+  return lows_->solveSupportsSolveMeasureType(transp, solveMeasureType);
+}
+
+Thyra::SolveStatus<ST>
+PreconditionerReuseLOWS::solveImpl(
+    Thyra::EOpTransp const                             transp,
+    Thyra_MultiVector const&                           B,
+    Teuchos::Ptr<Thyra_MultiVector> const&             X,
+    Teuchos::Ptr<Thyra::SolveCriteria<ST> const> const solveCriteria) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Preconditioner Reuse: Apply");
+  timer_.start(true);
+  auto const status = lows_->solve(transp, B, X, solveCriteria);
+  timer_.stop();
+
+  last_iterations = getIterationCount(status);
+  if (iterations_at_rebuild < 0) iterations_at_rebuild = last_iterations;
+
+  stats_->apply_time += timer_.totalElapsedTime();
+  stats_->total_apply_time += timer_.totalElapsedTime();
+  stats_->num_solves += 1;
+  stats_->num_iterations += std::max(last_iterations, 0);
+  return status;
+}
+
+//
+// PreconditionerReuseLOWSFactory
+//
+PreconditionerReuseLOWSFactory::PreconditionerReuseLOWSFactory(Teuchos::RCP<Thyra_LOWS_Factory> const& factory, Teuchos::ParameterList const& params)
+    : factory_(factory), stats_(Teuchos::rcp(new PreconditionerReuseStats))
+{
+  ALBANY_ASSERT(factory_.is_null() == false, "PreconditionerReuseLOWSFactory requires a valid linear solver factory.");
+
+  Teuchos::ParameterList pl = params;
+  pl.validateParametersAndSetDefaults(*getValidReuseParameters(), 0);
+
+  auto const type = pl.get<std::string>("Reuse Type");
+  if (type == "None") {
+    reuse_type_ = ReuseType::None;
+  } else if (type == "Symbolic") {
+    reuse_type_ = ReuseType::Symbolic;
+  } else if (type == "Full") {
+    reuse_type_ = ReuseType::Full;
+  } else {
+    ALBANY_ABORT("Unknown Preconditioner Reuse Type: " << type << ". Valid types are None, Symbolic and Full.");
+  }
+  growth_factor_  = pl.get<double>("Iteration Growth Factor");
+  max_reuses_     = pl.get<int>("Maximum Reuses");
+  report_timings_ = pl.get<bool>("Report Timings");
+  ALBANY_ASSERT(growth_factor_ >= 1.0, "Preconditioner Reuse: 'Iteration Growth Factor' must be >= 1.");
+}
+
+Teuchos::RCP<Teuchos::ParameterList const>
+PreconditionerReuseLOWSFactory::getValidReuseParameters()
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL = Teuchos::rcp(new Teuchos::ParameterList("Valid Preconditioner Reuse Params"));
+  validPL->set<std::string>("Reuse Type", "Full", "What to keep between Jacobians: None, Symbolic (MueLu hierarchy) or Full (whole preconditioner)");
+  validPL->set<double>(
+      "Iteration Growth Factor", 2.0, "Rebuild when the linear iteration count exceeds this factor times the count at the last rebuild");
+  validPL->set<int>("Maximum Reuses", -1, "Rebuild after this many reuses (-1 for no limit)");
+  validPL->set<bool>("Report Timings", true, "Print preconditioner setup and apply times after each step");
+  return validPL;
+}
+
+std::string
+PreconditionerReuseLOWSFactory::description() const
+{
+  return "Albany::PreconditionerReuseLOWSFactory{" + factory_->description() + "}";
+}
+
+Teuchos::RCP<Thyra_LOWS>
+PreconditionerReuseLOWSFactory::createOp() const
+{
+  return Teuchos::rcp(new PreconditionerReuseLOWS(factory_->createOp(), stats_));
+}
+
+PreconditionerReuseLOWS&
+PreconditionerReuseLOWSFactory::getReuseLOWS(Thyra_LOWS* Op) const
+{
+  auto reuse_op = dynamic_cast<PreconditionerReuseLOWS*>(Op);
+  ALBANY_ASSERT(reuse_op != nullptr, "Linear solver was not created by PreconditionerReuseLOWSFactory.");
+  return *reuse_op;
+}
+
+bool
+PreconditionerReuseLOWSFactory::needsRebuild(PreconditionerReuseLOWS const& op) const
+{
+  if (op.is_initialized == false) return true;
+  if (max_reuses_ >= 0 && op.reuses_since_rebuild >= max_reuses_) return true;
+  // Without an iteration count there is nothing to base the decision on.
+  if (op.last_iterations < 0 || op.iterations_at_rebuild < 0) return false;
+  double const reference = std::max(op.iterations_at_rebuild, 1);
+  return op.last_iterations > growth_factor_ * reference;
+}
+
+void
+PreconditionerReuseLOWSFactory::initializeOp(
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+    Thyra_LOWS*                                              Op,
+    Thyra::ESupportSolveUse const                            supportSolveUse) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Preconditioner Reuse: Setup");
+  MemoryScope memory(MemoryTag::Preconditioner);
+  auto&       op = getReuseLOWS(Op);
+
+  Teuchos::Time timer("Preconditioner Reuse Setup");
+  timer.start(true);
+  bool const rebuild = reuse_type_ == ReuseType::None || needsRebuild(op);
+  if (rebuild == true) {
+    // A fresh solver object drops everything kept by the old preconditioner,
+    // including a MueLu hierarchy kept through "reuse: type".
+    if (op.is_initialized == true && reuse_type_ != ReuseType::None) op.setLOWS(factory_->createOp());
+    factory_->initializeOp(fwdOpSrc, op.getLOWS().get(), supportSolveUse);
+    op.iterations_at_rebuild = -1;
+    op.reuses_since_rebuild  = 0;
+    stats_->num_rebuilds += 1;
+    stats_->total_rebuilds += 1;
+  } else if (reuse_type_ == ReuseType::Symbolic) {
+    // Numeric setup on top of the existing preconditioner.
+    factory_->initializeOp(fwdOpSrc, op.getLOWS().get(), supportSolveUse);
+    op.reuses_since_rebuild += 1;
+    stats_->num_reuses += 1;
+    stats_->total_reuses += 1;
+  } else {
+    factory_->initializeAndReuseOp(fwdOpSrc, op.getLOWS().get());
+    op.reuses_since_rebuild += 1;
+    stats_->num_reuses += 1;
+    stats_->total_reuses += 1;
+  }
+  timer.stop();
+  op.is_initialized = true;
+
+  stats_->setup_time += timer.totalElapsedTime();
+  stats_->total_setup_time += timer.totalElapsedTime();
+}
+
+void
+PreconditionerReuseLOWSFactory::initializeAndReuseOp(Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc, Thyra_LOWS* Op) const
+{
+  MemoryScope memory(MemoryTag::Preconditioner);
+  auto&       op = getReuseLOWS(Op);
+  factory_->initializeAndReuseOp(fwdOpSrc, op.getLOWS().get());
+  op.is_initialized = true;
+}
+
+void
+PreconditionerReuseLOWSFactory::uninitializeOp(
+    Thyra_LOWS*                                        Op,
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>* fwdOpSrc,
+    Teuchos::RCP<Thyra::PreconditionerBase<ST> const>* prec,
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>* approxFwdOpSrc,
+    Thyra::ESupportSolveUse*                           supportSolveUse) const
+{
+  auto& op = getReuseLOWS(Op);
+  factory_->uninitializeOp(op.getLOWS().get(), fwdOpSrc, prec, approxFwdOpSrc, supportSolveUse);
+  op.is_initialized = false;
+}
+
+void
+PreconditionerReuseLOWSFactory::initializePreconditionedOp(
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+    Teuchos::RCP<Thyra::PreconditionerBase<ST> const> const& prec,
+    Thyra_LOWS*                                              Op,
+    Thyra::ESupportSolveUse const                            supportSolveUse) const
+{
+  // An externally supplied preconditioner is managed by its owner.
+  auto& op = getReuseLOWS(Op);
+  factory_->initializePreconditionedOp(fwdOpSrc, prec, op.getLOWS().get(), supportSolveUse);
+  op.is_initialized = true;
+}
+
+void
+PreconditionerReuseLOWSFactory::initializeApproxPreconditionedOp(
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+    Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& approxFwdOpSrc,
+    Thyra_LOWS*                                              Op,
+    Thyra::ESupportSolveUse const                            supportSolveUse) const
+{
+  auto& op = getReuseLOWS(Op);
+  factory_->initializeApproxPreconditionedOp(fwdOpSrc, approxFwdOpSrc, op.getLOWS().get(), supportSolveUse);
+  op.is_initialized = true;
+}
+
+void
+PreconditionerReuseLOWSFactory::report(std::ostream& os) const
+{
+  auto& variables = util::PerformanceContext::instance().variableMonitor();
+  variables["Preconditioner Setup Time"]->addValue(stats_->setup_time);
+  variables["Preconditioner Apply Time"]->addValue(stats_->apply_time);
+
+  os << std::scientific << std::setprecision(3) << "Preconditioner: setup " << stats_->setup_time << " s (" << stats_->num_rebuilds << " rebuilds, "
+     << stats_->num_reuses << " reuses), apply " << stats_->apply_time << " s (" << stats_->num_solves << " solves, " << stats_->num_iterations
+     << " linear iterations); run totals: setup " << stats_->total_setup_time << " s, apply " << stats_->total_apply_time << " s\n"
+     << std::defaultfloat;
+
+  stats_->setup_time     = 0.0;
+  stats_->apply_time     = 0.0;
+  stats_->num_rebuilds   = 0;
+  stats_->num_reuses     = 0;
+  stats_->num_solves     = 0;
+  stats_->num_iterations = 0;
+}
+
+void
+setPreconditionerReuseSolverParameters(Teuchos::RCP<Teuchos::ParameterList> const& appParams, Teuchos::RCP<Teuchos::ParameterList> const& stratParams)
+{
+  if (appParams->isSublist("Preconditioner Reuse") == false || stratParams.is_null() == true) return;
+  auto const& reuse_params = appParams->sublist("Preconditioner Reuse");
+  if (reuse_params.get<std::string>("Reuse Type", "Full") != "Symbolic") return;
+  if (stratParams->get<std::string>("Preconditioner Type", "None") != "MueLu") return;
+  auto& muelu_params = stratParams->sublist("Preconditioner Types").sublist("MueLu");
+  if (muelu_params.isParameter("reuse: type") == false) muelu_params.set<std::string>("reuse: type", "RP");
+}
+
+Teuchos::RCP<Thyra_LOWS_Factory>
+createPreconditionerReuseFactory(Teuchos::RCP<Thyra_LOWS_Factory> const& factory, Teuchos::RCP<Teuchos::ParameterList> const& appParams)
+{
+  if (appParams->isSublist("Preconditioner Reuse") == false) {
+    if (MemoryTracker::instance().enabled() == false) return factory;
+    // Without reuse, the wrapper only attributes the setups to the
+    // preconditioner memory tag. Reuse Type None rebuilds the preconditioner
+    // at every Jacobian, as the linear solver factory does by itself, and
+    // passes the reuses requested by the nonlinear solver through.
+    *Teuchos::VerboseObjectBase::getDefaultOStream() << "Track Memory: the linear solver factory is wrapped in the preconditioner reuse factory "
+                                                        "with Reuse Type None, to attribute the preconditioner setups.\n";
+    Teuchos::ParameterList no_reuse;
+    no_reuse.set<std::string>("Reuse Type", "None");
+    no_reuse.set<bool>("Report Timings", false);
+    return Teuchos::rcp(new PreconditionerReuseLOWSFactory(factory, no_reuse));
+  }
+  return Teuchos::rcp(new PreconditionerReuseLOWSFactory(factory, appParams->sublist("Preconditioner Reuse")));
+}
+
+}  // namespace Albany
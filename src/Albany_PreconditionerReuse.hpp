@@ -0,0 +1,294 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_PRECONDITIONER_REUSE_HPP
+#define ALBANY_PRECONDITIONER_REUSE_HPP
+
+#include <iostream>
+#include <string>
+
+#include "Albany_ThyraTypes.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
+#include "Thyra_LinearOpWithSolveBase.hpp"
+#include "Thyra_LinearOpWithSolveFactoryBase.hpp"
+
+namespace Albany {
+
+//
+// Preconditioner reuse policy.
+//
+// The Stratimikos linear solve strategy rebuilds the preconditioner every
+// time the Jacobian changes. In quasi-static problems the operator changes
+// slowly between Newton iterations and load steps, so the preconditioner
+// built for an earlier Jacobian is often good enough. The factory below
+// decorates the Stratimikos factory and decides, for each new Jacobian,
+// whether to
+//
+//   - reuse the whole preconditioner ("Full"),
+//   - recompute it numerically on top of the existing one, which lets MueLu
+//     keep its hierarchy (symbolic setup) through "reuse: type"
+//     ("Symbolic"), or
+//   - build it from scratch.
+//
+// A rebuild from scratch is triggered when the number of linear iterations
+// of the last solve exceeds "Iteration Growth Factor" times the number
+// observed right after the last rebuild, or after "Maximum Reuses" reuses.
+//
+struct PreconditionerReuseStats
+{
+  // Accumulated since the last call to report().
+  double setup_time{0.0};
+  double apply_time{0.0};
+  int    num_rebuilds{0};
+  int    num_reuses{0};
+  int    num_solves{0};
+  int    num_iterations{0};
+
+  // Accumulated over the whole run.
+  double total_setup_time{0.0};
+  double total_apply_time{0.0};
+  int    total_rebuilds{0};
+  int    total_reuses{0};
+};
+
+class PreconditionerReuseLOWS : public Thyra::LinearOpWithSolveBase<ST>
+{
+ public:
+  PreconditionerReuseLOWS(Teuchos::RCP<Thyra_LOWS> const& lows, Teuchos::RCP<PreconditionerReuseStats> const& stats);
+
+  Teuchos::RCP<Thyra_VectorSpace const>
+  range() const override
+  {
+    return lows_->range();
+  }
+
+  Teuchos::RCP<Thyra_VectorSpace const>
+  domain() const override
+  {
+    return lows_->domain();
+  }
+
+  std::string
+  description() const override;
+
+  Teuchos::RCP<Thyra_LOWS> const&
+  getLOWS() const
+  {
+    return lows_;
+  }
+
+  void
+  setLOWS(Teuchos::RCP<Thyra_LOWS> const& lows)
+  {
+    lows_ = lows;
+  }
+
+  // Policy state, owned by each operator. The iteration counts are updated
+  // by the (const) solve.
+  bool        is_initialized{false};
+  mutable int iterations_at_rebuild{-1};
+  mutable int last_iterations{-1};
+  int         reuses_since_rebuild{0};
+
+ protected:
+  bool
+  opSupportedImpl(Thyra::EOpTransp M_trans) const override;
+
+  void
+  applyImpl(
+      Thyra::EOpTransp const                  M_trans,
+      Thyra_MultiVector const&                X,
+      Teuchos::Ptr<Thyra_MultiVector> const&  Y,
+      ST const                                alpha,
+      ST const                                beta) const override;
+
+  bool
+  solveSupportsImpl(Thyra::EOpTransp transp) const override;
+
+  bool
+  solveSupportsSolveMeasureTypeImpl(Thyra::EOpTransp transp, Thyra::SolveMeasureType const& solveMeasureType) const override;
+
+  Thyra::SolveStatus<ST>
+  solveImpl(
+      Thyra::EOpTransp const                              transp,
+      Thyra_MultiVector const&                            B,
+      Teuchos::Ptr<Thyra_MultiVector> const&              X,
+      Teuchos::Ptr<Thyra::SolveCriteria<ST> const> const  solveCriteria) const override;
+
+ private:
+  Teuchos::RCP<Thyra_LOWS>               lows_;
+  Teuchos::RCP<PreconditionerReuseStats> stats_;
+  mutable Teuchos::Time                  timer_;
+};
+
+class PreconditionerReuseLOWSFactory : public Thyra::LinearOpWithSolveFactoryBase<ST>
+{
+ public:
+  enum class ReuseType
+  {
+    None,
+    Symbolic,
+    Full
+  };
+
+  PreconditionerReuseLOWSFactory(Teuchos::RCP<Thyra_LOWS_Factory> const& factory, Teuchos::ParameterList const& params);
+
+  static Teuchos::RCP<Teuchos::ParameterList const>
+  getValidReuseParameters();
+
+  //! Print setup vs. apply time accumulated since the last call and reset it.
+  void
+  report(std::ostream& os) const;
+
+  bool
+  reportTimings() const
+  {
+    return report_timings_;
+  }
+
+  PreconditionerReuseStats const&
+  stats() const
+  {
+    return *stats_;
+  }
+
+  // Thyra::LinearOpWithSolveFactoryBase
+  bool
+  acceptsPreconditionerFactory() const override
+  {
+    return factory_->acceptsPreconditionerFactory();
+  }
+
+  void
+  setPreconditionerFactory(Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> const& precFactory, std::string const& precFactoryName) override
+  {
+    factory_->setPreconditionerFactory(precFactory, precFactoryName);
+  }
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>
+  getPreconditionerFactory() const override
+  {
+    return factory_->getPreconditionerFactory();
+  }
+
+  void
+  unsetPreconditionerFactory(Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>* precFactory, std::string* precFactoryName) override
+  {
+    factory_->unsetPreconditionerFactory(precFactory, precFactoryName);
+  }
+
+  bool
+  isCompatible(Thyra::LinearOpSourceBase<ST> const& fwdOpSrc) const override
+  {
+    return factory_->isCompatible(fwdOpSrc);
+  }
+
+  Teuchos::RCP<Thyra_LOWS>
+  createOp() const override;
+
+  void
+  initializeOp(
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+      Thyra_LOWS*                                              Op,
+      Thyra::ESupportSolveUse const                            supportSolveUse) const override;
+
+  void
+  initializeAndReuseOp(Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc, Thyra_LOWS* Op) const override;
+
+  void
+  uninitializeOp(
+      Thyra_LOWS*                                        Op,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>* fwdOpSrc,
+      Teuchos::RCP<Thyra::PreconditionerBase<ST> const>* prec,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>* approxFwdOpSrc,
+      Thyra::ESupportSolveUse*                           supportSolveUse) const override;
+
+  bool
+  supportsPreconditionerInputType(Thyra::EPreconditionerInputType const precOpType) const override
+  {
+    return factory_->supportsPreconditionerInputType(precOpType);
+  }
+
+  void
+  initializePreconditionedOp(
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+      Teuchos::RCP<Thyra::PreconditionerBase<ST> const> const& prec,
+      Thyra_LOWS*                                              Op,
+      Thyra::ESupportSolveUse const                            supportSolveUse) const override;
+
+  void
+  initializeApproxPreconditionedOp(
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& fwdOpSrc,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const& approxFwdOpSrc,
+      Thyra_LOWS*                                              Op,
+      Thyra::ESupportSolveUse const                            supportSolveUse) const override;
+
+  // Teuchos::ParameterListAcceptor, forwarded to the Stratimikos factory
+  void
+  setParameterList(Teuchos::RCP<Teuchos::ParameterList> const& paramList) override
+  {
+    factory_->setParameterList(paramList);
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  getNonconstParameterList() override
+  {
+    return factory_->getNonconstParameterList();
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  unsetParameterList() override
+  {
+    return factory_->unsetParameterList();
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList const>
+  getParameterList() const override
+  {
+    return factory_->getParameterList();
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList const>
+  getValidParameters() const override
+  {
+    return factory_->getValidParameters();
+  }
+
+  std::string
+  description() const override;
+
+ private:
+  PreconditionerReuseLOWS&
+  getReuseLOWS(Thyra_LOWS* Op) const;
+
+  bool
+  needsRebuild(PreconditionerReuseLOWS const& op) const;
+
+  Teuchos::RCP<Thyra_LOWS_Factory>       factory_;
+  Teuchos::RCP<PreconditionerReuseStats> stats_;
+
+  ReuseType reuse_type_{ReuseType::None};
+  double    growth_factor_{2.0};
+  int       max_reuses_{-1};
+  bool      report_timings_{true};
+};
+
+//! For "Symbolic" reuse with MueLu, set "reuse: type" in the MueLu list
+//! unless given. Must be called before the Stratimikos builder reads it.
+void
+setPreconditionerReuseSolverParameters(
+    Teuchos::RCP<Teuchos::ParameterList> const& appParams,
+    Teuchos::RCP<Teuchos::ParameterList> const& stratParams);
+
+//! Decorate a Stratimikos factory with the reuse policy in the top-level
+//! "Preconditioner Reuse" sublist. Returns the factory unchanged if the
+//! sublist is absent.
+Teuchos::RCP<Thyra_LOWS_Factory>
+createPreconditionerReuseFactory(Teuchos::RCP<Thyra_LOWS_Factory> const& factory, Teuchos::RCP<Teuchos::ParameterList> const& appParams);
+
+}  // namespace Albany
+
+#endif  // ALBANY_PRECONDITIONER_REUSE_HPP
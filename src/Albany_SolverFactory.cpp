@@ -9,8 +9,11 @@
 #include "Albany_Macros.hpp"
 #include "Albany_ModelEvaluator.hpp"
 #include "Albany_PiroObserver.hpp"
+#include "Albany_PreconditionerReuse.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Utils.hpp"
+#include "Albany_WorksetSizeTuner.hpp"
+#include "Explicit_Dynamics.hpp"
 #include "Piro_NOXSolver.hpp"
 #include "Piro_ProviderBase.hpp"
 #include "Piro_SolverFactory.hpp"
@@ -71,6 +74,7 @@ SolverFactory::SolverFactory(std::string const& inputFile, const Teuchos::RCP<Te
   } else {
     Teuchos::updateParametersFromXmlFileAndBroadcast(inputFile, appParams.ptr(), *comm);
   }
+  resolveWorksetSizeCacheFile(*appParams, inputFile);
 
   // do not set default solver parameters for ATO::Solver problems,
   // ... as they handle this themselves
@@ -174,6 +178,13 @@ SolverFactory::createAndGetAlbanyApp(
     return Teuchos::rcp(new LCM::ACEThermoMechanical(appParams, solverComm));
   }
 
+  if (solutionMethod == "Explicit Dynamics") {
+    auto const explicit_dynamics = Teuchos::rcp(new LCM::ExplicitDynamics(appParams, solverComm));
+    // The responses are the ones of the application of the model
+    albanyApp = explicit_dynamics->getApp();
+    return explicit_dynamics;
+  }
+
   model_ = createAlbanyAppAndModel(albanyApp, appComm, initial_guess, createAlbanyApp);
 
   const Teuchos::RCP<Teuchos::ParameterList> piroParams = Teuchos::sublist(appParams, "Piro");
@@ -199,9 +210,10 @@ SolverFactory::createAndGetAlbanyApp(
     Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
     enableMueLu(linearSolverBuilder);
     enableFROSch(linearSolverBuilder);
+    setPreconditionerReuseSolverParameters(appParams, stratList);
     linearSolverBuilder.setParameterList(stratList);
 
-    const Teuchos::RCP<Thyra_LOWS_Factory> lowsFactory = createLinearSolveStrategy(linearSolverBuilder);
+    const Teuchos::RCP<Thyra_LOWS_Factory> lowsFactory = createPreconditionerReuseFactory(createLinearSolveStrategy(linearSolverBuilder), appParams);
 
     modelWithSolve = rcp(new Thyra::DefaultModelEvaluatorWithSolveFactory<ST>(model_, lowsFactory));
   }
@@ -233,8 +245,13 @@ SolverFactory::createAlbanyAppAndModel(
     bool const                              createAlbanyApp)
 {
   if (createAlbanyApp) {
+    // Optionally choose the workset size by timing candidate sizes, one per
+    // run, on the application
+    Teuchos::RCP<WorksetSizeTuner> const tuner = tuneWorksetSize(appParams, appComm);
+
     // Create application
     albanyApp = Teuchos::rcp(new Application(appComm, appParams, initial_guess, is_schwarz_));
+    if (tuner != Teuchos::null) albanyApp->setWorksetSizeTuner(tuner);
     //  albanyApp = rcp(new ApplicationT(appComm, appParams,
     //  initial_guess));
   }
@@ -512,6 +529,7 @@ SolverFactory::getValidAppParameters() const
   validPL->sublist("Piro", false, "Piro sublist");
   validPL->sublist("Coupled System", false, "Coupled system sublist");
   validPL->sublist("Alternating System", false, "Alternating system sublist");
+  validPL->sublist("Preconditioner Reuse", false, "Preconditioner reuse policy sublist");
   validPL->set<bool>("Enable TimeMonitor Output", false, "Flag to enable TimeMonitor output");
 
   // validPL->set<std::string>("Jacobian Operator", "Have Jacobian", "Flag to
@@ -536,6 +554,7 @@ SolverFactory::getValidDebugParameters() const
   validPL->set<bool>("Write Distributed Solution and Map to MatrixMarket", false, "Flag to Write Distributed Solution and Map to MatrixMarket");
   validPL->set<int>("Write Solution to Standard Output", 0, "Solution Number to Dump to  Standard Output");
   validPL->set<bool>("Analyze Memory", false, "Flag to Analyze Memory");
+  validPL->set<bool>("Track Memory", false, "Flag to report the memory of each subsystem at every output step");
   return validPL;
 }
 
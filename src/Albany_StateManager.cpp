@@ -4,6 +4,7 @@
 #include "Albany_StateManager.hpp"
 
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
@@ -517,6 +518,8 @@ Albany::StateManager::setupStateArrays(const Teuchos::RCP<Albany::AbstractDiscre
   ALBANY_PANIC(stateVarsAreAllocated);
   stateVarsAreAllocated = true;
 
+  MemoryScope memory(MemoryTag::StateArrays);
+
   disc = disc_;
 
   doSetStateArrays(disc, stateInfo);
@@ -0,0 +1,274 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_WorksetSizeTuner.hpp"
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_VerboseObject.hpp>
+#include <Teuchos_YamlParameterListHelpers.hpp>
+#include <fstream>
+#include <iomanip>
+
+#include "Albany_Macros.hpp"
+#include "Albany_MaterialDatabase.hpp"
+
+namespace Albany {
+
+namespace {
+
+Teuchos::RCP<Teuchos::ParameterList const>
+getValidAutotuneParameters()
+{
+  auto validPL = Teuchos::rcp(new Teuchos::ParameterList("Valid Workset Size Autotune Params"));
+
+  validPL->set<Teuchos::Array<int>>("Candidate Workset Sizes", Teuchos::tuple<int>(16, 32, 64, 128, 256), "Workset sizes to time, one per run");
+  validPL->set<int>("Number of Evaluations", 3, "Timed residual and Jacobian fills of the run that times a candidate");
+  validPL->set<std::string>("Cache File", "workset_size.yaml", "File the timings and the choice are written to, and read from");
+
+  return validPL;
+}
+
+// The timing of a candidate in the cache file
+std::string
+timingName(int const candidate)
+{
+  return "Workset Size " + std::to_string(candidate);
+}
+
+// What the choice depends on: the mesh, the number of processes, the
+// material models and the candidates. A cache file with another
+// fingerprint is tuned again.
+Teuchos::ParameterList
+getFingerprint(Teuchos::ParameterList const& app_params, Teuchos::RCP<Teuchos_Comm const> comm, Teuchos::Array<int> const& candidates)
+{
+  Teuchos::ParameterList fingerprint("Fingerprint");
+
+  Teuchos::ParameterList const& disc_params = app_params.sublist("Discretization");
+  for (auto const name : {"Method", "Exodus Input File Name", "1D Elements", "2D Elements", "3D Elements"}) {
+    if (disc_params.isParameter(name) == true) fingerprint.setEntry(name, disc_params.getEntry(name));
+  }
+
+  fingerprint.set("Number of Processes", comm->getSize());
+
+  Teuchos::ParameterList const& problem_params = app_params.sublist("Problem");
+  if (problem_params.isType<std::string>("MaterialDB Filename") == true) {
+    MaterialDatabase               material_db(problem_params.get<std::string>("MaterialDB Filename"), comm);
+    std::vector<std::string> const models = material_db.getAllMatchingParams<std::string>("Model Name");
+    if (models.empty() == false) fingerprint.set("Material Models", Teuchos::Array<std::string>(models));
+  }
+
+  fingerprint.set("Candidate Workset Sizes", candidates);
+
+  return fingerprint;
+}
+
+bool
+fileExists(std::string const& filename, Teuchos_Comm const& comm)
+{
+  int exists{0};
+  if (comm.getRank() == 0) exists = std::ifstream(filename).good() ? 1 : 0;
+  Teuchos::broadcast(comm, 0, Teuchos::outArg(exists));
+  return exists == 1;
+}
+
+}  // anonymous namespace
+
+WorksetSizeTuner::WorksetSizeTuner(
+    Teuchos::RCP<Teuchos_Comm const> const& comm,
+    Teuchos::ParameterList const&           cache,
+    std::string const&                      cache_file,
+    Teuchos::Array<int> const&              candidates,
+    int const                               candidate,
+    int const                               num_evaluations)
+    : comm_(comm), cache_(cache), cache_file_(cache_file), candidates_(candidates), candidate_(candidate), num_evaluations_(num_evaluations)
+{
+}
+
+void
+WorksetSizeTuner::setMesh(std::vector<std::string> const& blocks, int const workset_size)
+{
+  blocks_       = blocks;
+  workset_size_ = workset_size;
+  for (auto const j : {0, 1}) {
+    time_[j].assign(blocks.size(), 0.0);
+    num_cells_[j].assign(blocks.size(), 0);
+  }
+}
+
+// The evaluations may run on a device, so the timer waits for them
+void
+WorksetSizeTuner::startWorkset()
+{
+  Kokkos::fence();
+  start_ = std::chrono::steady_clock::now();
+}
+
+void
+WorksetSizeTuner::stopWorkset(int const physics_set, int const num_cells, bool const jacobian)
+{
+  Kokkos::fence();
+  std::chrono::duration<ST> const elapsed = std::chrono::steady_clock::now() - start_;
+
+  time_[jacobian][physics_set] += elapsed.count();
+  num_cells_[jacobian][physics_set] += num_cells;
+}
+
+bool
+WorksetSizeTuner::endFill(bool const jacobian)
+{
+  ++num_fills_[jacobian];
+  if (num_fills_[0] < num_evaluations_ || num_fills_[1] < num_evaluations_) return false;
+  finish();
+  return true;
+}
+
+void
+WorksetSizeTuner::finish()
+{
+  Teuchos::FancyOStream& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  // The timing of this run: the slowest process, per element of every block
+  // and per residual and Jacobian fill of the mesh
+  Teuchos::ParameterList& timings = cache_.sublist("Timings");
+  Teuchos::ParameterList& timing  = timings.sublist(timingName(candidate_));
+  timing.set("Mesh Workset Size", workset_size_);
+
+  ST total_time{0.0};
+  for (auto ps = 0; ps < blocks_.size(); ++ps) {
+    ST time_per_element{0.0};
+    for (auto const j : {0, 1}) {
+      ST time{0.0};
+      GO num_cells{0};
+      Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MAX, time_[j][ps], Teuchos::outArg(time));
+      Teuchos::reduceAll(*comm_, Teuchos::REDUCE_SUM, num_cells_[j][ps], Teuchos::outArg(num_cells));
+      total_time += time / num_fills_[j];
+      if (num_cells > 0) time_per_element += time / num_cells;
+    }
+    timing.sublist("Element Blocks").sublist(blocks_[ps]).set("Time per Element", time_per_element);
+  }
+  timing.set("Time per Fill", total_time);
+
+  fos << "Workset Size Autotune: Workset Size " << candidate_ << ", " << std::scientific << std::setprecision(3) << total_time
+      << " s per residual and Jacobian fill\n";
+
+  int next{0};
+  for (int const candidate : candidates_) {
+    if (timings.isSublist(timingName(candidate)) == false) {
+      next = candidate;
+      break;
+    }
+  }
+
+  if (next > 0) {
+    fos << "Workset Size Autotune: the next run times Workset Size " << next << '\n';
+  } else {
+    // Every candidate is timed: the fastest one of every block, and the one
+    // with the smallest total time, as the workset size is the same for the
+    // whole mesh
+    Teuchos::ParameterList& blocks_params = cache_.sublist("Element Blocks");
+    for (std::string const& block : blocks_) {
+      int best = candidates_[0];
+      for (int const candidate : candidates_) {
+        auto const& block_timings = timings.sublist(timingName(candidate)).sublist("Element Blocks");
+        auto const& best_timings  = timings.sublist(timingName(best)).sublist("Element Blocks");
+        if (block_timings.sublist(block).get<ST>("Time per Element") < best_timings.sublist(block).get<ST>("Time per Element")) best = candidate;
+      }
+      ST const time = timings.sublist(timingName(best)).sublist("Element Blocks").sublist(block).get<ST>("Time per Element");
+
+      Teuchos::ParameterList& block_params = blocks_params.sublist(block);
+      block_params.set("Fastest Workset Size", best);
+      block_params.set("Time per Element", time);
+
+      fos << "Workset Size Autotune: block " << block << ", fastest Workset Size " << best << ", " << std::scientific << std::setprecision(3) << time
+          << " s per element and fill\n";
+    }
+
+    int chosen = candidates_[0];
+    for (int const candidate : candidates_) {
+      if (timings.sublist(timingName(candidate)).get<ST>("Time per Fill") < timings.sublist(timingName(chosen)).get<ST>("Time per Fill")) chosen = candidate;
+    }
+    cache_.set("Workset Size", chosen);
+    fos << "Workset Size Autotune: chose Workset Size " << chosen << ", written to " << cache_file_ << '\n';
+  }
+
+  if (comm_->getRank() == 0) Teuchos::writeParameterListToYamlFile(cache_, cache_file_);
+}
+
+void
+resolveWorksetSizeCacheFile(Teuchos::ParameterList& app_params, std::string const& input_file)
+{
+  Teuchos::ParameterList& disc_params = app_params.sublist("Discretization");
+  if (disc_params.isSublist("Workset Size Autotune") == false) return;
+
+  Teuchos::ParameterList& tune_params = disc_params.sublist("Workset Size Autotune");
+  std::string const       cache_file  = tune_params.get<std::string>("Cache File", getValidAutotuneParameters()->get<std::string>("Cache File"));
+  auto const              slash       = input_file.find_last_of('/');
+  if (cache_file.empty() == true || cache_file[0] == '/' || slash == std::string::npos) return;
+
+  tune_params.set("Cache File", input_file.substr(0, slash + 1) + cache_file);
+}
+
+Teuchos::RCP<WorksetSizeTuner>
+tuneWorksetSize(Teuchos::RCP<Teuchos::ParameterList> const& app_params, Teuchos::RCP<Teuchos_Comm const> const& comm)
+{
+  Teuchos::ParameterList& disc_params = app_params->sublist("Discretization");
+  if (disc_params.isSublist("Workset Size Autotune") == false) return Teuchos::null;
+
+  Teuchos::ParameterList& tune_params = disc_params.sublist("Workset Size Autotune");
+  tune_params.validateParametersAndSetDefaults(*getValidAutotuneParameters(), 0);
+
+  Teuchos::FancyOStream& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  Teuchos::Array<int> const candidates      = tune_params.get<Teuchos::Array<int>>("Candidate Workset Sizes");
+  int const                 num_evaluations = tune_params.get<int>("Number of Evaluations");
+  std::string const         cache_file      = tune_params.get<std::string>("Cache File");
+
+  ALBANY_ASSERT(candidates.empty() == false, "Workset Size Autotune: no Candidate Workset Sizes.\n");
+  ALBANY_ASSERT(num_evaluations >= 1, "Workset Size Autotune: Number of Evaluations must be positive.\n");
+  ALBANY_ASSERT(cache_file.empty() == false, "Workset Size Autotune: no Cache File.\n");
+  for (int const candidate : candidates) {
+    ALBANY_ASSERT(candidate >= 1, "Workset Size Autotune: candidate workset size " << candidate << " must be positive.\n");
+  }
+
+  Teuchos::ParameterList const fingerprint = getFingerprint(*app_params, comm, candidates);
+
+  // The choice, or the timings of the tuning in progress
+  Teuchos::ParameterList cache("Workset Size Autotune");
+  if (fileExists(cache_file, *comm) == true) {
+    Teuchos::ParameterList cached("Workset Size Autotune");
+    Teuchos::updateParametersFromYamlFileAndBroadcast(cache_file, Teuchos::ptrFromRef(cached), *comm);
+    bool const same = cached.isSublist("Fingerprint") == true && Teuchos::haveSameValues(cached.sublist("Fingerprint"), fingerprint) == true;
+    if (same == true && cached.isType<int>("Workset Size") == true) {
+      int const workset_size = cached.get<int>("Workset Size");
+      disc_params.set("Workset Size", workset_size);
+      fos << "Workset Size Autotune: Workset Size " << workset_size << " from " << cache_file << '\n';
+      return Teuchos::null;
+    }
+    if (same == true && cached.isSublist("Timings") == true) {
+      cache = cached;
+    } else {
+      fos << "Workset Size Autotune: " << cache_file << " is stale, tuning again\n";
+    }
+  }
+  cache.set("Fingerprint", fingerprint);
+
+  // The first candidate without a timing. All of them timed but no choice
+  // is stale as well.
+  int candidate{0};
+  for (auto c = 0; c < candidates.size() && candidate == 0; ++c) {
+    if (cache.sublist("Timings").isSublist(timingName(candidates[c])) == false) candidate = candidates[c];
+  }
+  if (candidate == 0) {
+    cache.remove("Timings");
+    candidate = candidates[0];
+  }
+
+  disc_params.set("Workset Size", candidate);
+  fos << "Workset Size Autotune: timing Workset Size " << candidate << '\n';
+
+  return Teuchos::rcp(new WorksetSizeTuner(comm, cache, cache_file, candidates, candidate, num_evaluations));
+}
+
+}  // namespace Albany
@@ -0,0 +1,110 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_WORKSET_SIZE_TUNER_HPP
+#define ALBANY_WORKSET_SIZE_TUNER_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Albany_CommTypes.hpp"
+#include "Albany_ScalarOrdinalTypes.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+/*! \brief Choose the workset size by timing the fills of the first runs.
+ *
+ *  Enabled by the sublist
+ *
+ *      Discretization:
+ *        Workset Size Autotune:
+ *          Candidate Workset Sizes: [16, 32, 64, 128, 256]
+ *          Number of Evaluations: 3
+ *          Cache File: workset_size.yaml
+ *
+ *  The worksets are the STK buckets, and their capacity is fixed when the
+ *  mesh is built, so an application cannot change its workset size. The
+ *  tuning is spread over runs instead: every run times one candidate, the
+ *  first one without a timing in the cache file, on its own application.
+ *  The workset evaluations of its first Number of Evaluations residual and
+ *  Jacobian fills are timed per element block, and the time is written to
+ *  the cache file. The run that times the last candidate reports the
+ *  fastest size of every block, and writes to the cache file the candidate
+ *  with the smallest total fill time, that later runs use.
+ *
+ *  The cache file also holds a fingerprint of the mesh, the number of
+ *  processes, the material models and the candidates. A cache file with
+ *  another fingerprint, or without a choice and timings, is stale and the
+ *  tuning starts again. A relative Cache File is relative to the directory
+ *  of the input file.
+ */
+class WorksetSizeTuner
+{
+ public:
+  WorksetSizeTuner(
+      Teuchos::RCP<Teuchos_Comm const> const& comm,
+      Teuchos::ParameterList const&           cache,
+      std::string const&                      cache_file,
+      Teuchos::Array<int> const&              candidates,
+      int const                               candidate,
+      int const                               num_evaluations);
+
+  //! The element block of every physics set and the workset size of the
+  //! mesh, set by the application
+  void
+  setMesh(std::vector<std::string> const& blocks, int const workset_size);
+
+  //! Time the evaluation of one workset
+  void
+  startWorkset();
+
+  void
+  stopWorkset(int const physics_set, int const num_cells, bool const jacobian);
+
+  //! Count a residual or Jacobian fill. Collective: after the last timed
+  //! fill, the timing is written to the cache file and true is returned,
+  //! and the application stops timing.
+  bool
+  endFill(bool const jacobian);
+
+ private:
+  void
+  finish();
+
+  Teuchos::RCP<Teuchos_Comm const> comm_;
+  Teuchos::ParameterList           cache_;
+  std::string                      cache_file_;
+  Teuchos::Array<int>              candidates_;
+  int                              candidate_{0};
+  int                              num_evaluations_{0};
+  int                              workset_size_{0};
+
+  std::vector<std::string> blocks_;
+
+  // Time and number of cells of the workset evaluations of every physics
+  // set, for the residual [0] and Jacobian [1] fills
+  std::vector<ST> time_[2];
+  std::vector<GO> num_cells_[2];
+  int             num_fills_[2]{0, 0};
+
+  std::chrono::steady_clock::time_point start_;
+};
+
+//! Make a relative Cache File of the Workset Size Autotune sublist relative
+//! to the directory of the input file
+void
+resolveWorksetSizeCacheFile(Teuchos::ParameterList& app_params, std::string const& input_file);
+
+//! Set "Workset Size" to the cached choice, or to the next candidate to
+//! time. Returns the tuner that times the fills of the application in the
+//! latter case, and null otherwise.
+Teuchos::RCP<WorksetSizeTuner>
+tuneWorksetSize(Teuchos::RCP<Teuchos::ParameterList> const& app_params, Teuchos::RCP<Teuchos_Comm const> const& comm);
+
+}  // namespace Albany
+
+#endif  // ALBANY_WORKSET_SIZE_TUNER_HPP
@@ -5,6 +5,7 @@
 #ifndef ACETHERMALPARAMETERS_HPP
 #define ACETHERMALPARAMETERS_HPP
 
+#include "ACEcommon.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "Albany_Types.hpp"
 #include "Albany_config.h"
@@ -40,10 +41,10 @@ class ACEThermalParameters : public PHX::EvaluatorWithBaseImpl<Traits>, public P
   createElementBlockParameterMaps();
 
   ScalarT
-  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType> map);
+  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType>& map);
 
   std::vector<RealType>
-  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>> map);
+  queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>>& map);
 
  private:
   //! Validate the name strings under "ACE Thermal Parameters" section in input
@@ -120,6 +121,21 @@ class ACEThermalParameters : public PHX::EvaluatorWithBaseImpl<Traits>, public P
   // The following is used to specify snow for ACI/NH
   std::map<std::string, std::vector<RealType>> air_from_file_map_;
 
+  //! Block-dependent tables built from the above. Time tables are evaluated
+  //! once per workset, depth tables are cached at the integration points.
+  std::map<std::string, InterpolationTable> sea_level_table_map_;
+  std::map<std::string, InterpolationTable> ocean_salinity_table_map_;
+  std::map<std::string, InterpolationTable> snow_depth_table_map_;
+  std::map<std::string, DepthTableCache>    depth_tables_map_;
+
+  int salinity_table_{0};
+  int porosity_table_{0};
+  int sand_table_{0};
+  int clay_table_{0};
+  int silt_table_{0};
+  int peat_table_{0};
+  int air_table_{0};
+
   //! Variables keeping track of whether cells are on erodible boundary
   bool                       have_cell_boundary_indicator_{false};
   Teuchos::ArrayRCP<double*> cell_boundary_indicator_;
@@ -158,20 +158,17 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
     ALBANY_ASSERT(cell_boundary_indicator_.is_null() == false);
   }
 
-  std::vector<RealType> const salinity_eb               = this->queryElementBlockParameterMap(eb_name, salinity_map_);
-  std::vector<RealType> const z_above_mean_sea_level_eb = this->queryElementBlockParameterMap(eb_name, z_above_mean_sea_level_map_);
-  std::vector<RealType> const time_eb                   = this->queryElementBlockParameterMap(eb_name, time_map_);
-  std::vector<RealType> const sea_level_eb              = this->queryElementBlockParameterMap(eb_name, sea_level_map_);
-
-  std::vector<RealType> porosity_from_file_eb = this->queryElementBlockParameterMap(eb_name, porosity_from_file_map_);
-  std::vector<RealType> ocean_salinity_eb     = this->queryElementBlockParameterMap(eb_name, ocean_salinity_map_);
-  std::vector<RealType> snow_depth_eb         = this->queryElementBlockParameterMap(eb_name, snow_depth_map_);
-  std::vector<RealType> sand_from_file_eb     = this->queryElementBlockParameterMap(eb_name, sand_from_file_map_);
-  std::vector<RealType> clay_from_file_eb     = this->queryElementBlockParameterMap(eb_name, clay_from_file_map_);
-  std::vector<RealType> silt_from_file_eb     = this->queryElementBlockParameterMap(eb_name, silt_from_file_map_);
-  std::vector<RealType> peat_from_file_eb     = this->queryElementBlockParameterMap(eb_name, peat_from_file_map_);
-  // The following is for specifying snow for ACI/NH
-  std::vector<RealType> air_from_file_eb = this->queryElementBlockParameterMap(eb_name, air_from_file_map_);
+  // Time-dependent values are the same for all points of the workset
+  InterpolationTable const& sea_level_table      = sea_level_table_map_[eb_name];
+  InterpolationTable const& ocean_salinity_table = ocean_salinity_table_map_[eb_name];
+  InterpolationTable const& snow_depth_table     = snow_depth_table_map_[eb_name];
+
+  RealType const sea_level_val      = sea_level_table.empty() == false ? sea_level_table(current_time) : -999.0;
+  RealType const ocean_salinity_val = ocean_salinity_table.empty() == false ? ocean_salinity_table(current_time) : 0.0;
+  RealType const snow_depth_val     = snow_depth_table.empty() == false ? snow_depth_table(current_time) : 0.0;
+
+  DepthTableCache& depth_tables = depth_tables_map_[eb_name];
+  int const        ws           = workset.wsIndex;
 
   ScalarT ice_density_eb         = this->queryElementBlockParameterMap(eb_name, ice_density_map_);
   ScalarT water_density_eb       = this->queryElementBlockParameterMap(eb_name, water_density_map_);
@@ -201,9 +198,11 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
     bool const   is_erodible = cell_bi == 2.0;
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
       RealType const height = Sacado::Value<ScalarT>::eval(coord_vec_(cell, qp, 2));
-      ScalarT        sal_eb = salinity_base_eb;
-      if (salinity_eb.size() > 0) {
-        sal_eb = interpolateVectors(z_above_mean_sea_level_eb, salinity_eb, height);
+      int const      point  = cell * num_qps_ + qp;
+      depth_tables.update(ws, point, height);
+      ScalarT sal_eb = salinity_base_eb;
+      if (depth_tables.hasTable(salinity_table_) == true) {
+        sal_eb = depth_tables.value(ws, point, salinity_table_);
       }
       // IKT 11/4/2022: if we are in the initial timestep, set bluff_salinity from sal_eb
       if (is_initial_timestep_ == true) {
@@ -213,8 +212,7 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       else {
         bluff_salinity_(cell, qp) = bluff_salinity_read_(cell, qp);
       }
-      const ScalarT sea_level = sea_level_eb.size() > 0 ? interpolateVectors(time_eb, sea_level_eb, current_time) : -999.0;
-      // const ScalarT sea_level = sea_level_eb.size() > 0 ? (interpolateVectors(time_eb, sea_level_eb, current_time) * 2.0) : -999.0;
+      const ScalarT sea_level = sea_level_val;
 
       // Thermal calculation
       // Calculate the depth-dependent porosity
@@ -222,8 +220,8 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       // needs
       //       to be done once, at the beginning of the simulation.
       ScalarT porosity_eb = porosity_bulk_eb;
-      if (porosity_from_file_eb.size() > 0) {
-        porosity_eb = interpolateVectors(z_above_mean_sea_level_eb, porosity_from_file_eb, height);
+      if (depth_tables.hasTable(porosity_table_) == true) {
+        porosity_eb = depth_tables.value(ws, point, porosity_table_);
       }
       porosity_(cell, qp) = porosity_eb;
 
@@ -231,8 +229,8 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       // TODO Jenn: use this field to incorporate snow into mixture model
       ScalarT snow_depth(0.0);
       bool    snow_given{false};
-      if (snow_depth_eb.size() > 0) {
-        snow_depth = interpolateVectors(time_eb, snow_depth_eb, current_time);
+      if (snow_depth_table.empty() == false) {
+        snow_depth = snow_depth_val;
         snow_given = true;
       }
       // std::cout << "IKT snow_depth = " << snow_depth << "\n";
@@ -244,8 +242,8 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
         // IKT, FIXME?: ocean_salinity is not block-dependent, so we may want to
         // make it just a std::vector, to avoid creating and querying a map.
         ScalarT const zero_sal(0.0);
-        if (ocean_salinity_eb.size() > 0) {
-          ocean_sal = interpolateVectors(time_eb, ocean_salinity_eb, current_time);
+        if (ocean_salinity_table.empty() == false) {
+          ocean_sal = ocean_salinity_val;
         }
         // --- elyce begin commenting out (8-26-24) ---- 
         // Note: below is being commented out because re: email thread with Jenn, it was decided to actually just take the ocean salinity at the bluff face
@@ -279,13 +277,13 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
 
       // Check if sediment fractions were provided
       bool sediment_given{false};
-      if ((sand_from_file_eb.size() > 0) && (clay_from_file_eb.size() > 0) && (silt_from_file_eb.size() > 0) && (peat_from_file_eb.size() > 0)) {
+      if (depth_tables.hasTable(sand_table_) && depth_tables.hasTable(clay_table_) && depth_tables.hasTable(silt_table_) && depth_tables.hasTable(peat_table_)) {
         sediment_given = true;
       }
 
       // Check if air fraction was provided
       bool air_given{false};
-      if (air_from_file_eb.size() > 0) {
+      if (depth_tables.hasTable(air_table_) == true) {
         air_given = true;
       }
       ScalarT  Tshift;
@@ -293,10 +291,10 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       RealType v = 0.1;
 
       if (sediment_given == true) {
-        auto sand_frac = interpolateVectors(z_above_mean_sea_level_eb, sand_from_file_eb, height);
-        auto clay_frac = interpolateVectors(z_above_mean_sea_level_eb, clay_from_file_eb, height);
-        auto silt_frac = interpolateVectors(z_above_mean_sea_level_eb, silt_from_file_eb, height);
-        auto peat_frac = interpolateVectors(z_above_mean_sea_level_eb, peat_from_file_eb, height);
+        auto sand_frac = depth_tables.value(ws, point, sand_table_);
+        auto clay_frac = depth_tables.value(ws, point, clay_table_);
+        auto silt_frac = depth_tables.value(ws, point, silt_table_);
+        auto peat_frac = depth_tables.value(ws, point, peat_table_);
         v              = (peat_frac * 0.1) + (sand_frac * 1.0) + (silt_frac * 15.0) + (clay_frac * 50.0);
         Tshift         = (peat_frac * 0.1) + (sand_frac * 0.3) + (silt_frac * 0.6) + (clay_frac * 1.0);
       } else {
@@ -306,7 +304,7 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       // IKT 2/17/2024: code to use air frac goes here for Jenn to fill in.
       // Might want to move elsewhere in this function...
       if (air_given == true) {
-        auto air_frac = interpolateVectors(z_above_mean_sea_level_eb, air_from_file_eb, height);
+        auto air_frac = depth_tables.value(ws, point, air_table_);
         // std::cout << "IKT air_frac = " << air_frac << "\n";
       }
 
@@ -370,10 +368,10 @@ ACEThermalParameters<EvalT, Traits>::evaluateFields(typename Traits::EvalData wo
       ScalarT calc_soil_thermal_cond;
       ScalarT calc_soil_density;
       if (sediment_given == true) {
-        ScalarT sand_frac = interpolateVectors(z_above_mean_sea_level_eb, sand_from_file_eb, height);
-        ScalarT clay_frac = interpolateVectors(z_above_mean_sea_level_eb, clay_from_file_eb, height);
-        ScalarT silt_frac = interpolateVectors(z_above_mean_sea_level_eb, silt_from_file_eb, height);
-        ScalarT peat_frac = interpolateVectors(z_above_mean_sea_level_eb, peat_from_file_eb, height);
+        ScalarT sand_frac = depth_tables.value(ws, point, sand_table_);
+        ScalarT clay_frac = depth_tables.value(ws, point, clay_table_);
+        ScalarT silt_frac = depth_tables.value(ws, point, silt_table_);
+        ScalarT peat_frac = depth_tables.value(ws, point, peat_table_);
 
         // THERMAL PROPERTIES OF ROCKS, E.C. Robertson, U.S. Geological Survey
         // Open-File Report 88-441 (1988).
@@ -657,13 +655,32 @@ ACEThermalParameters<EvalT, Traits>::createElementBlockParameterMaps()
         time_map_[eb_name].size() == sea_level_map_[eb_name].size(),
         "*** ERROR: Number of times and number of sea level values must "
         "match.");
+
+    auto const time_table = [&](std::vector<RealType> const& values) {
+      return values.size() > 0 ? InterpolationTable(time_map_[eb_name], values) : InterpolationTable();
+    };
+    sea_level_table_map_[eb_name]      = time_table(sea_level_map_[eb_name]);
+    ocean_salinity_table_map_[eb_name] = time_table(ocean_salinity_map_[eb_name]);
+    snow_depth_table_map_[eb_name]     = time_table(snow_depth_map_[eb_name]);
+
+    auto const depth_table = [&](std::vector<RealType> const& values) {
+      return values.size() > 0 ? InterpolationTable(z_above_mean_sea_level_map_[eb_name], values) : InterpolationTable();
+    };
+    auto& depth_tables = depth_tables_map_[eb_name];
+    salinity_table_    = depth_tables.addTable(depth_table(salinity_map_[eb_name]));
+    porosity_table_    = depth_tables.addTable(depth_table(porosity_from_file_map_[eb_name]));
+    sand_table_        = depth_tables.addTable(depth_table(sand_from_file_map_[eb_name]));
+    clay_table_        = depth_tables.addTable(depth_table(clay_from_file_map_[eb_name]));
+    silt_table_        = depth_tables.addTable(depth_table(silt_from_file_map_[eb_name]));
+    peat_table_        = depth_tables.addTable(depth_table(peat_from_file_map_[eb_name]));
+    air_table_         = depth_tables.addTable(depth_table(air_from_file_map_[eb_name]));
   }
 }
 
 // **********************************************************************
 template <typename EvalT, typename Traits>
 typename EvalT::ScalarT
-ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType> map)
+ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, RealType>& map)
 {
   typename std::map<std::string, RealType>::const_iterator it;
   it = map.find(eb_name);
@@ -676,7 +693,7 @@ ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string c
 
 template <typename EvalT, typename Traits>
 std::vector<RealType>
-ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>> map)
+ACEThermalParameters<EvalT, Traits>::queryElementBlockParameterMap(std::string const eb_name, const std::map<std::string, std::vector<RealType>>& map)
 {
   typename std::map<std::string, std::vector<RealType>>::const_iterator it;
   it = map.find(eb_name);
@@ -0,0 +1,10 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "HMC_CondensedMicroStrain.hpp"
+
+#include "HMC_CondensedMicroStrain_Def.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(HMC::CondensedMicroStrain)
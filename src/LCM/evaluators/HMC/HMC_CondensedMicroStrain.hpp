@@ -0,0 +1,111 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(HMC_CondensedMicroStrain_hpp)
+#define HMC_CondensedMicroStrain_hpp
+
+#include "Albany_Layouts.hpp"
+#include "NOX_StatusTest_ModelEvaluatorFlag.hpp"
+#include "PHAL_Dimension.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Phalanx_config.hpp"
+
+namespace HMC {
+///
+/// Element-level static condensation of one micro scale.
+///
+/// The microstrain increment is treated as an element-interior
+/// (discontinuous) nodal field and eliminated element by element from the
+/// micro balance of HMC::MicroResidual,
+///
+///   R_I = sum_qp wBF_I ms + wGradBF_I . ds = 0,
+///
+/// with the linear micro response ms = beta C : (strain - microstrain) and
+/// ds = l^2 beta C : grad(microstrain). The elastic tensor and beta cancel
+/// out, so the element system reduces to
+///
+///   (l^2 L - M) De = -G(strain),
+///
+/// with L and M the element stiffness and mass matrices. The matrix
+/// depends only on the geometry, which HMC does not adapt: it is inverted
+/// in RealType once per element, at the first fill, and applied to the
+/// ScalarT right hand side, so the derivatives of the condensed microstrain
+/// with respect to the displacement DOFs are exact and the macro Jacobian
+/// is the Schur complement. The recovered increment is interpolated to the integration
+/// points in place of the gathered micro DOFs. Micro inertia is not
+/// included. A singular element matrix fails the step through the NOX
+/// Status Test.
+///
+template <typename EvalT, typename Traits>
+class CondensedMicroStrain : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
+{
+ public:
+  ///
+  /// Constructor
+  ///
+  CondensedMicroStrain(Teuchos::ParameterList const& p, const Teuchos::RCP<Albany::Layouts>& dl);
+
+  ///
+  /// Phalanx method to allocate space
+  ///
+  void
+  postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm);
+
+  ///
+  /// Implementation of physics
+  ///
+  void
+  evaluateFields(typename Traits::EvalData d);
+
+ private:
+  using ScalarT     = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+
+  ///
+  /// Input: updated macro strain and basis functions
+  ///
+  PHX::MDField<ScalarT const, Cell, QuadPoint, Dim, Dim>      macroStrain;
+  PHX::MDField<const RealType, Cell, Node, QuadPoint>         BF;
+  PHX::MDField<const MeshScalarT, Cell, Node, QuadPoint>      wBF;
+  PHX::MDField<const MeshScalarT, Cell, Node, QuadPoint, Dim> GradBF;
+  PHX::MDField<const MeshScalarT, Cell, Node, QuadPoint, Dim> wGradBF;
+
+  ///
+  /// Output: microstrain increment and its gradient at the integration points
+  ///
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim>      microStrainIncrement;
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim, Dim> microStrainGradientIncrement;
+
+  ///
+  /// State names of the converged microstrain and its gradient
+  ///
+  std::string microStrainName;
+  std::string microStrainGradientName;
+
+  ///
+  /// Length scale of this micro scale
+  ///
+  RealType lengthScale;
+
+  ///
+  /// Inverse element matrices and their reciprocal condition numbers, per
+  /// workset
+  ///
+  std::vector<std::vector<RealType>> elementInverses;
+  std::vector<std::vector<RealType>> elementRconds;
+
+  ///
+  /// Fails the step on a singular micro balance
+  ///
+  Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> nox_status_test_;
+
+  unsigned int numNodes;
+  unsigned int numQPs;
+  unsigned int numDims;
+};
+}  // namespace HMC
+
+#endif
@@ -0,0 +1,182 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <MiniTensor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "Albany_Macros.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace HMC {
+
+template <typename EvalT, typename Traits>
+CondensedMicroStrain<EvalT, Traits>::CondensedMicroStrain(Teuchos::ParameterList const& p, const Teuchos::RCP<Albany::Layouts>& dl)
+    : macroStrain(p.get<std::string>("Macro Strain Name"), dl->qp_tensor),
+      BF(p.get<std::string>("BF Name"), dl->node_qp_scalar),
+      wBF(p.get<std::string>("Weighted BF Name"), dl->node_qp_scalar),
+      GradBF(p.get<std::string>("Gradient BF Name"), dl->node_qp_vector),
+      wGradBF(p.get<std::string>("Weighted Gradient BF Name"), dl->node_qp_vector),
+      microStrainIncrement(p.get<std::string>("Micro Strain Increment Name"), dl->qp_tensor),
+      microStrainGradientIncrement(p.get<std::string>("Micro Strain Gradient Increment Name"), dl->qp_tensor3),
+      microStrainName(p.get<std::string>("Micro Strain Name")),
+      microStrainGradientName(p.get<std::string>("Micro Strain Gradient Name")),
+      lengthScale(p.get<RealType>("Length Scale"))
+{
+  if (p.isParameter("NOX Status Test")) { nox_status_test_ = p.get<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>("NOX Status Test"); }
+
+  this->addDependentField(macroStrain);
+  this->addDependentField(BF);
+  this->addDependentField(wBF);
+  this->addDependentField(GradBF);
+  this->addDependentField(wGradBF);
+
+  this->addEvaluatedField(microStrainIncrement);
+  this->addEvaluatedField(microStrainGradientIncrement);
+
+  this->setName("CondensedMicroStrain " + microStrainName + PHX::print<EvalT>());
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  dl->node_qp_vector->dimensions(dims);
+  numNodes = dims[1];
+  numQPs   = dims[2];
+  numDims  = dims[3];
+}
+
+template <typename EvalT, typename Traits>
+void
+CondensedMicroStrain<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(macroStrain, fm);
+  this->utils.setFieldData(BF, fm);
+  this->utils.setFieldData(wBF, fm);
+  this->utils.setFieldData(GradBF, fm);
+  this->utils.setFieldData(wGradBF, fm);
+  this->utils.setFieldData(microStrainIncrement, fm);
+  this->utils.setFieldData(microStrainGradientIncrement, fm);
+}
+
+template <typename EvalT, typename Traits>
+void
+CondensedMicroStrain<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Albany::StateArray::const_iterator it = workset.stateArrayPtr->find(microStrainName);
+  ALBANY_PANIC(it == workset.stateArrayPtr->end(), "Error: cannot locate " << microStrainName << " in CondensedMicroStrain");
+  Albany::MDArray const microStrain_N = it->second;
+
+  it = workset.stateArrayPtr->find(microStrainGradientName);
+  ALBANY_PANIC(it == workset.stateArrayPtr->end(), "Error: cannot locate " << microStrainGradientName << " in CondensedMicroStrain");
+  Albany::MDArray const microStrainGradient_N = it->second;
+
+  RealType const    l2          = lengthScale * lengthScale;
+  std::size_t const numNodes2   = numNodes * numNodes;
+  std::size_t const numWorksets = std::max<std::size_t>(elementInverses.size(), workset.wsIndex + 1);
+  elementInverses.resize(numWorksets);
+  elementRconds.resize(numWorksets);
+
+  // The element matrices depend only on the geometry: invert them at the
+  // first fill of the workset.
+  std::vector<RealType>& inverses = elementInverses[workset.wsIndex];
+  std::vector<RealType>& rconds   = elementRconds[workset.wsIndex];
+  if (rconds.size() != workset.numCells) {
+    inverses.resize(workset.numCells * numNodes2);
+    rconds.resize(workset.numCells);
+
+    minitensor::Tensor<RealType> A(numNodes);
+    minitensor::Tensor<RealType> Ainv(numNodes);
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+      // Element matrix (l^2 L - M), in RealType. It is indefinite, and
+      // singular when 1 / l^2 is a generalized eigenvalue of (L, M), that
+      // is for elements of a size comparable to the length scale.
+      for (std::size_t I = 0; I < numNodes; ++I) {
+        for (std::size_t J = 0; J < numNodes; ++J) {
+          RealType a = 0.0;
+          for (std::size_t qp = 0; qp < numQPs; ++qp) {
+            a -= Sacado::ScalarValue<MeshScalarT>::eval(wBF(cell, I, qp)) * BF(cell, J, qp);
+            for (std::size_t k = 0; k < numDims; ++k)
+              a += l2 * Sacado::ScalarValue<MeshScalarT>::eval(wGradBF(cell, I, qp, k)) * Sacado::ScalarValue<MeshScalarT>::eval(GradBF(cell, J, qp, k));
+          }
+          A(I, J) = a;
+        }
+      }
+      Ainv         = minitensor::inverse(A);
+      rconds[cell] = 1.0 / (minitensor::norm_1(A) * minitensor::norm_1(Ainv));
+      for (std::size_t I = 0; I < numNodes; ++I)
+        for (std::size_t J = 0; J < numNodes; ++J) inverses[cell * numNodes2 + I * numNodes + J] = Ainv(I, J);
+    }
+  }
+
+  // Right hand side and solution, one tensor per element node.
+  std::vector<ScalarT> G(numNodes * numDims * numDims);
+  std::vector<ScalarT> De(numNodes * numDims * numDims);
+
+  // Smallest reciprocal condition number accepted for (l^2 L - M)
+  RealType const min_rcond = 1.0e-10;
+
+  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+    // A singular micro balance fails the step. The matrix does not depend
+    // on the step, so a step cut does not recover: the mesh must be refined
+    // or the micro scales not condensed.
+    if (std::isfinite(rconds[cell]) == false || rconds[cell] < min_rcond) {
+      std::ostringstream msg;
+      msg << "Singular micro balance of " << microStrainName << " in cell " << cell << " of workset " << workset.wsIndex << ", reciprocal condition number "
+          << rconds[cell] << ". The length scale " << lengthScale << " is comparable to the element size: refine the mesh or do not condense.";
+      ALBANY_PANIC(nox_status_test_.is_null() == true, "Error in CondensedMicroStrain: " << msg.str() << "\n");
+      nox_status_test_->status_         = NOX::StatusTest::Failed;
+      nox_status_test_->status_message_ = msg.str();
+      for (std::size_t qp = 0; qp < numQPs; ++qp) {
+        for (std::size_t i = 0; i < numDims; ++i) {
+          for (std::size_t j = 0; j < numDims; ++j) {
+            microStrainIncrement(cell, qp, i, j) = 0.0;
+            for (std::size_t k = 0; k < numDims; ++k) microStrainGradientIncrement(cell, qp, i, j, k) = 0.0;
+          }
+        }
+      }
+      continue;
+    }
+    RealType const* const Ainv = &inverses[cell * numNodes2];
+
+    // Micro residual at zero increment, G_I.
+    for (std::size_t I = 0; I < numNodes; ++I) {
+      for (std::size_t i = 0; i < numDims; ++i) {
+        for (std::size_t j = 0; j < numDims; ++j) {
+          ScalarT g = 0.0;
+          for (std::size_t qp = 0; qp < numQPs; ++qp) {
+            g += wBF(cell, I, qp) * (macroStrain(cell, qp, i, j) - microStrain_N(cell, qp, i, j));
+            for (std::size_t k = 0; k < numDims; ++k) g += l2 * wGradBF(cell, I, qp, k) * microStrainGradient_N(cell, qp, i, j, k);
+          }
+          G[(I * numDims + i) * numDims + j] = g;
+        }
+      }
+    }
+
+    // De_I = -Ainv_IJ G_J
+    for (std::size_t I = 0; I < numNodes; ++I) {
+      for (std::size_t ij = 0; ij < numDims * numDims; ++ij) {
+        ScalarT de = 0.0;
+        for (std::size_t J = 0; J < numNodes; ++J) de -= Ainv[I * numNodes + J] * G[J * numDims * numDims + ij];
+        De[I * numDims * numDims + ij] = de;
+      }
+    }
+
+    // Recover the increment and its gradient at the integration points.
+    for (std::size_t qp = 0; qp < numQPs; ++qp) {
+      for (std::size_t i = 0; i < numDims; ++i) {
+        for (std::size_t j = 0; j < numDims; ++j) {
+          ScalarT de = 0.0;
+          for (std::size_t I = 0; I < numNodes; ++I) de += BF(cell, I, qp) * De[(I * numDims + i) * numDims + j];
+          microStrainIncrement(cell, qp, i, j) = de;
+          for (std::size_t k = 0; k < numDims; ++k) {
+            ScalarT dg = 0.0;
+            for (std::size_t I = 0; I < numNodes; ++I) dg += GradBF(cell, I, qp, k) * De[(I * numDims + i) * numDims + j];
+            microStrainGradientIncrement(cell, qp, i, j, k) = dg;
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace HMC
@@ -402,15 +402,15 @@ fillResidual(SchwarzBC& sbc, typename Traits::EvalData workset)
     auto const z_dof = ns_dof[ns_node][2];
     auto const dof   = x_dof / 3;
 
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       f_view[x_dof] = x_const_view[x_dof] - schwarz_bcs_const_view_x[dof];
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       f_view[y_dof] = x_const_view[y_dof] - schwarz_bcs_const_view_y[dof];
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       f_view[z_dof] = x_const_view[z_dof] - schwarz_bcs_const_view_z[dof];
     }
   }
@@ -418,18 +418,18 @@ fillResidual(SchwarzBC& sbc, typename Traits::EvalData workset)
   for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
     ST x_val, y_val, z_val;
     sbc.computeBCs(ns_node, x_val, y_val, z_val);
-    auto const           x_dof      = ns_dof[ns_node][0];
-    auto const           y_dof      = ns_dof[ns_node][1];
-    auto const           z_dof      = ns_dof[ns_node][2];
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const  x_dof      = ns_dof[ns_node][0];
+    auto const  y_dof      = ns_dof[ns_node][1];
+    auto const  z_dof      = ns_dof[ns_node][2];
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       f_view[x_dof] = x_const_view[x_dof] - x_val;
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       f_view[y_dof] = x_const_view[y_dof] - y_val;
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       f_view[z_dof] = x_const_view[z_dof] - z_val;
     }
 
@@ -492,9 +492,9 @@ SchwarzBC<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
     auto const y_dof = ns_nodes[ns_node][1];
     auto const z_dof = ns_nodes[ns_node][2];
 
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       // replace jac values for the X dof
       Albany::getLocalRowValues(jac, x_dof, matrixIndices, matrixEntries);
       for (auto& val : matrixEntries) {
@@ -505,7 +505,7 @@ SchwarzBC<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
       Albany::setLocalRowValues(jac, x_dof, index(), value());
     }
 
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       // replace jac values for the y dof
       Albany::getLocalRowValues(jac, y_dof, matrixIndices, matrixEntries);
       for (auto& val : matrixEntries) {
@@ -516,7 +516,7 @@ SchwarzBC<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename Traits:
       Albany::setLocalRowValues(jac, y_dof, index(), value());
     }
 
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       // replace jac values for the z dof
       Albany::getLocalRowValues(jac, z_dof, matrixIndices, matrixEntries);
       for (auto& val : matrixEntries) {
@@ -493,9 +493,9 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
     auto const z_dof = ns_nodes[ns_node][2];
     auto const dof   = x_dof / 3;
 
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       disp_view[x_dof] = bcs_disp_const_view_x[dof];
       if (has_velo) {
         velo_view[x_dof] = bcs_velo_const_view_x[dof];
@@ -504,7 +504,7 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
         acce_view[x_dof] = bcs_acce_const_view_x[dof];
       }
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       disp_view[y_dof] = bcs_disp_const_view_y[dof];
       if (has_velo) {
         velo_view[y_dof] = bcs_velo_const_view_y[dof];
@@ -513,7 +513,7 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
         acce_view[y_dof] = bcs_acce_const_view_y[dof];
       }
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       disp_view[z_dof] = bcs_disp_const_view_z[dof];
       if (has_velo) {
         velo_view[z_dof] = bcs_velo_const_view_z[dof];
@@ -527,18 +527,18 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
   for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
     ST x_val, y_val, z_val;
     sbc.computeBCs(ns_node, x_val, y_val, z_val);
-    auto const           x_dof      = ns_nodes[ns_node][0];
-    auto const           y_dof      = ns_nodes[ns_node][1];
-    auto const           z_dof      = ns_nodes[ns_node][2];
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const  x_dof      = ns_nodes[ns_node][0];
+    auto const  y_dof      = ns_nodes[ns_node][1];
+    auto const  z_dof      = ns_nodes[ns_node][2];
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       disp_view[x_dof] = x_val;
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       disp_view[y_dof] = y_val;
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       disp_view[z_dof] = z_val;
     }
 
@@ -564,15 +564,15 @@ fillResidual(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
     auto const y_dof = ns_nodes[ns_node][1];
     auto const z_dof = ns_nodes[ns_node][2];
 
-    std::set<int> const& fixed_dofs = workset.fixed_dofs_;
+    auto const& fixed_dofs = workset.fixed_dofs_;
 
-    if (fixed_dofs.find(x_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(x_dof) == false) {
       f_view[x_dof] = 0.0;
     }
-    if (fixed_dofs.find(y_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(y_dof) == false) {
       f_view[y_dof] = 0.0;
     }
-    if (fixed_dofs.find(z_dof) == fixed_dofs.end()) {
+    if (fixed_dofs.contains(z_dof) == false) {
       f_view[z_dof] = 0.0;
     }
   }
@@ -0,0 +1,196 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_FusedMechanicsResidual_hpp)
+#define LCM_FusedMechanicsResidual_hpp
+
+#include <MiniTensor.h>
+
+#include <Phalanx_Evaluator_Derived.hpp>
+#include <Phalanx_Evaluator_WithBaseImpl.hpp>
+#include <Phalanx_MDField.hpp>
+#include <Phalanx_config.hpp>
+
+#include "Albany_Layouts.hpp"
+#include "Albany_StateInfoStruct.hpp"
+
+namespace LCM {
+///
+/// \brief Fused Mechanics Residual
+///
+/// This evaluator computes the balance of linear momentum residual
+/// for 3D bulk elements in a single kernel per cell: kinematics,
+/// constitutive update, first PK stress and integration against the
+/// weighted basis function gradients. The first PK stress is never
+/// stored; only the fields that are saved as state variables are
+/// written. Supported models are Linear Elastic, Neohookean and J2
+/// without temperature. MechanicsProblem falls back to the chain
+/// Kinematics -> ConstitutiveModelInterface -> FirstPK ->
+/// MechanicsResidual for anything else.
+///
+template <typename EvalT, typename Traits>
+class FusedMechanicsResidual : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
+{
+ public:
+  using ScalarT     = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+  using Tensor      = minitensor::Tensor<ScalarT, 3>;
+
+  enum class Model
+  {
+    LINEAR_ELASTIC,
+    NEOHOOKEAN,
+    J2
+  };
+
+  ///
+  /// Constructor
+  ///
+  FusedMechanicsResidual(Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl);
+
+  ///
+  /// Phalanx method to allocate space
+  ///
+  void
+  postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm);
+
+  ///
+  /// Implementation of physics
+  ///
+  void
+  evaluateFields(typename Traits::EvalData d);
+
+  ///
+  /// True if the named material model has a fused implementation
+  ///
+  static bool
+  isSupportedModel(std::string const& model_name);
+
+ private:
+  ///
+  /// Input: Displacement Gradient
+  ///
+  PHX::MDField<ScalarT const, Cell, QuadPoint, Dim, Dim> grad_u_;
+
+  ///
+  /// Input: Weighted Basis Function Gradients
+  ///
+  PHX::MDField<const MeshScalarT, Cell, Node, QuadPoint, Dim> w_grad_bf_;
+
+  ///
+  /// Input: Weighted Basis Functions
+  ///
+  PHX::MDField<const MeshScalarT, Cell, Node, QuadPoint> w_bf_;
+
+  ///
+  /// Input: Acceleration
+  ///
+  PHX::MDField<ScalarT const, Cell, QuadPoint, Dim> acceleration_;
+
+  ///
+  /// Input: Material parameters
+  ///
+  PHX::MDField<ScalarT const, Cell, QuadPoint> elastic_modulus_;
+  PHX::MDField<ScalarT const, Cell, QuadPoint> poissons_ratio_;
+  PHX::MDField<ScalarT const, Cell, QuadPoint> yield_strength_;
+  PHX::MDField<ScalarT const, Cell, QuadPoint> hardening_modulus_;
+
+  ///
+  /// Output: Residual Forces
+  ///
+  PHX::MDField<ScalarT, Cell, Node, Dim> residual_;
+
+  ///
+  /// Output: Deformation Gradient, its determinant and the Cauchy stress,
+  /// needed as state variables
+  ///
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> def_grad_;
+  PHX::MDField<ScalarT, Cell, QuadPoint>           j_;
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> stress_;
+
+  ///
+  /// Optional
+  /// Output: Small strain (Linear Elastic)
+  ///
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> strain_;
+
+  ///
+  /// Output: J2 state variables
+  ///
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> fp_;
+  PHX::MDField<ScalarT, Cell, QuadPoint>           eqps_;
+  PHX::MDField<ScalarT, Cell, QuadPoint>           yield_surf_;
+
+  ///
+  /// J2 old state, set for each workset
+  ///
+  Albany::MDArray fp_old_;
+  Albany::MDArray eqps_old_;
+
+  std::string fp_name_;
+  std::string eqps_name_;
+
+  Model model_;
+
+  int num_nodes_;
+  int num_pts_;
+  int num_dims_;
+
+  RealType density_;
+  RealType sat_mod_;
+  RealType sat_exp_;
+
+  bool needs_strain_;
+
+  ///
+  /// Inertia term enabled for the current workset
+  ///
+  bool have_dynamics_;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  kinematics(int cell, int pt, Tensor& F, ScalarT& J) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  integrate(int cell, int pt, Tensor const& P) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  clearResidual(int cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  addInertia(int cell) const;
+
+ public:  // Kokkos
+  struct linear_elastic_Tag
+  {
+  };
+  struct neohookean_Tag
+  {
+  };
+  struct j2_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, linear_elastic_Tag> linear_elastic_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, neohookean_Tag>     neohookean_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, j2_Tag>             j2_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const linear_elastic_Tag& tag, int const& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const neohookean_Tag& tag, int const& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const j2_Tag& tag, int const& cell) const;
+};
+}  // namespace LCM
+
+#endif
@@ -0,0 +1,405 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <MiniTensor.h>
+
+#include <Phalanx_DataLayout.hpp>
+
+#include "Albany_Macros.hpp"
+#if defined(ALBANY_TIMER)
+#include <chrono>
+#endif
+
+namespace LCM {
+
+template <typename EvalT, typename Traits>
+bool
+FusedMechanicsResidual<EvalT, Traits>::isSupportedModel(std::string const& model_name)
+{
+  return model_name == "Linear Elastic" || model_name == "Neohookean" || model_name == "J2";
+}
+
+template <typename EvalT, typename Traits>
+FusedMechanicsResidual<EvalT, Traits>::FusedMechanicsResidual(Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
+    : grad_u_(p.get<std::string>("Gradient QP Variable Name"), dl->qp_tensor),
+      w_grad_bf_(p.get<std::string>("Weighted Gradient BF Name"), dl->node_qp_vector),
+      w_bf_(p.get<std::string>("Weighted BF Name"), dl->node_qp_scalar),
+      acceleration_(p.get<std::string>("Acceleration Name"), dl->qp_vector),
+      elastic_modulus_("Elastic Modulus", dl->qp_scalar),
+      poissons_ratio_("Poissons Ratio", dl->qp_scalar),
+      residual_(p.get<std::string>("Residual Name"), dl->node_vector),
+      def_grad_(p.get<std::string>("DefGrad Name"), dl->qp_tensor),
+      j_(p.get<std::string>("DetDefGrad Name"), dl->qp_scalar),
+      stress_(p.get<std::string>("Stress Name"), dl->qp_tensor),
+      density_(p.get<RealType>("Density", 1.0)),
+      sat_mod_(p.get<RealType>("Saturation Modulus", 0.0)),
+      sat_exp_(p.get<RealType>("Saturation Exponent", 0.0)),
+      needs_strain_(false),
+      have_dynamics_(false)
+{
+  std::string const model_name = p.get<std::string>("Model Name");
+  ALBANY_PANIC(!isSupportedModel(model_name), "Error: FusedMechanicsResidual does not support material model " << model_name << std::endl);
+
+  if (model_name == "Linear Elastic") {
+    model_ = Model::LINEAR_ELASTIC;
+  } else if (model_name == "Neohookean") {
+    model_ = Model::NEOHOOKEAN;
+  } else {
+    model_ = Model::J2;
+  }
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  w_grad_bf_.fieldTag().dataLayout().dimensions(dims);
+  num_nodes_ = dims[1];
+  num_pts_   = dims[2];
+  num_dims_  = dims[3];
+
+  ALBANY_PANIC(num_dims_ != 3, "Error: FusedMechanicsResidual is implemented for 3D only" << std::endl);
+
+  this->addDependentField(grad_u_);
+  this->addDependentField(w_grad_bf_);
+  this->addDependentField(w_bf_);
+  this->addDependentField(acceleration_);
+  this->addDependentField(elastic_modulus_);
+  this->addDependentField(poissons_ratio_);
+
+  this->addEvaluatedField(residual_);
+  this->addEvaluatedField(def_grad_);
+  this->addEvaluatedField(j_);
+  this->addEvaluatedField(stress_);
+
+  if (p.isType<std::string>("Strain Name")) {
+    needs_strain_ = true;
+    strain_       = decltype(strain_)(p.get<std::string>("Strain Name"), dl->qp_tensor);
+    this->addEvaluatedField(strain_);
+  }
+
+  if (model_ == Model::J2) {
+    yield_strength_    = decltype(yield_strength_)("Yield Strength", dl->qp_scalar);
+    hardening_modulus_ = decltype(hardening_modulus_)("Hardening Modulus", dl->qp_scalar);
+    this->addDependentField(yield_strength_);
+    this->addDependentField(hardening_modulus_);
+
+    fp_name_   = p.get<std::string>("Fp Name");
+    eqps_name_ = p.get<std::string>("Eqps Name");
+
+    fp_         = decltype(fp_)(fp_name_, dl->qp_tensor);
+    eqps_       = decltype(eqps_)(eqps_name_, dl->qp_scalar);
+    yield_surf_ = decltype(yield_surf_)(p.get<std::string>("Yield Surface Name"), dl->qp_scalar);
+    this->addEvaluatedField(fp_);
+    this->addEvaluatedField(eqps_);
+    this->addEvaluatedField(yield_surf_);
+  }
+
+  this->setName("FusedMechanicsResidual" + PHX::print<EvalT>());
+}
+
+template <typename EvalT, typename Traits>
+void
+FusedMechanicsResidual<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(grad_u_, fm);
+  this->utils.setFieldData(w_grad_bf_, fm);
+  this->utils.setFieldData(w_bf_, fm);
+  this->utils.setFieldData(acceleration_, fm);
+  this->utils.setFieldData(elastic_modulus_, fm);
+  this->utils.setFieldData(poissons_ratio_, fm);
+  this->utils.setFieldData(residual_, fm);
+  this->utils.setFieldData(def_grad_, fm);
+  this->utils.setFieldData(j_, fm);
+  this->utils.setFieldData(stress_, fm);
+  if (needs_strain_) this->utils.setFieldData(strain_, fm);
+  if (model_ == Model::J2) {
+    this->utils.setFieldData(yield_strength_, fm);
+    this->utils.setFieldData(hardening_modulus_, fm);
+    this->utils.setFieldData(fp_, fm);
+    this->utils.setFieldData(eqps_, fm);
+    this->utils.setFieldData(yield_surf_, fm);
+  }
+}
+
+// ***************************************************************************
+// Kokkos kernels
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::kinematics(int cell, int pt, Tensor& F, ScalarT& J) const
+{
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      F(i, j) = grad_u_(cell, pt, i, j);
+    }
+    F(i, i) += 1.0;
+  }
+  J = minitensor::det(F);
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      def_grad_(cell, pt, i, j) = F(i, j);
+    }
+  }
+  j_(cell, pt) = J;
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::integrate(int cell, int pt, Tensor const& P) const
+{
+  for (int node = 0; node < num_nodes_; ++node) {
+    for (int i = 0; i < 3; ++i) {
+      ScalarT r(0.0);
+      for (int j = 0; j < 3; ++j) {
+        r += P(i, j) * w_grad_bf_(cell, node, pt, j);
+      }
+      residual_(cell, node, i) += r;
+    }
+  }
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::clearResidual(int cell) const
+{
+  for (int node = 0; node < num_nodes_; ++node) {
+    for (int i = 0; i < 3; ++i) {
+      residual_(cell, node, i) = ScalarT(0.0);
+    }
+  }
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::addInertia(int cell) const
+{
+  for (int node = 0; node < num_nodes_; ++node) {
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      for (int i = 0; i < 3; ++i) {
+        residual_(cell, node, i) += density_ * acceleration_(cell, pt, i) * w_bf_(cell, node, pt);
+      }
+    }
+  }
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::operator()(const linear_elastic_Tag& tag, int const& cell) const
+{
+  Tensor const I(minitensor::eye<ScalarT, 3>(num_dims_));
+  Tensor       F(num_dims_), eps(num_dims_), sigma(num_dims_);
+  ScalarT      J;
+
+  clearResidual(cell);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    kinematics(cell, pt, F, J);
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        eps(i, j) = 0.5 * (grad_u_(cell, pt, i, j) + grad_u_(cell, pt, j, i));
+      }
+    }
+
+    ScalarT const& E      = elastic_modulus_(cell, pt);
+    ScalarT const& nu     = poissons_ratio_(cell, pt);
+    ScalarT const  lambda = (E * nu) / ((1.0 + nu) * (1.0 - 2.0 * nu));
+    ScalarT const  mu     = E / (2.0 * (1.0 + nu));
+
+    sigma = 2.0 * mu * eps + lambda * minitensor::trace(eps) * I;
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        stress_(cell, pt, i, j) = sigma(i, j);
+        if (needs_strain_) strain_(cell, pt, i, j) = eps(i, j);
+      }
+    }
+
+    // Small strain: the first PK stress is the Cauchy stress.
+    integrate(cell, pt, sigma);
+  }
+  if (have_dynamics_) addInertia(cell);
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::operator()(const neohookean_Tag& tag, int const& cell) const
+{
+  Tensor const I(minitensor::eye<ScalarT, 3>(num_dims_));
+  Tensor       F(num_dims_), b(num_dims_), sigma(num_dims_), P(num_dims_);
+  ScalarT      J;
+
+  clearResidual(cell);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    kinematics(cell, pt, F, J);
+
+    ScalarT const& E     = elastic_modulus_(cell, pt);
+    ScalarT const& nu    = poissons_ratio_(cell, pt);
+    ScalarT const  kappa = E / (3.0 * (1.0 - 2.0 * nu));
+    ScalarT const  mu    = E / (2.0 * (1.0 + nu));
+    ScalarT const  Jm13  = 1.0 / std::cbrt(J);
+    ScalarT const  Jm23  = Jm13 * Jm13;
+    ScalarT const  Jm53  = Jm23 * Jm23 * Jm13;
+
+    b     = F * minitensor::transpose(F);
+    sigma = 0.5 * kappa * (J - 1.0 / J) * I + mu * Jm53 * minitensor::dev(b);
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        stress_(cell, pt, i, j) = sigma(i, j);
+      }
+    }
+
+    // P = J sigma F^{-T}
+    P = J * sigma * minitensor::transpose(minitensor::inverse(F));
+    integrate(cell, pt, P);
+  }
+  if (have_dynamics_) addInertia(cell);
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+FusedMechanicsResidual<EvalT, Traits>::operator()(const j2_Tag& tag, int const& cell) const
+{
+  RealType const sq23 = std::sqrt(2.0 / 3.0);
+  int const      num_max_iter{30};
+
+  Tensor const I(minitensor::eye<ScalarT, 3>(num_dims_));
+  Tensor       F(num_dims_), Fpn(num_dims_), Fpinv(num_dims_), Cpinv(num_dims_), be(num_dims_), s(num_dims_);
+  Tensor       N(num_dims_), Fpnew(num_dims_), sigma(num_dims_), P(num_dims_);
+  ScalarT      J;
+
+  clearResidual(cell);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    kinematics(cell, pt, F, J);
+
+    ScalarT const& E     = elastic_modulus_(cell, pt);
+    ScalarT const& nu    = poissons_ratio_(cell, pt);
+    ScalarT const& K     = hardening_modulus_(cell, pt);
+    ScalarT const& Y     = yield_strength_(cell, pt);
+    ScalarT const  kappa = E / (3.0 * (1.0 - 2.0 * nu));
+    ScalarT const  mu    = E / (2.0 * (1.0 + nu));
+    ScalarT const  Jm23  = std::pow(J, -2.0 / 3.0);
+
+    RealType const eqps_n = eqps_old_(cell, pt);
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        Fpn(i, j) = ScalarT(fp_old_(cell, pt, i, j));
+      }
+    }
+
+    // trial state
+    Fpinv = minitensor::inverse(Fpn);
+    Cpinv = Fpinv * minitensor::transpose(Fpinv);
+    be    = Jm23 * F * Cpinv * minitensor::transpose(F);
+    s     = mu * minitensor::dev(be);
+
+    ScalarT const mubar = minitensor::trace(be) * mu / 3.0;
+    ScalarT const smag  = minitensor::norm(s);
+    ScalarT const f     = smag - sq23 * (Y + K * eqps_n + sat_mod_ * (1.0 - std::exp(-sat_exp_ * eqps_n)));
+
+    ScalarT eqps = eqps_n;
+
+    if (f > 1.0e-12) {
+      // Return map. Newton iterations on values only, followed by a
+      // single step in ScalarT that carries the derivatives of the
+      // converged solution (implicit function theorem).
+      RealType const smag_v  = Sacado::ScalarValue<ScalarT>::eval(smag);
+      RealType const mubar_v = Sacado::ScalarValue<ScalarT>::eval(mubar);
+      RealType const K_v     = Sacado::ScalarValue<ScalarT>::eval(K);
+      RealType const Y_v     = Sacado::ScalarValue<ScalarT>::eval(Y);
+      RealType const f_v     = Sacado::ScalarValue<ScalarT>::eval(f);
+
+      RealType dgam_v{0.0};
+      bool     converged{false};
+      int      count{0};
+      while (!converged && count <= num_max_iter) {
+        ++count;
+        RealType const alpha = eqps_n + sq23 * dgam_v;
+        RealType const H     = K_v * alpha + sat_mod_ * (1.0 - std::exp(-sat_exp_ * alpha));
+        RealType const dH    = K_v + sat_exp_ * sat_mod_ * std::exp(-sat_exp_ * alpha);
+        RealType const g     = smag_v - (2.0 * mubar_v * dgam_v + sq23 * (Y_v + H));
+        RealType const dg    = -2.0 * mubar_v * (1.0 + dH / (3.0 * mubar_v));
+
+        RealType const res = std::abs(g);
+        if (res < 1.0e-11 || res / Y_v < 1.0e-11 || res / f_v < 1.0e-11) {
+          converged = true;
+        } else {
+          dgam_v -= g / dg;
+        }
+      }
+      if (!converged) Kokkos::abort("Error(LCM FusedMechanicsResidual): J2 return mapping did not converge.");
+
+      ScalarT const alpha = eqps_n + sq23 * dgam_v;
+      ScalarT const H     = K * alpha + sat_mod_ * (1.0 - std::exp(-sat_exp_ * alpha));
+      ScalarT const dH    = K + sat_exp_ * sat_mod_ * std::exp(-sat_exp_ * alpha);
+      ScalarT const g     = smag - (2.0 * mubar * dgam_v + sq23 * (Y + H));
+      ScalarT const dg    = -2.0 * mubar * (1.0 + dH / (3.0 * mubar));
+      ScalarT const dgam  = dgam_v - g / dg;
+
+      // plastic direction
+      N = (1.0 / smag) * s;
+
+      // update s and eqps
+      s -= 2.0 * mubar * dgam * N;
+      eqps = eqps_n + sq23 * dgam;
+
+      // exponential map to get Fpnew
+      Fpnew = minitensor::exp(dgam * N) * Fpn;
+    } else {
+      Fpnew = Fpn;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        fp_(cell, pt, i, j) = Fpnew(i, j);
+      }
+    }
+    eqps_(cell, pt)       = eqps;
+    yield_surf_(cell, pt) = Y + K * eqps + sat_mod_ * (1.0 - std::exp(-sat_exp_ * eqps));
+
+    // pressure and Cauchy stress
+    ScalarT const p = 0.5 * kappa * (J - 1.0 / J);
+    sigma           = p * I + s / J;
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        stress_(cell, pt, i, j) = sigma(i, j);
+      }
+    }
+
+    // P = J sigma F^{-T}
+    P = J * sigma * minitensor::transpose(minitensor::inverse(F));
+    integrate(cell, pt, P);
+  }
+  if (have_dynamics_) addInertia(cell);
+}
+
+// ***************************************************************************
+template <typename EvalT, typename Traits>
+void
+FusedMechanicsResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+#if defined(ALBANY_TIMER)
+  auto start = std::chrono::high_resolution_clock::now();
+#endif
+  have_dynamics_ = workset.transientTerms;
+
+  switch (model_) {
+    case Model::LINEAR_ELASTIC: Kokkos::parallel_for(linear_elastic_Policy(0, workset.numCells), *this); break;
+    case Model::NEOHOOKEAN: Kokkos::parallel_for(neohookean_Policy(0, workset.numCells), *this); break;
+    case Model::J2:
+      // Old state lives in host state arrays, like for the ParallelKernel
+      // based models.
+      fp_old_   = (*workset.stateArrayPtr)[fp_name_ + "_old"];
+      eqps_old_ = (*workset.stateArrayPtr)[eqps_name_ + "_old"];
+      Kokkos::parallel_for(j2_Policy(0, workset.numCells), *this);
+      break;
+  }
+#if defined(ALBANY_TIMER)
+  PHX::Device::fence();
+  auto      elapsed      = std::chrono::high_resolution_clock::now() - start;
+  long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  long long millisec     = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+  std::cout << "Fused Mechanics Residual time = " << millisec << "  " << microseconds << std::endl;
+#endif
+}
+
+}  // namespace LCM
@@ -50,47 +50,54 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Eval
 
   ///
   /// Takes given coordinates and computes the corresponding midplane
+  /// \param cell
   /// \param refCoords
   /// \param midplane_coords
   ///
   template <typename ST>
-  void
-  computeMidplaneCoords(PHX::MDField<const ST, Cell, Vertex, Dim> const coords, Kokkos::DynRankView<ST, PHX::Device>& midplane_coords);
+  KOKKOS_INLINE_FUNCTION void
+  computeMidplaneCoords(
+      int const                                       cell,
+      PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
+      Kokkos::DynRankView<ST, PHX::Device> const&     midplane_coords) const;
 
   ///
   /// Computes basis from the reference midplane
+  /// \param cell
   /// \param midplane_coords
   /// \param basis
   ///
   template <typename ST>
-  void
-  computeBasisVectors(Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords, PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis);
+  KOKKOS_INLINE_FUNCTION void
+  computeBasisVectors(int const cell, Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords, PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis) const;
 
   ///
-  /// Computes the Dual from the midplane and reference bases
-  /// \param midplane_coords
+  /// Computes the Dual from the reference bases
+  /// \param cell
   /// \param basis
   /// \param normal
   /// \param dual_basis
   ///
-  void
+  KOKKOS_INLINE_FUNCTION void
   computeDualBasisVectors(
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> const&       midplane_coords,
+      int const                                                  cell,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis);
+      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis) const;
 
   ///
   /// Computes the jacobian mapping - da/dA
+  /// \param cell
   /// \param basis
   /// \param dual_basis
   /// \param area
   ///
-  void
+  KOKKOS_INLINE_FUNCTION void
   computeJacobian(
+      int const                                                  cell,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area);
+      PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area) const;
 
  private:
   unsigned int container_size, num_dims_, num_nodes_, num_qps_, num_surf_nodes_, num_surf_dims_;
@@ -172,6 +179,19 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Eval
   /// Reference Cell View for integration weights
   ///
   Kokkos::DynRankView<RealType, PHX::Device> ref_weights_;
+
+ public:  // Kokkos
+  struct surface_basis_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, surface_basis_Tag> surface_basis_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const surface_basis_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
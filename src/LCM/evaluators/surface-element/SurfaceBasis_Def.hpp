@@ -101,159 +101,152 @@ SurfaceBasis<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d,
 }
 
 template <typename EvalT, typename Traits>
-void
-SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceBasis<EvalT, Traits>::operator()(const surface_basis_Tag& tag, const int& cell) const
 {
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    // for the reference geometry
-    // compute the mid-plane coordinates
-    computeMidplaneCoords(reference_coords_, ref_midplane_coords_);
+  // for the reference geometry
+  // compute the mid-plane coordinates
+  computeMidplaneCoords(cell, reference_coords_, ref_midplane_coords_);
 
-    // compute basis vectors
-    computeBasisVectors(ref_midplane_coords_, ref_basis_);
+  // compute basis vectors
+  computeBasisVectors(cell, ref_midplane_coords_, ref_basis_);
 
-    // compute the dual
-    computeDualBasisVectors(ref_midplane_coords_, ref_basis_, ref_normal_, ref_dual_basis_);
+  // compute the dual
+  computeDualBasisVectors(cell, ref_basis_, ref_normal_, ref_dual_basis_);
 
-    // compute the Jacobian
-    computeJacobian(ref_basis_, ref_dual_basis_, ref_area_);
+  // compute the Jacobian
+  computeJacobian(cell, ref_basis_, ref_dual_basis_, ref_area_);
 
-    if (need_current_basis_) {
-      // for the current configuration
-      // compute the mid-plane coordinates
-      computeMidplaneCoords(current_coords_, current_midplane_coords_);
+  if (need_current_basis_) {
+    // for the current configuration
+    // compute the mid-plane coordinates
+    computeMidplaneCoords(cell, current_coords_, current_midplane_coords_);
 
-      // compute base vectors
-      computeBasisVectors(current_midplane_coords_, current_basis_);
-    }
+    // compute base vectors
+    computeBasisVectors(cell, current_midplane_coords_, current_basis_);
   }
 }
 
 template <typename EvalT, typename Traits>
-template <typename ST>
 void
+SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(surface_basis_Policy(0, workset.numCells), *this);
+}
+
+template <typename EvalT, typename Traits>
+template <typename ST>
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeMidplaneCoords(
+    int const                                       cell,
     PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
-    Kokkos::DynRankView<ST, PHX::Device>&           midplane_coords)
+    Kokkos::DynRankView<ST, PHX::Device> const&     midplane_coords) const
 {
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // compute the mid-plane coordinates
-    for (int node(0); node < num_surf_nodes_; ++node) {
-      int top_node = node + num_surf_nodes_;
+  // compute the mid-plane coordinates
+  for (int node(0); node < num_surf_nodes_; ++node) {
+    int top_node = node + num_surf_nodes_;
 
-      for (int dim(0); dim < num_dims_; ++dim) {
-        midplane_coords(cell, node, dim) = 0.5 * (coords(cell, node, dim) + coords(cell, top_node, dim));
-      }
+    for (int dim(0); dim < num_dims_; ++dim) {
+      midplane_coords(cell, node, dim) = 0.5 * (coords(cell, node, dim) + coords(cell, top_node, dim));
     }
   }
 }
 
 template <typename EvalT, typename Traits>
 template <typename ST>
-void
-SurfaceBasis<EvalT, Traits>::computeBasisVectors(Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords, PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis)
+KOKKOS_INLINE_FUNCTION void
+SurfaceBasis<EvalT, Traits>::computeBasisVectors(
+    int const                                   cell,
+    Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords,
+    PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis) const
 {
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // get the midplane coordinates
-    std::vector<minitensor::Vector<ST>> midplane_nodes(num_surf_nodes_);
+  minitensor::Vector<ST, 3> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
 
+  // compute the base vectors
+  for (int pt(0); pt < num_qps_; ++pt) {
+    g_0.fill(minitensor::Filler::ZEROS);
+    g_1.fill(minitensor::Filler::ZEROS);
     for (int node(0); node < num_surf_nodes_; ++node) {
-      midplane_nodes[node] = minitensor::Vector<ST>(minitensor::Source::ARRAY, 3, midplane_coords, cell, node, 0);
-    }
+      minitensor::Vector<ST, 3> const midplane_node(minitensor::Source::ARRAY, 3, midplane_coords, cell, node, 0);
 
-    minitensor::Vector<ST> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
-
-    // compute the base vectors
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0.fill(minitensor::Filler::ZEROS);
-      g_1.fill(minitensor::Filler::ZEROS);
-      for (int node(0); node < num_surf_nodes_; ++node) {
-        g_0 += ref_grads_(node, pt, 0) * midplane_nodes[node];
-        g_1 += ref_grads_(node, pt, 1) * midplane_nodes[node];
-      }
-      g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
-
-      basis(cell, pt, 0, 0) = g_0(0);
-      basis(cell, pt, 0, 1) = g_0(1);
-      basis(cell, pt, 0, 2) = g_0(2);
-      basis(cell, pt, 1, 0) = g_1(0);
-      basis(cell, pt, 1, 1) = g_1(1);
-      basis(cell, pt, 1, 2) = g_1(2);
-      basis(cell, pt, 2, 0) = g_2(0);
-      basis(cell, pt, 2, 1) = g_2(1);
-      basis(cell, pt, 2, 2) = g_2(2);
+      g_0 += ref_grads_(node, pt, 0) * midplane_node;
+      g_1 += ref_grads_(node, pt, 1) * midplane_node;
     }
+    g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
+
+    basis(cell, pt, 0, 0) = g_0(0);
+    basis(cell, pt, 0, 1) = g_0(1);
+    basis(cell, pt, 0, 2) = g_0(2);
+    basis(cell, pt, 1, 0) = g_1(0);
+    basis(cell, pt, 1, 1) = g_1(1);
+    basis(cell, pt, 1, 2) = g_1(2);
+    basis(cell, pt, 2, 0) = g_2(0);
+    basis(cell, pt, 2, 1) = g_2(1);
+    basis(cell, pt, 2, 2) = g_2(2);
   }
 }
 
 template <typename EvalT, typename Traits>
-void
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> const&       midplane_coords,
+    int const                                                  cell,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis)
+    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis) const
 {
-  int worksetSize = midplane_coords.extent(0);
+  minitensor::Vector<MeshScalarT, 3> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
 
-  minitensor::Vector<MeshScalarT> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
+  minitensor::Vector<MeshScalarT, 3> g0(0, 0, 0), g1(0, 0, 0), g2(0, 0, 0);
 
-  minitensor::Vector<MeshScalarT> g0(0, 0, 0), g1(0, 0, 0), g2(0, 0, 0);
+  for (int pt(0); pt < num_qps_; ++pt) {
+    g_0 = minitensor::Vector<MeshScalarT, 3>(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
 
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
+    g_1 = minitensor::Vector<MeshScalarT, 3>(minitensor::Source::ARRAY, 3, basis, cell, pt, 1, 0);
 
-      g_1 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 1, 0);
+    g_2 = minitensor::Vector<MeshScalarT, 3>(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
 
-      g_2 = minitensor::Vector<MeshScalarT>(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
+    normal(cell, pt, 0) = g_2(0);
+    normal(cell, pt, 1) = g_2(1);
+    normal(cell, pt, 2) = g_2(2);
 
-      normal(cell, pt, 0) = g_2(0);
-      normal(cell, pt, 1) = g_2(1);
-      normal(cell, pt, 2) = g_2(2);
+    g0 = minitensor::cross(g_1, g_2);
+    g1 = minitensor::cross(g_0, g_2);
+    g2 = minitensor::cross(g_0, g_1);
 
-      g0 = minitensor::cross(g_1, g_2);
-      g1 = minitensor::cross(g_0, g_2);
-      g2 = minitensor::cross(g_0, g_1);
+    g0 = g0 / dot(g_0, g0);
+    g1 = g1 / dot(g_1, g1);
+    g2 = g2 / dot(g_2, g2);
 
-      g0 = g0 / dot(g_0, g0);
-      g1 = g1 / dot(g_1, g1);
-      g2 = g2 / dot(g_2, g2);
-
-      dual_basis(cell, pt, 0, 0) = g0(0);
-      dual_basis(cell, pt, 0, 1) = g0(1);
-      dual_basis(cell, pt, 0, 2) = g0(2);
-      dual_basis(cell, pt, 1, 0) = g1(0);
-      dual_basis(cell, pt, 1, 1) = g1(1);
-      dual_basis(cell, pt, 1, 2) = g1(2);
-      dual_basis(cell, pt, 2, 0) = g2(0);
-      dual_basis(cell, pt, 2, 1) = g2(1);
-      dual_basis(cell, pt, 2, 2) = g2(2);
-    }
+    dual_basis(cell, pt, 0, 0) = g0(0);
+    dual_basis(cell, pt, 0, 1) = g0(1);
+    dual_basis(cell, pt, 0, 2) = g0(2);
+    dual_basis(cell, pt, 1, 0) = g1(0);
+    dual_basis(cell, pt, 1, 1) = g1(1);
+    dual_basis(cell, pt, 1, 2) = g1(2);
+    dual_basis(cell, pt, 2, 0) = g2(0);
+    dual_basis(cell, pt, 2, 1) = g2(1);
+    dual_basis(cell, pt, 2, 2) = g2(2);
   }
 }
 
 template <typename EvalT, typename Traits>
-void
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeJacobian(
+    int const                                                  cell,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area)
+    PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area) const
 {
-  int const worksetSize = basis.extent(0);
+  for (int pt(0); pt < num_qps_; ++pt) {
+    minitensor::Tensor<MeshScalarT, 3> dPhiInv(minitensor::Source::ARRAY, 3, dual_basis, cell, pt, 0, 0);
 
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      minitensor::Tensor<MeshScalarT> dPhiInv(minitensor::Source::ARRAY, 3, dual_basis, cell, pt, 0, 0);
+    minitensor::Tensor<MeshScalarT, 3> dPhi(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
 
-      minitensor::Tensor<MeshScalarT> dPhi(minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
+    minitensor::Vector<MeshScalarT, 3> G_2(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
 
-      minitensor::Vector<MeshScalarT> G_2(minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
-
-      MeshScalarT j0       = minitensor::det(dPhi);
-      MeshScalarT jacobian = j0 * std::sqrt(minitensor::dot(minitensor::dot(G_2, minitensor::transpose(dPhiInv) * dPhiInv), G_2));
-      area(cell, pt)       = jacobian * ref_weights_(pt);
-    }
+    MeshScalarT j0       = minitensor::det(dPhi);
+    MeshScalarT jacobian = j0 * std::sqrt(minitensor::dot(minitensor::dot(G_2, minitensor::transpose(dPhiInv) * dPhiInv), G_2));
+    area(cell, pt)       = jacobian * ref_weights_(pt);
   }
 }
 
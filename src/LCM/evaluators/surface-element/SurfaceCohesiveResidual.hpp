@@ -71,6 +71,19 @@ class SurfaceCohesiveResidual : public PHX::EvaluatorWithBaseImpl<Traits>, publi
   unsigned int num_surf_nodes_;
 
   unsigned int num_surf_dims_;
+
+ public:  // Kokkos
+  struct cohesive_residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, cohesive_residual_Tag> cohesive_residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const cohesive_residual_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
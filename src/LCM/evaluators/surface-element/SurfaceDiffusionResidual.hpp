@@ -72,6 +72,19 @@ class SurfaceDiffusionResidual : public PHX::EvaluatorWithBaseImpl<Traits>, publ
   unsigned int numDims;
   unsigned int numPlaneNodes;
   unsigned int numPlaneDims;
+
+ public:  // Kokkos
+  struct diffusion_residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, diffusion_residual_Tag> diffusion_residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const diffusion_residual_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
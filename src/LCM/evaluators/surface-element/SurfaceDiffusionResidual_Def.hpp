@@ -71,17 +71,23 @@ SurfaceDiffusionResidual<EvalT, Traits>::postRegistrationSetup(typename Traits::
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceDiffusionResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceDiffusionResidual<EvalT, Traits>::operator()(const diffusion_residual_Tag& tag, const int& cell) const
 {
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      scalarResidual(cell, node) = 0;
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarResidual(cell, node) += refValues(node, pt) * scalarJump(cell, pt) * thickness * refArea(cell, pt);
-      }
+  for (int node(0); node < numPlaneNodes; ++node) {
+    scalarResidual(cell, node) = 0;
+    for (int pt = 0; pt < numQPs; ++pt) {
+      scalarResidual(cell, node) += refValues(node, pt) * scalarJump(cell, pt) * thickness * refArea(cell, pt);
     }
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceDiffusionResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(diffusion_residual_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
@@ -6,6 +6,7 @@
 #define SURFACE_H_DIFFUSION_DEF_RESIDUAL_HPP
 
 #include "Albany_Layouts.hpp"
+#include "Albany_StateInfoStruct.hpp"
 #include "Albany_Types.hpp"
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
@@ -85,6 +86,10 @@ class SurfaceHDiffusionDefResidual : public PHX::EvaluatorWithBaseImpl<Traits>,
   // Data from previous time step
   std::string transportName, JName, CLGradName, eqpsName;
 
+  // Old transport and eqps, set for each workset
+  Albany::MDArray transportold;
+  Albany::MDArray eqps_old;
+
   // Time
   PHX::MDField<ScalarT const, Dummy> deltaTime;
 
@@ -118,6 +123,19 @@ class SurfaceHDiffusionDefResidual : public PHX::EvaluatorWithBaseImpl<Traits>,
   unsigned int numPlaneDims;
 
   bool haveMech;
+
+ public:  // Kokkos
+  struct transport_residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, transport_residual_Tag> transport_residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const transport_residual_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
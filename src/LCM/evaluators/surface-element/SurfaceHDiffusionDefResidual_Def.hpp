@@ -140,19 +140,9 @@ SurfaceHDiffusionDefResidual<EvalT, Traits>::postRegistrationSetup(typename Trai
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceHDiffusionDefResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceHDiffusionDefResidual<EvalT, Traits>::operator()(const transport_residual_Tag& tag, const int& cell) const
 {
-  //   typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-  //    typedef Intrepid2::RealSpaceTools<ScalarT> RST;
-
-  Albany::MDArray transportold   = (*workset.stateArrayPtr)[transportName];
-  Albany::MDArray scalarGrad_old = (*workset.stateArrayPtr)[CLGradName];
-  Albany::MDArray eqps_old;
-  if (haveMech) {
-    eqps_old = (*workset.stateArrayPtr)[eqpsName];
-  }
-
   ScalarT dt = deltaTime(0);
   ScalarT temp(0.0);
   ScalarT transientTerm(0.0);
@@ -161,156 +151,155 @@ SurfaceHDiffusionDefResidual<EvalT, Traits>::evaluateFields(typename Traits::Eva
   // compute artifical diffusivity
 
   // for 1D this is identical to lumped mass as shown in Prevost's paper.
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      if (dt == 0) {
-        artificalDL(cell, pt) = 0;
-      } else {
-        temp = thickness * thickness / 6.0 * eff_diff_(cell, pt) / dL_(cell, pt) / dt;
-
-        ScalarT temp2 = ((temp - 1.0) / dL_(cell, pt));
-
-        if (temp2 < 10.0 && temp2 > -10.0)
-          artificalDL(cell, pt) = stab_param_ * temp * (0.5 + 0.5 * std::tanh(temp2)) * dL_(cell, pt);
-        else if (temp2 >= 10.0)
-          artificalDL(cell, pt) = stab_param_ * temp * dL_(cell, pt);
-        else
-          artificalDL(cell, pt) = 0.0;
-      }
-      stabilizedDL(cell, pt) = artificalDL(cell, pt) / (dL_(cell, pt) + artificalDL(cell, pt));
+  for (int pt = 0; pt < numQPs; ++pt) {
+    if (dt == 0) {
+      artificalDL(cell, pt) = 0;
+    } else {
+      temp = thickness * thickness / 6.0 * eff_diff_(cell, pt) / dL_(cell, pt) / dt;
+
+      ScalarT temp2 = ((temp - 1.0) / dL_(cell, pt));
+
+      if (temp2 < 10.0 && temp2 > -10.0)
+        artificalDL(cell, pt) = stab_param_ * temp * (0.5 + 0.5 * std::tanh(temp2)) * dL_(cell, pt);
+      else if (temp2 >= 10.0)
+        artificalDL(cell, pt) = stab_param_ * temp * dL_(cell, pt);
+      else
+        artificalDL(cell, pt) = 0.0;
     }
+    stabilizedDL(cell, pt) = artificalDL(cell, pt) / (dL_(cell, pt) + artificalDL(cell, pt));
   }
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      minitensor::Tensor<ScalarT> F(minitensor::Source::ARRAY, numDims, defGrad, cell, pt, 0, 0);
+  for (int pt = 0; pt < numQPs; ++pt) {
+    minitensor::Tensor<ScalarT, 3> F(minitensor::Source::ARRAY, numDims, defGrad, cell, pt, 0, 0);
 
-      minitensor::Tensor<ScalarT> C_tensor_ = minitensor::t_dot(F, F);
+    minitensor::Tensor<ScalarT, 3> C_tensor_ = minitensor::t_dot(F, F);
 
-      minitensor::Tensor<ScalarT> C_inv_tensor_ = minitensor::inverse(C_tensor_);
+    minitensor::Tensor<ScalarT, 3> C_inv_tensor_ = minitensor::inverse(C_tensor_);
 
-      minitensor::Vector<ScalarT> C_grad_(minitensor::Source::ARRAY, numDims, scalarGrad, cell, pt, 0);
+    minitensor::Vector<ScalarT, 3> C_grad_(minitensor::Source::ARRAY, numDims, scalarGrad, cell, pt, 0);
 
-      minitensor::Vector<ScalarT> C_grad_in_ref_ = minitensor::dot(C_inv_tensor_, C_grad_);
+    minitensor::Vector<ScalarT, 3> C_grad_in_ref_ = minitensor::dot(C_inv_tensor_, C_grad_);
 
-      for (int j = 0; j < numDims; j++) {
-        flux(cell, pt, j) = (1 - stabilizedDL(cell, pt)) * C_grad_in_ref_(j);
-      }
+    for (int j = 0; j < numDims; j++) {
+      flux(cell, pt, j) = (1 - stabilizedDL(cell, pt)) * C_grad_in_ref_(j);
     }
   }
 
   // Initialize the residual
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode                        = node + numPlaneNodes;
-      transport_residual_(cell, node)    = 0;
-      transport_residual_(cell, topNode) = 0;
-    }
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode                        = node + numPlaneNodes;
+    transport_residual_(cell, node)    = 0;
+    transport_residual_(cell, topNode) = 0;
   }
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode = node + numPlaneNodes;
-      for (int pt = 0; pt < numQPs; ++pt) {
-        temp = (dL_(cell, pt) + artificalDL(cell, pt));  // GB changed 08/14/2015
-        for (std::size_t dim = 0; dim < numDims; ++dim) {
-          transport_residual_(cell, node) +=
-              flux(cell, pt, dim) * dt * surface_Grad_BF(cell, node, pt, dim) * refArea(cell, pt) * thickness * temp;  // GB changed 08/14/2015
-
-          transport_residual_(cell, topNode) +=
-              flux(cell, pt, dim) * dt * surface_Grad_BF(cell, topNode, pt, dim) * refArea(cell, pt) * thickness * temp;  // GB changed 08/14/2015
-        }
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode = node + numPlaneNodes;
+    for (int pt = 0; pt < numQPs; ++pt) {
+      temp = (dL_(cell, pt) + artificalDL(cell, pt));  // GB changed 08/14/2015
+      for (std::size_t dim = 0; dim < numDims; ++dim) {
+        transport_residual_(cell, node) +=
+            flux(cell, pt, dim) * dt * surface_Grad_BF(cell, node, pt, dim) * refArea(cell, pt) * thickness * temp;  // GB changed 08/14/2015
+
+        transport_residual_(cell, topNode) +=
+            flux(cell, pt, dim) * dt * surface_Grad_BF(cell, topNode, pt, dim) * refArea(cell, pt) * thickness * temp;  // GB changed 08/14/2015
       }
     }
   }
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      // initialize the residual
-      int topNode = node + numPlaneNodes;
+  for (int node(0); node < numPlaneNodes; ++node) {
+    // initialize the residual
+    int topNode = node + numPlaneNodes;
 
-      for (int pt = 0; pt < numQPs; ++pt) {
-        // If there is no diffusion, then the residual defines only on the
-        // mid-plane value
+    for (int pt = 0; pt < numQPs; ++pt) {
+      // If there is no diffusion, then the residual defines only on the
+      // mid-plane value
 
-        // temp = 1.0/(dL_(cell,pt) + artificalDL(cell,pt)); GB changed
-        // 08/14/2015
+      // temp = 1.0/(dL_(cell,pt) + artificalDL(cell,pt)); GB changed
+      // 08/14/2015
 
-        // Local rate of change volumetric constraint term
-        transientTerm = refValues(node, pt) * (eff_diff_(cell, pt) * (transport_(cell, pt) - transportold(cell, pt))) * refArea(cell, pt) *
-                        thickness;  //*temp; GB changed 08/14/2015
+      // Local rate of change volumetric constraint term
+      transientTerm = refValues(node, pt) * (eff_diff_(cell, pt) * (transport_(cell, pt) - transportold(cell, pt))) * refArea(cell, pt) *
+                      thickness;  //*temp; GB changed 08/14/2015
 
-        transport_residual_(cell, node) += transientTerm;
+      transport_residual_(cell, node) += transientTerm;
 
-        transport_residual_(cell, topNode) += transientTerm;
+      transport_residual_(cell, topNode) += transientTerm;
 
-        if (haveMech) {
-          // Strain rate source term
-          transientTerm = refValues(node, pt) * strain_rate_factor_(cell, pt) * (eqps_(cell, pt) - eqps_old(cell, pt)) * refArea(cell, pt) *
-                          thickness;  //*temp; GB changed 08/14/2015
+      if (haveMech) {
+        // Strain rate source term
+        transientTerm = refValues(node, pt) * strain_rate_factor_(cell, pt) * (eqps_(cell, pt) - eqps_old(cell, pt)) * refArea(cell, pt) *
+                        thickness;  //*temp; GB changed 08/14/2015
 
-          transport_residual_(cell, node) += transientTerm;
+        transport_residual_(cell, node) += transientTerm;
 
-          transport_residual_(cell, topNode) += transientTerm;
+        transport_residual_(cell, topNode) += transientTerm;
 
-          // hydrostatic stress term
-          // MUST BE FIXED: Add C_inverse term into hydrostatic residual - added
-          // but need to do this nicely.
-          for (int dim = 0; dim < numDims; ++dim) {
-            minitensor::Tensor<ScalarT> F(minitensor::Source::ARRAY, numDims, defGrad, cell, pt, 0, 0);
+        // hydrostatic stress term
+        // MUST BE FIXED: Add C_inverse term into hydrostatic residual - added
+        // but need to do this nicely.
+        for (int dim = 0; dim < numDims; ++dim) {
+          minitensor::Tensor<ScalarT, 3> F(minitensor::Source::ARRAY, numDims, defGrad, cell, pt, 0, 0);
 
-            minitensor::Tensor<ScalarT> C_tensor = minitensor::t_dot(F, F);
+          minitensor::Tensor<ScalarT, 3> C_tensor = minitensor::t_dot(F, F);
 
-            minitensor::Tensor<ScalarT> C_inv_tensor = minitensor::inverse(C_tensor);
+          minitensor::Tensor<ScalarT, 3> C_inv_tensor = minitensor::inverse(C_tensor);
 
-            minitensor::Vector<ScalarT> hydro_stress_grad(minitensor::Source::ARRAY, numDims, hydro_stress_gradient_, cell, pt, 0);
+          minitensor::Vector<ScalarT, 3> hydro_stress_grad(minitensor::Source::ARRAY, numDims, hydro_stress_gradient_, cell, pt, 0);
 
-            minitensor::Vector<ScalarT> C_inv_hydro_stress_grad = minitensor::dot(C_inv_tensor, hydro_stress_grad);
+          minitensor::Vector<ScalarT, 3> C_inv_hydro_stress_grad = minitensor::dot(C_inv_tensor, hydro_stress_grad);
 
-            transport_residual_(cell, node) -= surface_Grad_BF(cell, node, pt, dim) * convection_coefficient_(cell, pt) * transport_(cell, pt) *
-                                               hydro_stress_gradient_(cell, pt, dim) * dt * refArea(cell, pt) * thickness;  //*temp; GB changed 08/14/2015
+          transport_residual_(cell, node) -= surface_Grad_BF(cell, node, pt, dim) * convection_coefficient_(cell, pt) * transport_(cell, pt) *
+                                             hydro_stress_gradient_(cell, pt, dim) * dt * refArea(cell, pt) * thickness;  //*temp; GB changed 08/14/2015
 
-            transport_residual_(cell, topNode) -= surface_Grad_BF(cell, topNode, pt, dim) * convection_coefficient_(cell, pt) * transport_(cell, pt) *
-                                                  C_inv_hydro_stress_grad(dim) * dt * refArea(cell, pt) * thickness;  //*temp; GB changed 08/14/2015
-          }
+          transport_residual_(cell, topNode) -= surface_Grad_BF(cell, topNode, pt, dim) * convection_coefficient_(cell, pt) * transport_(cell, pt) *
+                                                C_inv_hydro_stress_grad(dim) * dt * refArea(cell, pt) * thickness;  //*temp; GB changed 08/14/2015
         }
-      }  // end integrartion point loop
-    }    //  end plane node loop
-  }      // end cell loop
+      }
+    }  // end integrartion point loop
+  }    //  end plane node loop
 
   // Stabilization term (if needed)
 
   ScalarT CLPbar(0);
   ScalarT vol(0);
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    CLPbar = 0.0;
-    vol    = 0.0;
-    for (int qp = 0; qp < numQPs; ++qp) {
-      CLPbar += refArea(cell, qp) * thickness * (transport_(cell, qp) - transportold(cell, qp));
-      vol += refArea(cell, qp) * thickness;
-    }
-    CLPbar /= vol;
-    for (int qp = 0; qp < numQPs; ++qp) {
-      pterm(cell, qp) = CLPbar;
-    }
+  CLPbar = 0.0;
+  vol    = 0.0;
+  for (int qp = 0; qp < numQPs; ++qp) {
+    CLPbar += refArea(cell, qp) * thickness * (transport_(cell, qp) - transportold(cell, qp));
+    vol += refArea(cell, qp) * thickness;
+  }
+  CLPbar /= vol;
+  for (int qp = 0; qp < numQPs; ++qp) {
+    pterm(cell, qp) = CLPbar;
   }
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int node = 0; node < numPlaneNodes; ++node) {
-      int topNode = node + numPlaneNodes;
+  for (int node = 0; node < numPlaneNodes; ++node) {
+    int topNode = node + numPlaneNodes;
 
-      for (int qp = 0; qp < numQPs; ++qp) {
-        temp = 1.0 / dL_(cell, qp) + artificalDL(cell, qp);
+    for (int qp = 0; qp < numQPs; ++qp) {
+      temp = 1.0 / dL_(cell, qp) + artificalDL(cell, qp);
 
-        stabilizationTerm = stab_param_ * eff_diff_(cell, qp) * (-transport_(cell, qp) + transportold(cell, qp) + pterm(cell, qp)) * refValues(node, qp) *
-                            refArea(cell, qp) * thickness;  //*temp;  GB changed 08/14/2015
+      stabilizationTerm = stab_param_ * eff_diff_(cell, qp) * (-transport_(cell, qp) + transportold(cell, qp) + pterm(cell, qp)) * refValues(node, qp) *
+                          refArea(cell, qp) * thickness;  //*temp;  GB changed 08/14/2015
 
-        transport_residual_(cell, node) -= stabilizationTerm;
-        transport_residual_(cell, topNode) -= stabilizationTerm;
-      }
+      transport_residual_(cell, node) -= stabilizationTerm;
+      transport_residual_(cell, topNode) -= stabilizationTerm;
     }
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceHDiffusionDefResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  transportold = (*workset.stateArrayPtr)[transportName];
+  if (haveMech) {
+    eqps_old = (*workset.stateArrayPtr)[eqpsName];
+  }
+
+  Kokkos::parallel_for(transport_residual_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
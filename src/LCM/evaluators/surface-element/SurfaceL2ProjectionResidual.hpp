@@ -77,6 +77,19 @@ class SurfaceL2ProjectionResidual : public PHX::EvaluatorWithBaseImpl<Traits>, p
   unsigned int numDims;
   unsigned int numPlaneNodes;
   unsigned int numPlaneDims;
+
+ public:  // Kokkos
+  struct projection_residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, projection_residual_Tag> projection_residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const projection_residual_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
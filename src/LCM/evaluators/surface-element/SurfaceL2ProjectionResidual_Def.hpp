@@ -90,39 +90,39 @@ SurfaceL2ProjectionResidual<EvalT, Traits>::postRegistrationSetup(typename Trait
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceL2ProjectionResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceL2ProjectionResidual<EvalT, Traits>::operator()(const projection_residual_Tag& tag, const int& cell) const
 {
-  // THESE NEED TO BE REMOVED!!!
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-  typedef Intrepid2::RealSpaceTools<ScalarT>         RST;
-
   ScalarT tau(0);
 
   // Initialize the residual
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode                         = node + numPlaneNodes;
-      projection_residual_(cell, node)    = 0;
-      projection_residual_(cell, topNode) = 0;
-    }
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode                         = node + numPlaneNodes;
+    projection_residual_(cell, node)    = 0;
+    projection_residual_(cell, topNode) = 0;
   }
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode = node + numPlaneNodes;
-      for (int pt = 0; pt < numQPs; ++pt) {
-        tau = 0.0;
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode = node + numPlaneNodes;
+    for (int pt = 0; pt < numQPs; ++pt) {
+      tau = 0.0;
 
-        for (int dim = 0; dim < numDims; ++dim) {
-          tau += detF_(cell, pt) * Cauchy_stress_(cell, pt, dim, dim) / numDims;
-        }
-
-        projection_residual_(cell, node) += refValues(node, pt) * (projected_tau_(cell, pt) - tau) * refArea(cell, pt) * thickness;
+      for (int dim = 0; dim < numDims; ++dim) {
+        tau += detF_(cell, pt) * Cauchy_stress_(cell, pt, dim, dim) / numDims;
       }
-      projection_residual_(cell, topNode) = projection_residual_(cell, node);
+
+      projection_residual_(cell, node) += refValues(node, pt) * (projected_tau_(cell, pt) - tau) * refArea(cell, pt) * thickness;
     }
+    projection_residual_(cell, topNode) = projection_residual_(cell, node);
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceL2ProjectionResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(projection_residual_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
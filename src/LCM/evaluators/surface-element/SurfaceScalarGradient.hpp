@@ -68,6 +68,19 @@ class SurfaceScalarGradient : public PHX::EvaluatorWithBaseImpl<Traits>, public
   unsigned int numDims;
   unsigned int numPlaneNodes;
   unsigned int numPlaneDims;
+
+ public:  // Kokkos
+  struct scalar_gradient_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, scalar_gradient_Tag> scalar_gradient_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const scalar_gradient_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
@@ -68,6 +68,26 @@ class SurfaceScalarGradientOperatorTransport : public PHX::EvaluatorWithBaseImpl
   unsigned int numDims;
   unsigned int numPlaneNodes;
   unsigned int numPlaneDims;
+
+ public:  // Kokkos
+  struct surface_grad_BF_Tag
+  {
+  };
+  struct grad_val_qp_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, surface_grad_BF_Tag> surface_grad_BF_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, grad_val_qp_Tag>     grad_val_qp_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const surface_grad_BF_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const grad_val_qp_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
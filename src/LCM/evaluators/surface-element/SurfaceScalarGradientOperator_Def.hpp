@@ -76,58 +76,69 @@ SurfaceScalarGradientOperator<EvalT, Traits>::postRegistrationSetup(typename Tra
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceScalarGradientOperator<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarGradientOperator<EvalT, Traits>::operator()(const surface_grad_BF_Tag& tag, const int& cell) const
 {
-  minitensor::Vector<MeshScalarT> Parent_Grad_plus(3);
-  minitensor::Vector<MeshScalarT> Parent_Grad_minor(3);
+  minitensor::Vector<MeshScalarT, 3> Parent_Grad_plus(3);
+  minitensor::Vector<MeshScalarT, 3> Parent_Grad_minor(3);
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      minitensor::Tensor<MeshScalarT> gBasis(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
+  for (int pt = 0; pt < numQPs; ++pt) {
+    minitensor::Tensor<MeshScalarT, 3> gBasis(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
 
-      minitensor::Vector<MeshScalarT> N(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
+    minitensor::Vector<MeshScalarT, 3> N(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
 
-      gBasis = minitensor::transpose(gBasis);
+    gBasis = minitensor::transpose(gBasis);
 
-      // in-plane (parallel) contribution
-      for (int node(0); node < numPlaneNodes; ++node) {
-        int topNode = node + numPlaneNodes;
+    // in-plane (parallel) contribution
+    for (int node(0); node < numPlaneNodes; ++node) {
+      int topNode = node + numPlaneNodes;
 
-        // the parallel-to-the-plane term
-        for (int i(0); i < numPlaneDims; ++i) {
-          Parent_Grad_plus(i)  = 0.5 * refGrads(node, pt, i);
-          Parent_Grad_minor(i) = 0.5 * refGrads(node, pt, i);
-        }
+      // the parallel-to-the-plane term
+      for (int i(0); i < numPlaneDims; ++i) {
+        Parent_Grad_plus(i)  = 0.5 * refGrads(node, pt, i);
+        Parent_Grad_minor(i) = 0.5 * refGrads(node, pt, i);
+      }
 
-        // the orthogonal-to-the-plane term
-        MeshScalarT invh                = 1. / thickness;
-        Parent_Grad_plus(numPlaneDims)  = invh * refValues(node, pt);
-        Parent_Grad_minor(numPlaneDims) = -invh * refValues(node, pt);
+      // the orthogonal-to-the-plane term
+      MeshScalarT invh                = 1. / thickness;
+      Parent_Grad_plus(numPlaneDims)  = invh * refValues(node, pt);
+      Parent_Grad_minor(numPlaneDims) = -invh * refValues(node, pt);
 
-        // Mapping from parent to the physical domain
-        minitensor::Vector<MeshScalarT> Transformed_Grad_plus(minitensor::dot(gBasis, Parent_Grad_plus));
-        minitensor::Vector<MeshScalarT> Transformed_Grad_minor(minitensor::dot(gBasis, Parent_Grad_minor));
+      // Mapping from parent to the physical domain
+      minitensor::Vector<MeshScalarT, 3> Transformed_Grad_plus(minitensor::dot(gBasis, Parent_Grad_plus));
+      minitensor::Vector<MeshScalarT, 3> Transformed_Grad_minor(minitensor::dot(gBasis, Parent_Grad_minor));
 
-        // assign components to MDfield ScalarGrad
-        for (int j(0); j < numDims; ++j) {
-          surface_Grad_BF(cell, topNode, pt, j) = Transformed_Grad_plus(j);
-          surface_Grad_BF(cell, node, pt, j)    = Transformed_Grad_minor(j);
-        }
+      // assign components to MDfield ScalarGrad
+      for (int j(0); j < numDims; ++j) {
+        surface_Grad_BF(cell, topNode, pt, j) = Transformed_Grad_plus(j);
+        surface_Grad_BF(cell, node, pt, j)    = Transformed_Grad_minor(j);
       }
     }
   }
+}
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      for (int k(0); k < numDims; ++k) {
-        grad_val_qp(cell, pt, k) = 0;
-        for (int node(0); node < numNodes; ++node) {
-          grad_val_qp(cell, pt, k) += surface_Grad_BF(cell, node, pt, k) * val_node(cell, node);
-        }
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarGradientOperator<EvalT, Traits>::operator()(const grad_val_qp_Tag& tag, const int& cell) const
+{
+  for (int pt = 0; pt < numQPs; ++pt) {
+    for (int k(0); k < numDims; ++k) {
+      grad_val_qp(cell, pt, k) = 0;
+      for (int node(0); node < numNodes; ++node) {
+        grad_val_qp(cell, pt, k) += surface_Grad_BF(cell, node, pt, k) * val_node(cell, node);
       }
     }
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceScalarGradientOperator<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(surface_grad_BF_Policy(0, workset.numCells), *this);
+  Kokkos::parallel_for(grad_val_qp_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
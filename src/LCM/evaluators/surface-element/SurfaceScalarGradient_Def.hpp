@@ -76,56 +76,62 @@ SurfaceScalarGradient<EvalT, Traits>::postRegistrationSetup(typename Traits::Set
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceScalarGradient<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarGradient<EvalT, Traits>::operator()(const scalar_gradient_Tag& tag, const int& cell) const
 {
   ScalarT midPlaneAvg;
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      minitensor::Vector<MeshScalarT> G_0(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
+  for (int pt = 0; pt < numQPs; ++pt) {
+    minitensor::Vector<MeshScalarT, 3> G_0(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
 
-      minitensor::Vector<MeshScalarT> G_1(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 1, 0);
+    minitensor::Vector<MeshScalarT, 3> G_1(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 1, 0);
 
-      minitensor::Vector<MeshScalarT> G_2(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 2, 0);
+    minitensor::Vector<MeshScalarT, 3> G_2(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 2, 0);
 
-      minitensor::Vector<MeshScalarT> N(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
+    minitensor::Vector<MeshScalarT, 3> N(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
 
-      minitensor::Vector<ScalarT> scalarGradPerpendicular(0, 0, 0);
-      minitensor::Vector<ScalarT> scalarGradParallel(0, 0, 0);
+    minitensor::Vector<ScalarT, 3> scalarGradPerpendicular(0, 0, 0);
+    minitensor::Vector<ScalarT, 3> scalarGradParallel(0, 0, 0);
 
-      // Need to inverse basis [G_0 ; G_1; G_2] and none of them should be
-      // normalized
-      minitensor::Tensor<MeshScalarT> gBasis(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
+    // Need to inverse basis [G_0 ; G_1; G_2] and none of them should be
+    // normalized
+    minitensor::Tensor<MeshScalarT, 3> gBasis(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
 
-      minitensor::Tensor<MeshScalarT> invRefDualBasis(3);
+    minitensor::Tensor<MeshScalarT, 3> invRefDualBasis(3);
 
-      // This map the position vector from parent to current configuration in
-      // R^3
-      gBasis          = minitensor::transpose(gBasis);
-      invRefDualBasis = minitensor::inverse(gBasis);
+    // This map the position vector from parent to current configuration in
+    // R^3
+    gBasis          = minitensor::transpose(gBasis);
+    invRefDualBasis = minitensor::inverse(gBasis);
 
-      minitensor::Vector<MeshScalarT> invG_0(3, &invRefDualBasis(0, 0));
-      minitensor::Vector<MeshScalarT> invG_1(3, &invRefDualBasis(1, 0));
-      minitensor::Vector<MeshScalarT> invG_2(3, &invRefDualBasis(2, 0));
-
-      // in-plane (parallel) contribution
-      for (int node(0); node < numPlaneNodes; ++node) {
-        int topNode = node + numPlaneNodes;
-        midPlaneAvg = 0.5 * (nodalScalar(cell, node) + nodalScalar(cell, topNode));
-        for (int i(0); i < numDims; ++i) {
-          scalarGradParallel(i) += refGrads(node, pt, 0) * midPlaneAvg * invG_0(i) + refGrads(node, pt, 1) * midPlaneAvg * invG_1(i);
-        }
-      }
+    minitensor::Vector<MeshScalarT, 3> invG_0(3, &invRefDualBasis(0, 0));
+    minitensor::Vector<MeshScalarT, 3> invG_1(3, &invRefDualBasis(1, 0));
+    minitensor::Vector<MeshScalarT, 3> invG_2(3, &invRefDualBasis(2, 0));
 
-      // normal (perpendicular) contribution
+    // in-plane (parallel) contribution
+    for (int node(0); node < numPlaneNodes; ++node) {
+      int topNode = node + numPlaneNodes;
+      midPlaneAvg = 0.5 * (nodalScalar(cell, node) + nodalScalar(cell, topNode));
       for (int i(0); i < numDims; ++i) {
-        scalarGradPerpendicular(i) = jump(cell, pt) / thickness * invG_2(i);
+        scalarGradParallel(i) += refGrads(node, pt, 0) * midPlaneAvg * invG_0(i) + refGrads(node, pt, 1) * midPlaneAvg * invG_1(i);
       }
+    }
 
-      // assign components to MDfield ScalarGrad
-      for (int i(0); i < numDims; ++i) scalarGrad(cell, pt, i) = scalarGradParallel(i) + scalarGradPerpendicular(i);
+    // normal (perpendicular) contribution
+    for (int i(0); i < numDims; ++i) {
+      scalarGradPerpendicular(i) = jump(cell, pt) / thickness * invG_2(i);
     }
+
+    // assign components to MDfield ScalarGrad
+    for (int i(0); i < numDims; ++i) scalarGrad(cell, pt, i) = scalarGradParallel(i) + scalarGradPerpendicular(i);
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceScalarGradient<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(scalar_gradient_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
@@ -80,6 +80,49 @@ class SurfaceScalarJump : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX:
   unsigned int numDims;
   unsigned int numPlaneNodes;
   unsigned int numPlaneDims;
+
+  //! Jump and mid-plane value of a nodal scalar at the points of a cell
+  KOKKOS_INLINE_FUNCTION
+  void
+  computeJump(
+      int const                                        cell,
+      PHX::MDField<ScalarT const, Cell, Vertex> const& nodal,
+      PHX::MDField<ScalarT, Cell, QuadPoint> const&    jump,
+      PHX::MDField<ScalarT, Cell, QuadPoint> const&    mid_plane) const;
+
+ public:  // Kokkos
+  struct pore_pressure_Tag
+  {
+  };
+  struct temperature_Tag
+  {
+  };
+  struct transport_Tag
+  {
+  };
+  struct hydro_stress_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, pore_pressure_Tag> pore_pressure_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, temperature_Tag>   temperature_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, transport_Tag>     transport_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, hydro_stress_Tag>  hydro_stress_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const pore_pressure_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const temperature_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const transport_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const hydro_stress_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
@@ -133,87 +133,68 @@ SurfaceScalarJump<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupDa
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceScalarJump<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::computeJump(
+    int const                                        cell,
+    PHX::MDField<ScalarT const, Cell, Vertex> const& nodal,
+    PHX::MDField<ScalarT, Cell, QuadPoint> const&    jump,
+    PHX::MDField<ScalarT, Cell, QuadPoint> const&    mid_plane) const
 {
   ScalarT scalarA(0.0), scalarB(0.0);
-  /*
-  for (int cell=0; cell < workset.numCells; ++cell) {
-    for (int pt=0; pt < numQPs; ++pt) {
-      scalarA = 0.0;
-      scalarB = 0.0;
-      for (int node=0; node < numPlaneNodes; ++node) {
-        int topNode = node + numPlaneNodes;
-                scalarA += refValues(node, pt) * scalar(cell, node);
-                scalarB += refValues(node, pt) * scalar(cell, topNode);
-      }
-      scalarJump(cell,pt) = scalarB - scalarA;
-      scalarAverage(cell,pt) = 0.5*(scalarB + scalarA);
-    }
-  }
-  */
-  if (havePorePressure) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalPorePressure(cell, node);
-          scalarB += refValues(node, pt) * nodalPorePressure(cell, topNode);
-        }
-        jumpPorePressure(cell, pt)     = scalarB - scalarA;
-        midPlanePorePressure(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
-  }
-  if (haveTemperature) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalTemperature(cell, node);
-          scalarB += refValues(node, pt) * nodalTemperature(cell, topNode);
-        }
-        jumpTemperature(cell, pt)     = scalarB - scalarA;
-        midPlaneTemperature(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
+  for (int pt = 0; pt < numQPs; ++pt) {
+    scalarA = 0.0;
+    scalarB = 0.0;
+    for (int node = 0; node < numPlaneNodes; ++node) {
+      int topNode = node + numPlaneNodes;
+      scalarA += refValues(node, pt) * nodal(cell, node);
+      scalarB += refValues(node, pt) * nodal(cell, topNode);
     }
+    jump(cell, pt)      = scalarB - scalarA;
+    mid_plane(cell, pt) = 0.5 * (scalarB + scalarA);
   }
+}
 
-  if (haveTransport) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalTransport(cell, node);
-          scalarB += refValues(node, pt) * nodalTransport(cell, topNode);
-        }
-        jumpTransport(cell, pt)     = scalarB - scalarA;
-        midPlaneTransport(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
-  }
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::operator()(const pore_pressure_Tag& tag, const int& cell) const
+{
+  computeJump(cell, nodalPorePressure, jumpPorePressure, midPlanePorePressure);
+}
 
-  if (haveHydroStress) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalHydroStress(cell, node);
-          scalarB += refValues(node, pt) * nodalHydroStress(cell, topNode);
-        }
-        jumpHydroStress(cell, pt)     = scalarB - scalarA;
-        midPlaneHydroStress(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
-  }
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::operator()(const temperature_Tag& tag, const int& cell) const
+{
+  computeJump(cell, nodalTemperature, jumpTemperature, midPlaneTemperature);
+}
+
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::operator()(const transport_Tag& tag, const int& cell) const
+{
+  computeJump(cell, nodalTransport, jumpTransport, midPlaneTransport);
+}
+
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::operator()(const hydro_stress_Tag& tag, const int& cell) const
+{
+  computeJump(cell, nodalHydroStress, jumpHydroStress, midPlaneHydroStress);
+}
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceScalarJump<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  if (havePorePressure) Kokkos::parallel_for(pore_pressure_Policy(0, workset.numCells), *this);
+  if (haveTemperature) Kokkos::parallel_for(temperature_Policy(0, workset.numCells), *this);
+  if (haveTransport) Kokkos::parallel_for(transport_Policy(0, workset.numCells), *this);
+  if (haveHydroStress) Kokkos::parallel_for(hydro_stress_Policy(0, workset.numCells), *this);
 }
 
 //*****
@@ -6,6 +6,7 @@
 #define SURFACE_TL_PORO_MASS_RESIDUAL_HPP
 
 #include "Albany_Layouts.hpp"
+#include "Albany_StateInfoStruct.hpp"
 #include "Albany_Types.hpp"
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
@@ -76,6 +77,10 @@ class SurfaceTLPoroMassResidual : public PHX::EvaluatorWithBaseImpl<Traits>, pub
   //! Data from previous time step
   std::string porePressureName, JName;
 
+  //! Old pore pressure and J, set for each workset
+  Albany::MDArray porePressureold;
+  Albany::MDArray Jold;
+
   //! Reference Cell Views
   Kokkos::DynRankView<RealType, PHX::Device> refValues;
   Kokkos::DynRankView<RealType, PHX::Device> refGrads;
@@ -105,6 +110,19 @@ class SurfaceTLPoroMassResidual : public PHX::EvaluatorWithBaseImpl<Traits>, pub
   unsigned int numPlaneDims;
 
   bool haveMech;
+
+ public:  // Kokkos
+  struct poro_mass_residual_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, poro_mass_residual_Tag> poro_mass_residual_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const poro_mass_residual_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
@@ -131,6 +131,54 @@ SurfaceTLPoroMassResidual<EvalT, Traits>::postRegistrationSetup(typename Traits:
   intrepidBasis->getValues(refGrads, refPoints, Intrepid2::OPERATOR_GRAD);
 }
 
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceTLPoroMassResidual<EvalT, Traits>::operator()(const poro_mass_residual_Tag& tag, const int& cell) const
+{
+  ScalarT dt = deltaTime(0);
+
+  for (int node(0); node < numPlaneNodes; ++node) {
+    // initialize the residual
+    int topNode                     = node + numPlaneNodes;
+    poroMassResidual(cell, topNode) = 0.0;
+    poroMassResidual(cell, node)    = 0.0;
+  }
+
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode = node + numPlaneNodes;
+
+    for (int pt = 0; pt < numQPs; ++pt) {
+      // If there is no diffusion, then the residual defines only on the
+      // mid-plane value
+
+      // Local Rate of Change volumetric constraint term
+      poroMassResidual(cell, node) -= refValues(node, pt) *
+                                      (std::log(J(cell, pt) / Jold(cell, pt)) * biotCoefficient(cell, pt) +
+                                       (porePressure(cell, pt) - porePressureold(cell, pt)) / biotModulus(cell, pt)) *
+                                      refArea(cell, pt);
+
+      poroMassResidual(cell, topNode) -= refValues(node, pt) *
+                                         (std::log(J(cell, pt) / Jold(cell, pt)) * biotCoefficient(cell, pt) +
+                                          (porePressure(cell, pt) - porePressureold(cell, pt)) / biotModulus(cell, pt)) *
+                                         refArea(cell, pt);
+
+    }  // end integrartion point loop
+  }    //  end plane node loop
+
+  for (int node(0); node < numPlaneNodes; ++node) {
+    int topNode = node + numPlaneNodes;
+
+    for (int pt = 0; pt < numQPs; ++pt) {
+      for (int dim = 0; dim < numDims; ++dim) {
+        poroMassResidual(cell, node) -= flux(cell, pt, dim) * dt * surface_Grad_BF(cell, node, pt, dim) * refArea(cell, pt);
+
+        poroMassResidual(cell, topNode) -= flux(cell, pt, dim) * dt * surface_Grad_BF(cell, topNode, pt, dim) * refArea(cell, pt);
+      }
+    }
+  }
+}
+
 //*****
 template <typename EvalT, typename Traits>
 void
@@ -139,14 +187,11 @@ SurfaceTLPoroMassResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalDa
   typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
   typedef Intrepid2::RealSpaceTools<PHX::Device>     RST;
 
-  Albany::MDArray porePressureold = (*workset.stateArrayPtr)[porePressureName];
-  Albany::MDArray Jold;
+  porePressureold = (*workset.stateArrayPtr)[porePressureName];
   if (haveMech) {
     Jold = (*workset.stateArrayPtr)[JName];
   }
 
-  ScalarT dt = deltaTime(0);
-
   // THE INTREPID REALSPACE TOOLS AND FUNCTION SPACE TOOLS NEED TO BE REMOVED!!!
   // Compute pore fluid flux
   if (haveMech) {
@@ -164,51 +209,7 @@ SurfaceTLPoroMassResidual<EvalT, Traits>::evaluateFields(typename Traits::EvalDa
                                 scalarGrad.get_view());  // flux_i = kc p_i
   }
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      // initialize the residual
-      int topNode                     = node + numPlaneNodes;
-      poroMassResidual(cell, topNode) = 0.0;
-      poroMassResidual(cell, node)    = 0.0;
-    }
-  }
-
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode = node + numPlaneNodes;
-
-      for (int pt = 0; pt < numQPs; ++pt) {
-        // If there is no diffusion, then the residual defines only on the
-        // mid-plane value
-
-        // Local Rate of Change volumetric constraint term
-        poroMassResidual(cell, node) -= refValues(node, pt) *
-                                        (std::log(J(cell, pt) / Jold(cell, pt)) * biotCoefficient(cell, pt) +
-                                         (porePressure(cell, pt) - porePressureold(cell, pt)) / biotModulus(cell, pt)) *
-                                        refArea(cell, pt);
-
-        poroMassResidual(cell, topNode) -= refValues(node, pt) *
-                                           (std::log(J(cell, pt) / Jold(cell, pt)) * biotCoefficient(cell, pt) +
-                                            (porePressure(cell, pt) - porePressureold(cell, pt)) / biotModulus(cell, pt)) *
-                                           refArea(cell, pt);
-
-      }  // end integrartion point loop
-    }    //  end plane node loop
-  }      // end cell loop
-
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int node(0); node < numPlaneNodes; ++node) {
-      int topNode = node + numPlaneNodes;
-
-      for (int pt = 0; pt < numQPs; ++pt) {
-        for (int dim = 0; dim < numDims; ++dim) {
-          poroMassResidual(cell, node) -= flux(cell, pt, dim) * dt * surface_Grad_BF(cell, node, pt, dim) * refArea(cell, pt);
-
-          poroMassResidual(cell, topNode) -= flux(cell, pt, dim) * dt * surface_Grad_BF(cell, topNode, pt, dim) * refArea(cell, pt);
-        }
-      }
-    }
-  }
+  Kokkos::parallel_for(poro_mass_residual_Policy(0, workset.numCells), *this);
 }
 //*****
 }  // namespace LCM
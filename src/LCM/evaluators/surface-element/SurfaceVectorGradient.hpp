@@ -67,6 +67,26 @@ class SurfaceVectorGradient : public PHX::EvaluatorWithBaseImpl<Traits>, public
 
   //! stabilization parameter for the weighted average
   ScalarT alpha;
+
+ public:  // Kokkos
+  struct def_grad_Tag
+  {
+  };
+  struct weighted_average_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, def_grad_Tag>         def_grad_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, weighted_average_Tag> weighted_average_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const def_grad_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const weighted_average_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
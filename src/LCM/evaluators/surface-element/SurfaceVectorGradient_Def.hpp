@@ -68,69 +68,79 @@ SurfaceVectorGradient<EvalT, Traits>::postRegistrationSetup(typename Traits::Set
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceVectorGradient<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceVectorGradient<EvalT, Traits>::operator()(const def_grad_Tag& tag, const int& cell) const
 {
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < numQPs; ++pt) {
-      minitensor::Vector<ScalarT> g_0(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 0, 0);
+  for (int pt = 0; pt < numQPs; ++pt) {
+    minitensor::Vector<ScalarT, 3> g_0(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 0, 0);
 
-      minitensor::Vector<ScalarT> g_1(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 1, 0);
+    minitensor::Vector<ScalarT, 3> g_1(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 1, 0);
 
-      minitensor::Vector<ScalarT> g_2(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 2, 0);
+    minitensor::Vector<ScalarT, 3> g_2(minitensor::Source::ARRAY, 3, currentBasis, cell, pt, 2, 0);
 
-      minitensor::Vector<MeshScalarT> G_2(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
+    minitensor::Vector<MeshScalarT, 3> G_2(minitensor::Source::ARRAY, 3, refNormal, cell, pt, 0);
 
-      minitensor::Vector<ScalarT> d(minitensor::Source::ARRAY, 3, jump, cell, pt, 0);
+    minitensor::Vector<ScalarT, 3> d(minitensor::Source::ARRAY, 3, jump, cell, pt, 0);
 
-      minitensor::Vector<MeshScalarT> G0(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
+    minitensor::Vector<MeshScalarT, 3> G0(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 0, 0);
 
-      minitensor::Vector<MeshScalarT> G1(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 1, 0);
+    minitensor::Vector<MeshScalarT, 3> G1(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 1, 0);
 
-      minitensor::Vector<MeshScalarT> G2(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 2, 0);
+    minitensor::Vector<MeshScalarT, 3> G2(minitensor::Source::ARRAY, 3, refDualBasis, cell, pt, 2, 0);
 
-      minitensor::Tensor<ScalarT> Fpar(minitensor::bun(g_0, G0) + minitensor::bun(g_1, G1) + minitensor::bun(g_2, G2));
-      // for Jay: bun()
-      minitensor::Tensor<ScalarT> Fper((1 / thickness) * minitensor::bun(d, G_2));
+    minitensor::Tensor<ScalarT, 3> Fpar(minitensor::bun(g_0, G0) + minitensor::bun(g_1, G1) + minitensor::bun(g_2, G2));
+    // for Jay: bun()
+    minitensor::Tensor<ScalarT, 3> Fper((1 / thickness) * minitensor::bun(d, G_2));
 
-      minitensor::Tensor<ScalarT> F = Fpar + Fper;
+    minitensor::Tensor<ScalarT, 3> F = Fpar + Fper;
 
-      defGrad(cell, pt, 0, 0) = F(0, 0);
-      defGrad(cell, pt, 0, 1) = F(0, 1);
-      defGrad(cell, pt, 0, 2) = F(0, 2);
-      defGrad(cell, pt, 1, 0) = F(1, 0);
-      defGrad(cell, pt, 1, 1) = F(1, 1);
-      defGrad(cell, pt, 1, 2) = F(1, 2);
-      defGrad(cell, pt, 2, 0) = F(2, 0);
-      defGrad(cell, pt, 2, 1) = F(2, 1);
-      defGrad(cell, pt, 2, 2) = F(2, 2);
-      J(cell, pt)             = minitensor::det(F);
-    }
+    defGrad(cell, pt, 0, 0) = F(0, 0);
+    defGrad(cell, pt, 0, 1) = F(0, 1);
+    defGrad(cell, pt, 0, 2) = F(0, 2);
+    defGrad(cell, pt, 1, 0) = F(1, 0);
+    defGrad(cell, pt, 1, 1) = F(1, 1);
+    defGrad(cell, pt, 1, 2) = F(1, 2);
+    defGrad(cell, pt, 2, 0) = F(2, 0);
+    defGrad(cell, pt, 2, 1) = F(2, 1);
+    defGrad(cell, pt, 2, 2) = F(2, 2);
+    J(cell, pt)             = minitensor::det(F);
   }
+}
 
-  if (weightedAverage) {
-    ScalarT Jbar, wJbar, vol;
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      Jbar = 0.0;
-      vol  = 0.0;
-      for (int qp = 0; qp < numQPs; ++qp) {
-        Jbar += weights(cell, qp) * std::log(J(cell, qp));
-        vol += weights(cell, qp);
-      }
-      Jbar /= vol;
-
-      // Jbar = std::exp(Jbar);
-      for (int qp = 0; qp < numQPs; ++qp) {
-        for (int i = 0; i < numDims; ++i) {
-          for (int j = 0; j < numDims; ++j) {
-            wJbar = std::exp((1 - alpha) * Jbar + alpha * std::log(J(cell, qp)));
-            defGrad(cell, qp, i, j) *= std::pow(wJbar / J(cell, qp), 1. / 3.);
-          }
-        }
-        J(cell, qp) = wJbar;
+//*****
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceVectorGradient<EvalT, Traits>::operator()(const weighted_average_Tag& tag, const int& cell) const
+{
+  ScalarT Jbar, wJbar, vol;
+  Jbar = 0.0;
+  vol  = 0.0;
+  for (int qp = 0; qp < numQPs; ++qp) {
+    Jbar += weights(cell, qp) * std::log(J(cell, qp));
+    vol += weights(cell, qp);
+  }
+  Jbar /= vol;
+
+  // Jbar = std::exp(Jbar);
+  for (int qp = 0; qp < numQPs; ++qp) {
+    for (int i = 0; i < numDims; ++i) {
+      for (int j = 0; j < numDims; ++j) {
+        wJbar = std::exp((1 - alpha) * Jbar + alpha * std::log(J(cell, qp)));
+        defGrad(cell, qp, i, j) *= std::pow(wJbar / J(cell, qp), 1. / 3.);
       }
     }
+    J(cell, qp) = wJbar;
   }
 }
+
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceVectorGradient<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(def_grad_Policy(0, workset.numCells), *this);
+
+  if (weightedAverage) Kokkos::parallel_for(weighted_average_Policy(0, workset.numCells), *this);
+}
 //*****
 }  // namespace LCM
@@ -62,6 +62,19 @@ class SurfaceVectorJump : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX:
   unsigned int                                num_dims_;
   unsigned int                                num_plane_nodes_;
   unsigned int                                num_plane_dims_;
+
+ public:  // Kokkos
+  struct vector_jump_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, vector_jump_Tag> vector_jump_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const vector_jump_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
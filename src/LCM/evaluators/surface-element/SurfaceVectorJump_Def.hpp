@@ -67,31 +67,37 @@ SurfaceVectorJump<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupDa
 
 //*****
 template <typename EvalT, typename Traits>
-void
-SurfaceVectorJump<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceVectorJump<EvalT, Traits>::operator()(const vector_jump_Tag& tag, const int& cell) const
 {
-  minitensor::Vector<ScalarT> vecA(0, 0, 0), vecB(0, 0, 0), vecJump(0, 0, 0);
-
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < num_qps_; ++pt) {
-      vecA.fill(minitensor::Filler::ZEROS);
-      vecB.fill(minitensor::Filler::ZEROS);
-      for (int node = 0; node < num_plane_nodes_; ++node) {
-        int topNode = node + num_plane_nodes_;
-        vecA += minitensor::Vector<ScalarT>(
-            ref_values_(node, pt) * vector_(cell, node, 0), ref_values_(node, pt) * vector_(cell, node, 1), ref_values_(node, pt) * vector_(cell, node, 2));
-        vecB += minitensor::Vector<ScalarT>(
-            ref_values_(node, pt) * vector_(cell, topNode, 0),
-            ref_values_(node, pt) * vector_(cell, topNode, 1),
-            ref_values_(node, pt) * vector_(cell, topNode, 2));
-      }
-      vecJump            = vecB - vecA;
-      jump_(cell, pt, 0) = vecJump(0);
-      jump_(cell, pt, 1) = vecJump(1);
-      jump_(cell, pt, 2) = vecJump(2);
+  minitensor::Vector<ScalarT, 3> vecA(0, 0, 0), vecB(0, 0, 0), vecJump(0, 0, 0);
+
+  for (int pt = 0; pt < num_qps_; ++pt) {
+    vecA.fill(minitensor::Filler::ZEROS);
+    vecB.fill(minitensor::Filler::ZEROS);
+    for (int node = 0; node < num_plane_nodes_; ++node) {
+      int topNode = node + num_plane_nodes_;
+      vecA += minitensor::Vector<ScalarT, 3>(
+          ref_values_(node, pt) * vector_(cell, node, 0), ref_values_(node, pt) * vector_(cell, node, 1), ref_values_(node, pt) * vector_(cell, node, 2));
+      vecB += minitensor::Vector<ScalarT, 3>(
+          ref_values_(node, pt) * vector_(cell, topNode, 0),
+          ref_values_(node, pt) * vector_(cell, topNode, 1),
+          ref_values_(node, pt) * vector_(cell, topNode, 2));
     }
+    vecJump            = vecB - vecA;
+    jump_(cell, pt, 0) = vecJump(0);
+    jump_(cell, pt, 1) = vecJump(1);
+    jump_(cell, pt, 2) = vecJump(2);
   }
 }
 
+//*****
+template <typename EvalT, typename Traits>
+void
+SurfaceVectorJump<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(vector_jump_Policy(0, workset.numCells), *this);
+}
+
 //*****
 }  // namespace LCM
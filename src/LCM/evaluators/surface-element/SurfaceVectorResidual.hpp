@@ -102,6 +102,26 @@ class SurfaceVectorResidual : public PHX::EvaluatorWithBaseImpl<Traits>, public
 
   /// Topology modification for adaptive insertion flag.
   bool have_topmod_adaptation_;
+
+ public:  // Kokkos
+  struct vector_residual_Tag
+  {
+  };
+  struct cauchy_stress_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, vector_residual_Tag> vector_residual_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, cauchy_stress_Tag>   cauchy_stress_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const vector_residual_Tag& tag, const int& cell) const;
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const cauchy_stress_Tag& tag, const int& cell) const;
 };
 }  // namespace LCM
 
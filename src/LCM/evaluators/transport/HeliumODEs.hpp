@@ -5,7 +5,10 @@
 #if !defined(HeliumODEs_hpp)
 #define HeliumODEs_hpp
 
+#include <vector>
+
 #include "Albany_Layouts.hpp"
+#include "MiniTensor.h"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
@@ -21,6 +24,12 @@ namespace LCM {
 ///   3. Bubble volume fraction
 /// We employ implicit integration (backward Euler)
 ///
+/// The points with tritium are gathered in a batch and integrated in
+/// parallel in RealType, for all evaluation types. For the derivative
+/// types, the sensitivities of the solution are recovered afterwards with
+/// one linear solve with the tangent at the solution (implicit function
+/// theorem), as the MiniSolvers do.
+///
 template <typename EvalT, typename Traits>
 class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::EvaluatorDerived<EvalT, Traits>
 {
@@ -46,6 +55,28 @@ class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalua
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
 
+  ///
+  /// Residual of the backward Euler step at x = (n1, nb, sb), for the
+  /// inputs d (diffusion coefficient), g (source) and dt of type T
+  ///
+  template <typename T>
+  minitensor::Vector<T, 3>
+  residual(minitensor::Vector<RealType, 3> const& x, RealType const* old, T const& d, T const& g, T const& dt) const;
+
+  ///
+  /// Derivative of the residual with respect to x
+  ///
+  minitensor::Tensor<RealType, 3>
+  tangent(minitensor::Vector<RealType, 3> const& x, RealType const d, RealType const dt) const;
+
+  ///
+  /// Integrate the point i of the batch: explicit predictor if needed,
+  /// then Newton. Stores the solution, and the tangent at it if
+  /// compute_tangent.
+  ///
+  void
+  integrate(int const i, RealType const dt, bool const compute_tangent);
+
   ///
   /// Input: total_concentration - addition of lattice and trapped
   ///        concentration
@@ -91,6 +122,17 @@ class HeliumODEs : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Evalua
   std::string he_concentration_name_;
   std::string total_bubble_density_name_;
   std::string bubble_volume_fraction_name_;
+
+  ///
+  /// Batch of the points with tritium: cell * num_pts_ + pt, inputs (n1,
+  /// nb and sb old, d, g old and g), solution and tangent at the solution
+  ///
+  std::vector<int>      batch_points_;
+  std::vector<RealType> batch_inputs_;
+  std::vector<RealType> batch_solutions_;
+  std::vector<RealType> batch_tangents_;
+
+  static constexpr int num_inputs_ = 6;
 };
 }  // namespace LCM
 
@@ -7,6 +7,8 @@
 #include <cmath>
 
 #include "Albany_MaterialDatabase.hpp"
+#include "Kokkos_Core.hpp"
+#include "MiniNonlinearSolver.hpp"
 
 namespace LCM {
 
@@ -21,6 +23,23 @@ lcm_cbrt(T const& x)
   return std::cbrt(x);
 }
 
+// Sensitivities of the solution x of r(x) = 0 from the ones of r, none
+// for RealType
+inline void
+recoverSensitivities(
+    minitensor::Vector<RealType, 3> const& /* r */,
+    minitensor::Tensor<RealType, 3> const& /* DrDx */,
+    minitensor::Vector<RealType, 3>& /* x */)
+{
+}
+
+template <typename T>
+void
+recoverSensitivities(minitensor::Vector<T, 3> const& r, minitensor::Tensor<RealType, 3> const& DrDx, minitensor::Vector<T, 3>& x)
+{
+  computeFADInfo(r, DrDx, x);
+}
+
 template <typename EvalT, typename Traits>
 HeliumODEs<EvalT, Traits>::HeliumODEs(Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
     : total_concentration_(p.get<std::string>("Total Concentration Name"), dl->qp_scalar),
@@ -78,25 +97,142 @@ HeliumODEs<EvalT, Traits>::postRegistrationSetup(typename Traits::SetupData d, P
 }
 
 template <typename EvalT, typename Traits>
-void
-HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+template <typename T>
+minitensor::Vector<T, 3>
+HeliumODEs<EvalT, Traits>::residual(minitensor::Vector<RealType, 3> const& x, RealType const* old, T const& d, T const& g, T const& dt) const
+{
+  double const pi           = acos(-1.0);
+  double const cub_tfpi     = std::cbrt(3.0 / 4.0 / pi);
+  double const atomic_omega = omega_ / avogadros_num_;
+
+  RealType const n1            = x(0);
+  RealType const nb            = x(1);
+  RealType const sb            = x(2);
+  RealType const cube_root_nb2 = lcm_cbrt(nb * nb);
+  RealType const cube_root_sb  = lcm_cbrt(sb);
+
+  minitensor::Vector<T, 3> r;
+  r(0) = n1 - old[0] - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 - 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+  r(1) = nb - old[1] - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
+  r(2) = sb - old[2] - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 + 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+  return r;
+}
+
+template <typename EvalT, typename Traits>
+minitensor::Tensor<RealType, 3>
+HeliumODEs<EvalT, Traits>::tangent(minitensor::Vector<RealType, 3> const& x, RealType const d, RealType const dt) const
 {
-  // Declaring time step & calculated input parameters
-  ScalarT dt;
-  ScalarT atomic_omega;
-  // Declaring tangent, residual, norms, and increment for N-R
-  minitensor::Tensor<ScalarT> tangent(3);
-  minitensor::Vector<ScalarT> residual(3);
-  ScalarT                     norm_residual_2, norm_residual_goal_2;
-  minitensor::Vector<ScalarT> increment(3);
+  double const pi              = acos(-1.0);
+  double const pi2             = pi * pi;
+  double const cube_root_pi2   = std::cbrt(pi2);
+  double const cube_root_2     = std::cbrt(2.0);
+  double const cube_root_6     = std::cbrt(6.0);
+  double const cube_root_9     = std::cbrt(9.0);
+  double const cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
+  double const atomic_omega    = omega_ / avogadros_num_;
+
+  // Common factors w/cube_root
+  RealType const n1            = x(0);
+  RealType const nb            = x(1);
+  RealType const sb            = x(2);
+  RealType const cube_root_nb  = lcm_cbrt(nb);
+  RealType const cube_root_nb2 = lcm_cbrt(nb * nb);
+  RealType const cube_root_sb  = lcm_cbrt(sb);
+  RealType const cube_root_sb2 = lcm_cbrt(sb * sb);
+
+  minitensor::Tensor<RealType, 3> t;
+  t(0, 0) = 1.0 + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb);
+  t(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 * cube_root_sb / cube_root_9 / cube_root_nb;
+  t(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * cube_root_pi2_9 / cube_root_sb2;
+  t(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
+  t(1, 1) = 1.0;
+  t(1, 2) = 0.0;
+  t(2, 0) = -2.0 * dt * d * atomic_omega * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
+  t(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega * cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
+  t(2, 2) = 1.0 - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
+  return t;
+}
 
+template <typename EvalT, typename Traits>
+void
+HeliumODEs<EvalT, Traits>::integrate(int const i, RealType const dt, bool const compute_tangent)
+{
   // tolarences and iterations for newton
   double const tolerance = 1.0e-12, tolerance_2 = tolerance * tolerance;
   int const    maxIterations = 20;  // FIXME: Currently a maximum, need relative measures
   // subincrementation for explicit predictor //FIXME: No guarantee of stability
-  ScalarT   dt_explicit;
   int const explicit_sub_increments = 5;
 
+  double const pi           = acos(-1.0);
+  double const cub_tfpi     = std::cbrt(3.0 / 4.0 / pi);
+  double const atomic_omega = omega_ / avogadros_num_;
+
+  RealType const* inputs = &batch_inputs_[num_inputs_ * i];
+  RealType const  n1_old = inputs[0];
+  RealType const  nb_old = inputs[1];
+  RealType const  sb_old = inputs[2];
+  RealType const  d      = inputs[3];
+  RealType const  g_old  = inputs[4];
+  RealType const  g      = inputs[5];
+
+  minitensor::Vector<RealType, 3> x(n1_old, nb_old, sb_old);
+
+  // check if old bubble density is small
+  // if small, use an explict guess to avoid issues with 1/nb and 1/sb in
+  // tangent
+  if (nb_old < tolerance) {
+    // explicit time integration for predictor
+    // Note that two or more steps are required to obtain a finite nb if
+    // the total_concentration_old is zero.
+    RealType const dt_explicit = dt / explicit_sub_increments;
+    RealType       n1_exp      = n1_old;
+    RealType       nb_exp      = nb_old;
+    RealType       sb_exp      = sb_old;
+
+    RealType const cube_root_nb_exp2 = lcm_cbrt(nb_exp * nb_exp);
+
+    for (int sub_increment = 0; sub_increment < explicit_sub_increments; sub_increment++) {
+      x(0) = n1_exp +
+             dt_explicit * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp - 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
+      x(1) = nb_exp + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
+      x(2) = sb_exp + atomic_omega / eta_ * dt_explicit *
+                          (32. * pi * he_radius_ * d * n1_exp * n1_exp + 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
+      n1_exp = x(0);
+      nb_exp = x(1);
+      sb_exp = x(2);
+    }
+  }
+
+  // calculate initial residual for a relative tolerance
+  minitensor::Vector<RealType, 3> r                    = residual(x, inputs, d, g, dt);
+  RealType                        norm_residual_2      = minitensor::norm_square(r);
+  RealType const                  norm_residual_goal_2 = tolerance_2 * norm_residual_2;
+  int                             iter(0);
+
+  // N-R loop for implicit time integration
+  while (norm_residual_2 > norm_residual_goal_2 && iter < maxIterations) {
+    x -= minitensor::inverse(tangent(x, d, dt)) * r;
+    r               = residual(x, inputs, d, g, dt);
+    norm_residual_2 = minitensor::norm_square(r);
+    iter++;
+  }
+
+  for (int j = 0; j < 3; ++j) batch_solutions_[3 * i + j] = x(j);
+  if (compute_tangent == false) return;
+
+  minitensor::Tensor<RealType, 3> const DrDx = tangent(x, d, dt);
+  for (int j = 0; j < 3; ++j) {
+    for (int k = 0; k < 3; ++k) batch_tangents_[9 * i + 3 * j + k] = DrDx(j, k);
+  }
+}
+
+template <typename EvalT, typename Traits>
+void
+HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  // points with less tritium are not integrated
+  double const tolerance = 1.0e-12;
+
   // state old
   Albany::MDArray total_concentration_old    = (*workset.stateArrayPtr)[total_concentration_name_];
   Albany::MDArray he_concentration_old       = (*workset.stateArrayPtr)[he_concentration_name_];
@@ -120,140 +256,72 @@ HeliumODEs<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   //   he_radius_ - radius of He atom
   //   eta_ - atoms per cluster (not variable)
 
-  // convert molar volume to atomic volume through avogadros_num_
-  atomic_omega = omega_ / avogadros_num_;
-
   // time step
-  dt = delta_time_(0);
-
-  // loop over cells and points for implicit time integration
-
-  // constants for computations
-  double const pi       = acos(-1.0);
-  double const onethrd  = 1.0 / 3.0;
-  double const twothrd  = 2.0 / 3.0;
-  double const cub_tfpi = std::cbrt(3.0 / 4.0 / pi);
-
-  // temporary variables
-  ScalarT n1_old, nb_old, sb_old, n1, nb, sb;
-  ScalarT n1_exp, nb_exp, sb_exp;
-  ScalarT d, g_old, g;
-
-  double const pi2             = pi * pi;
-  double const cube_root_pi2   = std::cbrt(pi2);
-  double const cube_root_2     = std::cbrt(2.0);
-  double const cube_root_6     = std::cbrt(6.0);
-  double const cube_root_9     = std::cbrt(9.0);
-  double const cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
-
+  ScalarT const  dt     = delta_time_(0);
+  RealType const dt_val = Sacado::ScalarValue<ScalarT>::eval(dt);
+
+  // determine if any tritium exists - note that concentration is in mol
+  // (not atoms) if no tritium exists, no need to solve the ODEs, and the
+  // point keeps its old values
+  batch_points_.clear();
+  batch_inputs_.clear();
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t pt = 0; pt < num_pts_; ++pt) {
-      // temporary variables
-      n1_old = he_concentration_old(cell, pt);
-      nb_old = total_bubble_density_old(cell, pt);
-      sb_old = bubble_volume_fraction_old(cell, pt);
-      n1     = n1_old;
-      nb     = nb_old;
-      sb     = sb_old;
-      d      = diffusion_coefficient_(cell, pt);
-
-      // determine if any tritium exists - note that concentration is in mol
-      // (not atoms) if no tritium exists, no need to solve the ODEs
       if (total_concentration_(cell, pt) > tolerance) {
         // source terms for helium bubble generation
-        g_old = avogadros_num_ * t_decay_constant_ * total_concentration_old(cell, pt);
-        g     = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
-
-        // check if old bubble density is small
-        // if small, use an explict guess to avoid issues with 1/nb and 1/sb in
-        // tangent
-
-        if (nb_old < tolerance) {
-          // explicit time integration for predictor
-          // Note that two or more steps are required to obtain a finite nb if
-          // the total_concentration_old is zero.
-          dt_explicit = dt / explicit_sub_increments;
-          n1_exp      = n1_old;
-          nb_exp      = nb_old;
-          sb_exp      = sb_old;
-
-          ScalarT const nb_exp2           = nb_exp * nb_exp;
-          ScalarT const cube_root_nb_exp2 = lcm_cbrt(nb_exp2);
-
-          for (int sub_increment = 0; sub_increment < explicit_sub_increments; sub_increment++) {
-            n1 = n1_exp +
-                 dt_explicit * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp - 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
-            nb = nb_exp + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
-            sb = sb_exp + atomic_omega / eta_ * dt_explicit *
-                              (32. * pi * he_radius_ * d * n1_exp * n1_exp + 4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) * cube_root_nb_exp2);
-            n1_exp = n1;
-            nb_exp = nb;
-            sb_exp = sb;
-          }
-        }
-
-        ScalarT nb2           = nb * nb;
-        ScalarT cube_root_nb2 = lcm_cbrt(nb2);
-        ScalarT cube_root_sb  = lcm_cbrt(sb);
-
-        // calculate initial residual for a relative tolerance
-        residual(0) = n1 - n1_old - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 - 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-        residual(2) =
-            sb - sb_old - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 + 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        norm_residual_2      = minitensor::norm_square(residual);
-        norm_residual_goal_2 = tolerance_2 * norm_residual_2;
-        int iter(0);
-
-        // N-R loop for implicit time integration
-        while (norm_residual_2 > norm_residual_goal_2 && iter < maxIterations) {
-          // Common factors w/cube_root
-          ScalarT cube_root_nb  = lcm_cbrt(nb);
-          nb2                   = nb * nb;
-          cube_root_nb2         = lcm_cbrt(nb2);
-          cube_root_sb          = lcm_cbrt(sb);
-          ScalarT sb2           = sb * sb;
-          ScalarT cube_root_sb2 = lcm_cbrt(sb2);
-
-          // calculate tangent
-          tangent(0, 0) = 1.0 + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb);
-          tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 * cube_root_sb / cube_root_9 / cube_root_nb;
-          tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * cube_root_pi2_9 / cube_root_sb2;
-          tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
-          tangent(1, 1) = 1.0;
-          tangent(1, 2) = 0.0;
-          tangent(2, 0) = -2.0 * dt * d * atomic_omega * (32.0 * n1 * pi * he_radius_ + cube_root_6 * cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
-          tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega * cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
-          tangent(2, 2) = 1.0 - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 * atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
-
-          // find increment
-          increment = -minitensor::inverse(tangent) * residual;
-
-          // update quantities
-          n1 = n1 + increment(0);
-          nb = nb + increment(1);
-          sb = sb + increment(2);
-
-          nb2           = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb  = lcm_cbrt(sb);
-
-          // find new residual and norm
-          residual(0) = n1 - n1_old - dt * (g - 32. * pi * he_radius_ * d * n1 * n1 - 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-          residual(2) =
-              sb - sb_old - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 + 4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          norm_residual_2 = minitensor::norm_square(residual);
-          iter++;
-        }
+        RealType const g_old = avogadros_num_ * t_decay_constant_ * total_concentration_old(cell, pt);
+        RealType const g     = avogadros_num_ * t_decay_constant_ * Sacado::ScalarValue<ScalarT>::eval(total_concentration_(cell, pt));
+
+        batch_points_.push_back(cell * num_pts_ + pt);
+        batch_inputs_.insert(
+            batch_inputs_.end(),
+            {he_concentration_old(cell, pt),
+             total_bubble_density_old(cell, pt),
+             bubble_volume_fraction_old(cell, pt),
+             Sacado::ScalarValue<ScalarT>::eval(diffusion_coefficient_(cell, pt)),
+             g_old,
+             g});
+        continue;
       }
+      he_concentration_(cell, pt)       = he_concentration_old(cell, pt);
+      total_bubble_density_(cell, pt)   = total_bubble_density_old(cell, pt);
+      bubble_volume_fraction_(cell, pt) = bubble_volume_fraction_old(cell, pt);
+    }
+  }
 
-      // Update global fields
+  // Integrate the batch in RealType. The tangents at the solutions are only
+  // needed for the sensitivities.
+  int const  num_batch   = batch_points_.size();
+  bool const sensitivity = Sacado::IsADType<ScalarT>::value;
+  batch_solutions_.resize(3 * num_batch);
+  if (sensitivity == true) batch_tangents_.resize(9 * num_batch);
+
+  Kokkos::parallel_for(
+      "LCM::HeliumODEs", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_batch), [&](int const i) { integrate(i, dt_val, sensitivity); });
+
+  // Update global fields
+  for (int i = 0; i < num_batch; ++i) {
+    int const                      cell = batch_points_[i] / num_pts_;
+    int const                      pt   = batch_points_[i] % num_pts_;
+    RealType const*                soln = &batch_solutions_[3 * i];
+    minitensor::Vector<ScalarT, 3> x(soln[0], soln[1], soln[2]);
+
+    if (sensitivity == true) {
+      minitensor::Vector<RealType, 3> const x_val(soln[0], soln[1], soln[2]);
+      minitensor::Tensor<RealType, 3>       DrDx;
+      for (int j = 0; j < 3; ++j) {
+        for (int k = 0; k < 3; ++k) DrDx(j, k) = batch_tangents_[9 * i + 3 * j + k];
+      }
 
-      he_concentration_(cell, pt)       = n1;
-      total_bubble_density_(cell, pt)   = nb;
-      bubble_volume_fraction_(cell, pt) = sb;
+      // Residual at the solution with the sensitivities of the inputs
+      ScalarT const                  g = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
+      minitensor::Vector<ScalarT, 3> r = residual<ScalarT>(x_val, &batch_inputs_[num_inputs_ * i], diffusion_coefficient_(cell, pt), g, dt);
+      recoverSensitivities(r, DrDx, x);
     }
+
+    he_concentration_(cell, pt)       = x(0);
+    total_bubble_density_(cell, pt)   = x(1);
+    bubble_volume_fraction_(cell, pt) = x(2);
   }
 }
 }  // namespace LCM
@@ -4,8 +4,11 @@
 
 #include "ACEcommon.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -83,30 +86,100 @@ LCM::twoDvectorFromFile(std::string const& filename)
   return m;
 }
 
-RealType
-LCM::interpolateVectors(std::vector<RealType> const& xv, std::vector<RealType> const& yv, RealType const x)
+LCM::InterpolationTable::InterpolationTable(std::vector<RealType> const& xv, std::vector<RealType> const& yv) : x_(xv), y_(yv)
+{
+  auto const n = x_.size();
+  ALBANY_ASSERT(n == y_.size(), "Vectors must have same size.\n");
+
+  sorted_ = std::is_sorted(x_.begin(), x_.end());
+  if (sorted_ == false || n < 3) return;
+
+  // Equal spacing up to round-off. The index found from it is corrected
+  // against the abscissae anyway, so the tolerance only matters for speed.
+  RealType const dx = (x_[n - 1] - x_[0]) / (n - 1);
+  if (dx <= 0.0) return;
+  uniform_ = true;
+  for (std::size_t i = 1; i < n; ++i) {
+    if (std::abs(x_[i] - x_[i - 1] - dx) > 1.0e-8 * dx) {
+      uniform_ = false;
+      break;
+    }
+  }
+  inv_dx_ = 1.0 / dx;
+}
+
+// First i with x_[i] >= x, or the last index if there is none.
+std::size_t
+LCM::InterpolationTable::index(RealType const x) const
 {
-  RealType y{0.0};
-  size_t   i{0};
+  auto const n = x_.size();
 
-  auto const n = xv.size();
-  ALBANY_ASSERT(n == yv.size(), "Vectors must have same size.\n");
+  if (sorted_ == false) {
+    std::size_t i{0};
+    while (x_[i] < x) {
+      if (i + 1 == n) break;
+      ++i;
+    }
+    return i;
+  }
 
-  while (xv[i] < x) {
-    if (i + 1 == n) break;
-    ++i;
+  if (uniform_ == true) {
+    RealType const s = std::ceil((x - x_[0]) * inv_dx_);
+    std::size_t    i = !(s > 0.0) ? 0 : s >= n - 1 ? n - 1 : static_cast<std::size_t>(s);
+    while (i > 0 && x_[i - 1] >= x) --i;
+    while (i + 1 < n && x_[i] < x) ++i;
+    return i;
   }
 
-  if (i == 0) {
-    y = yv[0];
-  } else if (i + 1 == n) {
-    y = yv[i];
-  } else {
-    RealType const dy    = yv[i] - yv[i - 1];
-    RealType const dx    = xv[i] - xv[i - 1];
-    RealType const slope = dy / dx;
-    y                    = yv[i - 1] + slope * (x - xv[i - 1]);
+  auto const it = std::lower_bound(x_.begin(), x_.end(), x);
+  return it == x_.end() ? n - 1 : it - x_.begin();
+}
+
+RealType
+LCM::InterpolationTable::operator()(RealType const x) const
+{
+  auto const n = x_.size();
+  auto const i = index(x);
+
+  if (i == 0) return y_[0];
+  if (i + 1 == n) return y_[i];
+
+  RealType const dy    = y_[i] - y_[i - 1];
+  RealType const dx    = x_[i] - x_[i - 1];
+  RealType const slope = dy / dx;
+  return y_[i - 1] + slope * (x - x_[i - 1]);
+}
+
+int
+LCM::DepthTableCache::addTable(InterpolationTable const& table)
+{
+  ALBANY_ASSERT(heights_.empty() == true, "Depth tables must be added before the cache is used.\n");
+  tables_.push_back(table);
+  return tables_.size() - 1;
+}
+
+void
+LCM::DepthTableCache::update(int const ws, int const point, RealType const height)
+{
+  auto const num_tables = tables_.size();
+  auto const w          = static_cast<std::size_t>(ws);
+  auto const p          = static_cast<std::size_t>(point);
+
+  if (w >= heights_.size()) {
+    heights_.resize(w + 1);
+    values_.resize(w + 1);
   }
+  auto& heights = heights_[w];
+  auto& values  = values_[w];
+  if (p >= heights.size()) {
+    heights.resize(p + 1, std::numeric_limits<RealType>::quiet_NaN());
+    values.resize((p + 1) * num_tables, 0.0);
+  }
+
+  if (heights[p] == height) return;
 
-  return y;
+  heights[p] = height;
+  for (std::size_t t = 0; t < num_tables; ++t) {
+    values[p * num_tables + t] = tables_[t].empty() == true ? 0.0 : tables_[t](height);
+  }
 }
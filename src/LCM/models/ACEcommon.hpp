@@ -24,8 +24,75 @@ operator<<(std::ostream& os, const std::vector<RealType>& t);
 std::vector<std::vector<RealType>>
 twoDvectorFromFile(std::string const& filename);
 
-RealType
-interpolateVectors(std::vector<RealType> const& xv, std::vector<RealType> const& yv, RealType const x);
+//
+// Piecewise linear table y(x) read from ACE input files, built once.
+// Lookup is by binary search, or by direct indexing when the abscissae
+// are equally spaced. The first and last ordinates are used outside the
+// table and for x in the last interval.
+//
+class InterpolationTable
+{
+ public:
+  InterpolationTable() = default;
+
+  InterpolationTable(std::vector<RealType> const& xv, std::vector<RealType> const& yv);
+
+  bool
+  empty() const
+  {
+    return x_.empty();
+  }
+
+  RealType
+  operator()(RealType const x) const;
+
+ private:
+  std::size_t
+  index(RealType const x) const;
+
+  std::vector<RealType> x_;
+  std::vector<RealType> y_;
+
+  bool     sorted_{false};
+  bool     uniform_{false};
+  RealType inv_dx_{0.0};
+};
+
+//
+// Values of a set of depth tables at the integration points of each
+// workset. They are recomputed for a point only when its height changes,
+// which happens when erosion modifies the mesh, instead of at every
+// evaluation.
+//
+class DepthTableCache
+{
+ public:
+  //! Register a table, return its index. Empty tables evaluate to zero.
+  int
+  addTable(InterpolationTable const& table);
+
+  bool
+  hasTable(int const table) const
+  {
+    return tables_[table].empty() == false;
+  }
+
+  //! Make sure point `point` of workset `ws` holds values for `height`.
+  void
+  update(int const ws, int const point, RealType const height);
+
+  RealType
+  value(int const ws, int const point, int const table) const
+  {
+    return values_[ws][point * tables_.size() + table];
+  }
+
+ private:
+  std::vector<InterpolationTable> tables_;
+
+  std::vector<std::vector<RealType>> heights_;
+  std::vector<std::vector<RealType>> values_;
+};
 
 namespace {
 
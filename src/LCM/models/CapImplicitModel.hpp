@@ -6,6 +6,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Layouts.hpp"
 #include "LCM/models/ConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -82,15 +84,15 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   compute_f(minitensor::Tensor<T>& sigma, minitensor::Tensor<T>& alpha, T& kappa);
 
   // unknow variable value list
-  std::vector<ScalarT>
+  std::array<ScalarT, 13>
   initialize(minitensor::Tensor<ScalarT>& sigmaVal, minitensor::Tensor<ScalarT>& alphaVal, ScalarT& kappaVal, ScalarT& dgammaVal);
 
   // local iteration jacobian
   void
   compute_ResidJacobian(
-      std::vector<ScalarT> const&         XXVal,
-      std::vector<ScalarT>&               R,
-      std::vector<ScalarT>&               dRdX,
+      std::array<ScalarT, 13> const&      XXVal,
+      std::array<ScalarT, 13>&            R,
+      std::array<ScalarT, 13 * 13>&       dRdX,
       const minitensor::Tensor<ScalarT>&  sigmaVal,
       const minitensor::Tensor<ScalarT>&  alphaVal,
       ScalarT const&                      kappaVal,
@@ -104,16 +106,16 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
   // derivative
   minitensor::Tensor<ScalarT>
-  compute_dfdsigma(std::vector<ScalarT> const& XX);
+  compute_dfdsigma(std::array<ScalarT, 13> const& XX);
 
   ScalarT
-  compute_dfdkappa(std::vector<ScalarT> const& XX);
+  compute_dfdkappa(std::array<ScalarT, 13> const& XX);
 
   minitensor::Tensor<ScalarT>
-  compute_dgdsigma(std::vector<ScalarT> const& XX);
+  compute_dgdsigma(std::array<ScalarT, 13> const& XX);
 
   minitensor::Tensor<DFadType>
-  compute_dgdsigma(std::vector<DFadType> const& XX);
+  compute_dgdsigma(std::array<DFadType, 13> const& XX);
 
   // hardening functions
   template <typename T>
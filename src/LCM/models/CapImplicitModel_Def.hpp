@@ -200,7 +200,7 @@ CapImplicitModel<EvalT, Traits>::computeState(typename Traits::EvalData workset,
       // define temporary trial stress, used in computing plastic strain
       minitensor::Tensor<ScalarT> sigmaTr = sigmaVal;
 
-      std::vector<ScalarT> XXVal(13);
+      std::array<ScalarT, 13> XXVal{};
 
       // check yielding
       ScalarT f = compute_f(sigmaVal, alphaVal, kappaVal);
@@ -214,9 +214,9 @@ CapImplicitModel<EvalT, Traits>::computeState(typename Traits::EvalData workset,
         bool    converged  = false;
         int     iter       = 0;
 
-        std::vector<ScalarT>                R(13);
-        std::vector<ScalarT>                dRdX(13 * 13);
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        std::array<ScalarT, 13>                      R{};
+        std::array<ScalarT, 13 * 13>                 dRdX{};
+        FixedLocalNonlinearSolver<EvalT, Traits, 13> solver;
 
         while (!converged) {
           // assemble residual vector and local Jacobian
@@ -241,7 +241,7 @@ CapImplicitModel<EvalT, Traits>::computeState(typename Traits::EvalData workset,
           //<< iter << "\nres = " << normR << "\nrelres = " << conv <<
           // std::endl;
 
-          std::vector<ScalarT> XXValK = XXVal;
+          std::array<ScalarT, 13> XXValK = XXVal;
           solver.solve(dRdX, XXValK, R);
 
           // put restrictions on kappa: only allows monotonic decreasing (cap
@@ -371,11 +371,10 @@ CapImplicitModel<EvalT, Traits>::compute_f(minitensor::Tensor<T>& sigma, miniten
 
 //------------------------ unknow variable value list ------------------------//
 template <typename EvalT, typename Traits>
-std::vector<typename CapImplicitModel<EvalT, Traits>::ScalarT>
-// std::vector<typename EvalT::ScalarT>
+std::array<typename CapImplicitModel<EvalT, Traits>::ScalarT, 13>
 CapImplicitModel<EvalT, Traits>::initialize(minitensor::Tensor<ScalarT>& sigmaVal, minitensor::Tensor<ScalarT>& alphaVal, ScalarT& kappaVal, ScalarT& dgammaVal)
 {
-  std::vector<ScalarT> XX(13);
+  std::array<ScalarT, 13> XX{};
 
   XX[0]  = sigmaVal(0, 0);
   XX[1]  = sigmaVal(1, 1);
@@ -398,18 +397,18 @@ CapImplicitModel<EvalT, Traits>::initialize(minitensor::Tensor<ScalarT>& sigmaVa
 template <typename EvalT, typename Traits>
 void
 CapImplicitModel<EvalT, Traits>::compute_ResidJacobian(
-    std::vector<ScalarT> const&         XXVal,
-    std::vector<ScalarT>&               R,
-    std::vector<ScalarT>&               dRdX,
+    std::array<ScalarT, 13> const&      XXVal,
+    std::array<ScalarT, 13>&            R,
+    std::array<ScalarT, 13 * 13>&       dRdX,
     const minitensor::Tensor<ScalarT>&  sigmaVal,
     const minitensor::Tensor<ScalarT>&  alphaVal,
     ScalarT const&                      kappaVal,
     minitensor::Tensor4<ScalarT> const& Celastic,
     bool                                kappa_flag)
 {
-  std::vector<DFadType> Rfad(13);
-  std::vector<DFadType> XX(13);
-  std::vector<ScalarT>  XXtmp(13);
+  std::array<DFadType, 13> Rfad{};
+  std::array<DFadType, 13> XX{};
+  std::array<ScalarT, 13>  XXtmp{};
 
   // initialize DFadType local unknown vector Xfad
   // Note that since Xfad is a temporary variable that gets changed within local
@@ -584,10 +583,10 @@ CapImplicitModel<EvalT, Traits>::compute_g(minitensor::Tensor<T>& sigma, miniten
 template <typename EvalT, typename Traits>
 minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::ScalarT>
 // minitensor::Tensor<typename EvalT::DFadType>
-CapImplicitModel<EvalT, Traits>::compute_dfdsigma(std::vector<ScalarT> const& XX)
+CapImplicitModel<EvalT, Traits>::compute_dfdsigma(std::array<ScalarT, 13> const& XX)
 {
-  std::vector<DFadType> XXFad(13);
-  std::vector<ScalarT>  XXtmp(13);
+  std::array<DFadType, 13> XXFad{};
+  std::array<ScalarT, 13>  XXtmp{};
 
   for (int i = 0; i < 13; ++i) {
     XXtmp[i] = Sacado::ScalarValue<ScalarT>::eval(XX[i]);
@@ -640,10 +639,10 @@ CapImplicitModel<EvalT, Traits>::compute_dfdsigma(std::vector<ScalarT> const& XX
 template <typename EvalT, typename Traits>
 typename CapImplicitModel<EvalT, Traits>::ScalarT
 // minitensor::Tensor<typename EvalT::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_dfdkappa(std::vector<ScalarT> const& XX)
+CapImplicitModel<EvalT, Traits>::compute_dfdkappa(std::array<ScalarT, 13> const& XX)
 {
-  std::vector<DFadType> XXFad(13);
-  std::vector<ScalarT>  XXtmp(13);
+  std::array<DFadType, 13> XXFad{};
+  std::array<ScalarT, 13>  XXtmp{};
 
   for (int i = 0; i < 13; ++i) {
     XXtmp[i] = Sacado::ScalarValue<ScalarT>::eval(XX[i]);
@@ -688,10 +687,10 @@ CapImplicitModel<EvalT, Traits>::compute_dfdkappa(std::vector<ScalarT> const& XX
 template <typename EvalT, typename Traits>
 minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::ScalarT>
 // minitensor::Tensor<typename EvalT::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_dgdsigma(std::vector<ScalarT> const& XX)
+CapImplicitModel<EvalT, Traits>::compute_dgdsigma(std::array<ScalarT, 13> const& XX)
 {
-  std::vector<DFadType> XXFad(13);
-  std::vector<ScalarT>  XXtmp(13);
+  std::array<DFadType, 13> XXFad{};
+  std::array<ScalarT, 13>  XXtmp{};
 
   for (int i = 0; i < 13; ++i) {
     XXtmp[i] = Sacado::ScalarValue<ScalarT>::eval(XX[i]);
@@ -744,11 +743,11 @@ CapImplicitModel<EvalT, Traits>::compute_dgdsigma(std::vector<ScalarT> const& XX
 template <typename EvalT, typename Traits>
 minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::DFadType>
 // minitensor::Tensor<typename EvalT::DFadType>
-CapImplicitModel<EvalT, Traits>::compute_dgdsigma(std::vector<DFadType> const& XX)
+CapImplicitModel<EvalT, Traits>::compute_dgdsigma(std::array<DFadType, 13> const& XX)
 {
-  std::vector<D2FadType> D2XX(13);
-  std::vector<DFadType>  XXFadtmp(13);
-  std::vector<ScalarT>   XXtmp(13);
+  std::array<D2FadType, 13> D2XX{};
+  std::array<DFadType, 13>  XXFadtmp{};
+  std::array<ScalarT, 13>   XXtmp{};
 
   for (int i = 0; i < 13; ++i) {
     XXtmp[i]    = Sacado::ScalarValue<ScalarT>::eval(XX[i].val());
@@ -881,7 +880,7 @@ CapImplicitModel<EvalT, Traits>::compute_Cep(
   // define variable
   minitensor::Tensor4<ScalarT> Cep(num_dims_);
 
-  std::vector<ScalarT> XX(13);
+  std::array<ScalarT, 13> XX{};
 
   minitensor::Tensor<ScalarT> dfdsigma;
   minitensor::Tensor<ScalarT> dfdalpha;
@@ -934,7 +933,7 @@ CapImplicitModel<EvalT, Traits>::compute_Cepp(
   // define variable
   minitensor::Tensor4<ScalarT> Cepp(num_dims_);
 
-  std::vector<ScalarT> XX(13);
+  std::array<ScalarT, 13> XX{};
 
   minitensor::Tensor<ScalarT> dfdsigma;
   minitensor::Tensor<ScalarT> dfdalpha;
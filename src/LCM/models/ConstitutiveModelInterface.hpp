@@ -69,6 +69,13 @@ class ConstitutiveModelInterface : public PHX::EvaluatorWithBaseImpl<Traits>, pu
   void
   initializeModel(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl);
 
+  ///
+  /// Names of the models that initializeModel can create, in alphabetical
+  /// order
+  ///
+  static std::vector<std::string>
+  modelNames();
+
   ///
   /// Retrieve SV name from the state variable registration struct
   ///
@@ -127,6 +134,21 @@ class ConstitutiveModelInterface : public PHX::EvaluatorWithBaseImpl<Traits>, pu
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
 
+  using ModelFactory = Teuchos::RCP<ConstitutiveModel<EvalT, Traits>> (*)(Teuchos::ParameterList*, const Teuchos::RCP<Albany::Layouts>&);
+
+  template <typename Model>
+  static Teuchos::RCP<ConstitutiveModel<EvalT, Traits>>
+  createModel(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl)
+  {
+    return Teuchos::rcp(new Model(p, dl));
+  }
+
+  ///
+  /// The models, by the name of the "Model Name" parameter
+  ///
+  static std::map<std::string, ModelFactory> const&
+  modelFactories();
+
   ///
   /// Dependent MDFields
   ///
@@ -230,95 +230,69 @@ ConstitutiveModelInterface<EvalT, Traits>::fillStateVariableStruct(int state_var
   sv_struct_.output_to_exodus   = model_->getStateVarOutputFlag(state_var);
 }
 
+template <typename EvalT, typename Traits>
+std::map<std::string, typename ConstitutiveModelInterface<EvalT, Traits>::ModelFactory> const&
+ConstitutiveModelInterface<EvalT, Traits>::modelFactories()
+{
+  static std::map<std::string, ModelFactory> const factories = {
+      {"AAA", &createModel<AAAModel<EvalT, Traits>>},
+      {"Anisotropic Damage", &createModel<AnisotropicDamageModel<EvalT, Traits>>},
+      {"AHD", &createModel<AnisotropicHyperelasticDamageModel<EvalT, Traits>>},
+      {"Viscoplastic", &createModel<AnisotropicViscoplasticModel<EvalT, Traits>>},
+      {"Cap Explicit", &createModel<CapExplicitModel<EvalT, Traits>>},
+      {"Cap Implicit", &createModel<CapImplicitModel<EvalT, Traits>>},
+      {"Cap Plasticity Explicit", &createModel<CapPlasticityExplicitFD<EvalT, Traits>>},
+      {"Creep", &createModel<CreepModel<EvalT, Traits>>},
+      {"CrystalPlasticity", &createModel<CrystalPlasticityModel<EvalT, Traits>>},
+      {"Drucker Prager", &createModel<DruckerPragerModel<EvalT, Traits>>},
+      {"ElasticCrystal", &createModel<ElasticCrystalModel<EvalT, Traits>>},
+      {"Elastic Damage", &createModel<ElasticDamageModel<EvalT, Traits>>},
+      {"Elasto Viscoplastic", &createModel<ElastoViscoplasticModel<EvalT, Traits>>},
+      {"Ferroic", &createModel<FerroicDriver<EvalT, Traits>>},
+      {"GursonHMR", &createModel<GursonHMRModel<EvalT, Traits>>},
+      {"Gurson", &createModel<GursonModel<EvalT, Traits>>},
+      {"Hyperelastic Damage", &createModel<HyperelasticDamageModel<EvalT, Traits>>},
+      {"J2 Erosion", &createModel<J2Erosion<EvalT, Traits>>},
+      {"J2Fiber", &createModel<J2FiberModel<EvalT, Traits>>},
+      {"J2 HMC", &createModel<J2HMCModel<EvalT, Traits>>},
+      {"J2 MiniSolver", &createModel<J2MiniSolver<EvalT, Traits>>},
+      {"J2", &createModel<J2Model<EvalT, Traits>>},
+      {"Linear Elastic", &createModel<LinearElasticModel<EvalT, Traits>>},
+      {"Linear Elastic Volumetric Deviatoric", &createModel<LinearElasticVolDevModel<EvalT, Traits>>},
+      {"Linear HMC", &createModel<LinearHMCModel<EvalT, Traits>>},
+      {"Linear Piezoelectric", &createModel<LinearPiezoModel<EvalT, Traits>>},
+      {"Mooney Rivlin", &createModel<MooneyRivlinModel<EvalT, Traits>>},
+      {"Neohookean", &createModel<NeohookeanModel<EvalT, Traits>>},
+      {"Newtonian Fluid", &createModel<NewtonianFluidModel<EvalT, Traits>>},
+      {"Ortiz Pandolfi", &createModel<OrtizPandolfiModel<EvalT, Traits>>},
+      {"Parallel Neohookean", &createModel<ParallelNeohookeanModel<EvalT, Traits>>},
+      {"RIHMR", &createModel<RIHMRModel<EvalT, Traits>>},
+      {"Saint Venant Kirchhoff", &createModel<StVenantKirchhoffModel<EvalT, Traits>>},
+      {"Tvergaard Hutchinson", &createModel<TvergaardHutchinsonModel<EvalT, Traits>>},
+      {"ViscoElastic", &createModel<ViscoElasticModel<EvalT, Traits>>},
+  };
+  return factories;
+}
+
+template <typename EvalT, typename Traits>
+std::vector<std::string>
+ConstitutiveModelInterface<EvalT, Traits>::modelNames()
+{
+  std::vector<std::string> names;
+  for (auto const& factory : modelFactories()) names.push_back(factory.first);
+  return names;
+}
+
 template <typename EvalT, typename Traits>
 void
 ConstitutiveModelInterface<EvalT, Traits>::initializeModel(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl)
 {
   std::string model_name = p->sublist("Material Model").get<std::string>("Model Name");
 
-  std::string const error_msg = "Undefined material model name";
-
-  Teuchos::RCP<ConstitutiveModel<EvalT, Traits>> model = Teuchos::null;
-
-  using Teuchos::rcp;
-
-  if (model_name == "") {
-    ALBANY_ABORT(error_msg);
-  } else if (model_name == "AAA") {
-    model = rcp(new AAAModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Anisotropic Damage") {
-    model = rcp(new AnisotropicDamageModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "AHD") {
-    model = rcp(new AnisotropicHyperelasticDamageModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Viscoplastic") {
-    model = rcp(new AnisotropicViscoplasticModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Cap Explicit") {
-    model = rcp(new CapExplicitModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Cap Implicit") {
-    model = rcp(new CapImplicitModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Cap Plasticity Explicit") {
-    model = rcp(new CapPlasticityExplicitFD<EvalT, Traits>(p, dl));
-  } else if (model_name == "Creep") {
-    model = rcp(new CreepModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "CrystalPlasticity") {
-    model = rcp(new CrystalPlasticityModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Drucker Prager") {
-    model = rcp(new DruckerPragerModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "ElasticCrystal") {
-    model = rcp(new ElasticCrystalModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Elastic Damage") {
-    model = rcp(new ElasticDamageModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Elasto Viscoplastic") {
-    model = rcp(new ElastoViscoplasticModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Ferroic") {
-    model = rcp(new FerroicDriver<EvalT, Traits>(p, dl));
-  } else if (model_name == "GursonHMR") {
-    model = rcp(new GursonHMRModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Gurson") {
-    model = rcp(new GursonModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Hyperelastic Damage") {
-    model = rcp(new HyperelasticDamageModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "J2 Erosion") {
-    model = rcp(new J2Erosion<EvalT, Traits>(p, dl));
-  } else if (model_name == "J2Fiber") {
-    model = rcp(new J2FiberModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "J2 HMC") {
-    model = rcp(new J2HMCModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "J2 MiniSolver") {
-    model = rcp(new J2MiniSolver<EvalT, Traits>(p, dl));
-  } else if (model_name == "J2") {
-    model = rcp(new J2Model<EvalT, Traits>(p, dl));
-  } else if (model_name == "Linear Elastic") {
-    model = rcp(new LinearElasticModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Linear Elastic Volumetric Deviatoric") {
-    model = rcp(new LinearElasticVolDevModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Linear HMC") {
-    model = rcp(new LinearHMCModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Linear Piezoelectric") {
-    model = rcp(new LinearPiezoModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Mooney Rivlin") {
-    model = rcp(new MooneyRivlinModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Neohookean") {
-    model = rcp(new NeohookeanModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Newtonian Fluid") {
-    model = rcp(new NewtonianFluidModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Ortiz Pandolfi") {
-    model = rcp(new OrtizPandolfiModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Parallel Neohookean") {
-    model = rcp(new ParallelNeohookeanModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "RIHMR") {
-    model = rcp(new RIHMRModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Saint Venant Kirchhoff") {
-    model = rcp(new StVenantKirchhoffModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "Tvergaard Hutchinson") {
-    model = rcp(new TvergaardHutchinsonModel<EvalT, Traits>(p, dl));
-  } else if (model_name == "ViscoElastic") {
-    model = rcp(new ViscoElasticModel<EvalT, Traits>(p, dl));
-  } else {
-    ALBANY_ABORT(error_msg);
-  }
+  auto const factory = modelFactories().find(model_name);
+  ALBANY_PANIC(factory == modelFactories().end(), "Undefined material model name");
 
-  this->model_ = model;
+  this->model_ = factory->second(p, dl);
 }
 
 }  // namespace LCM
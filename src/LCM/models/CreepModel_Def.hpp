@@ -5,6 +5,8 @@
 #define DEBUG_FREQ 100000000000
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Macros.hpp"
 #include "LocalNonlinearSolver.hpp"
 #include "Phalanx_DataLayout.hpp"
@@ -218,11 +220,11 @@ CreepModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
           ScalarT debug_dFdX[max_count + 1];
           ScalarT debug_res[max_count + 1];
 
-          LocalNonlinearSolver<EvalT, Traits> solver;
+          FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-          std::vector<ScalarT> F(1);
-          std::vector<ScalarT> dFdX(1);
-          std::vector<ScalarT> X(1);
+          std::array<ScalarT, 1> F;
+          std::array<ScalarT, 1> dFdX;
+          std::array<ScalarT, 1> X;
 
           X[0] = creep_initial_guess_;
 
@@ -348,11 +350,11 @@ CreepModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
         // smag_new = 0.0;
         dgam_plastic = 0.0;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F;
+        std::array<ScalarT, 1> dFdX;
+        std::array<ScalarT, 1> X;
 
         F[0]    = f;
         X[0]    = 0.0;
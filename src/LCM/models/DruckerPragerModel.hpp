@@ -7,6 +7,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Layouts.hpp"
 #include "LCM/models/ConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -87,14 +89,14 @@ class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   void
   ResidualJacobian(
-      std::vector<ScalarT>& X,
-      std::vector<ScalarT>& R,
-      std::vector<ScalarT>& dRdX,
-      ScalarT const         ptr,
-      ScalarT const         qtr,
-      ScalarT const         eqN,
-      ScalarT const         mu,
-      ScalarT const         kappa);
+      std::array<ScalarT, 4>&  X,
+      std::array<ScalarT, 4>&  R,
+      std::array<ScalarT, 16>& dRdX,
+      ScalarT const            ptr,
+      ScalarT const            qtr,
+      ScalarT const            eqN,
+      ScalarT const            mu,
+      ScalarT const            kappa);
 };
 }  // namespace LCM
 
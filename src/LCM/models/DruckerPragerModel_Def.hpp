@@ -121,9 +121,9 @@ DruckerPragerModel<EvalT, Traits>::computeState(typename Traits::EvalData workse
   ScalarT Phi;
 
   // local unknowns and residual vectors
-  std::vector<ScalarT> X(4);
-  std::vector<ScalarT> R(4);
-  std::vector<ScalarT> dRdX(16);
+  std::array<ScalarT, 4>  X{};
+  std::array<ScalarT, 4>  R{};
+  std::array<ScalarT, 16> dRdX{};
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
@@ -182,7 +182,7 @@ DruckerPragerModel<EvalT, Traits>::computeState(typename Traits::EvalData workse
         X[2] = alpha;
         X[3] = deq;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 4> solver;
         int                                 iter = 0;
         ScalarT                             norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
 
@@ -250,23 +250,23 @@ DruckerPragerModel<EvalT, Traits>::computeState(typename Traits::EvalData workse
 template <typename EvalT, typename Traits>
 void
 DruckerPragerModel<EvalT, Traits>::ResidualJacobian(
-    std::vector<ScalarT>& X,
-    std::vector<ScalarT>& R,
-    std::vector<ScalarT>& dRdX,
-    ScalarT const         ptr,
-    ScalarT const         qtr,
-    ScalarT const         eqN,
-    ScalarT const         mu,
-    ScalarT const         kappa)
+    std::array<ScalarT, 4>&  X,
+    std::array<ScalarT, 4>&  R,
+    std::array<ScalarT, 16>& dRdX,
+    ScalarT const            ptr,
+    ScalarT const            qtr,
+    ScalarT const            eqN,
+    ScalarT const            mu,
+    ScalarT const            kappa)
 {
-  std::vector<DFadType> Rfad(4);
-  std::vector<DFadType> Xfad(4);
+  std::array<DFadType, 4> Rfad{};
+  std::array<DFadType, 4> Xfad{};
   // initialize DFadType local unknown vector Xfad
   // Note that since Xfad is a temporary variable
   // that gets changed within local iterations
   // when we initialize Xfad, we only pass in the values of X,
   // NOT the system sensitivity information
-  std::vector<ScalarT> Xval(4);
+  std::array<ScalarT, 4> Xval{};
   for (int i = 0; i < 4; ++i) {
     Xval[i] = Sacado::ScalarValue<ScalarT>::eval(X[i]);
     Xfad[i] = DFadType(4, i, Xval[i]);
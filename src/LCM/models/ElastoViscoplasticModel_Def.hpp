@@ -4,6 +4,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Macros.hpp"
 #include "LocalNonlinearSolver.hpp"
 #include "Phalanx_DataLayout.hpp"
@@ -437,13 +439,14 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(typename Traits::EvalData w
           ScalarT n = flow_exp(cell, pt);
 
           // This solver deals with Sacado type info
-          LocalNonlinearSolver<EvalT, Traits> solver;
+          constexpr int num_vars(5);
+
+          FixedLocalNonlinearSolver<EvalT, Traits, num_vars> solver;
 
-          // create some vectors to store solver data
-          int const            num_vars(5);
-          std::vector<ScalarT> R(num_vars);
-          std::vector<ScalarT> dRdX(num_vars * num_vars);
-          std::vector<ScalarT> X(num_vars);
+          // create some arrays to store solver data
+          std::array<ScalarT, num_vars>            R;
+          std::array<ScalarT, num_vars * num_vars> dRdX;
+          std::array<ScalarT, num_vars>            X;
 
           // FIXME: the initial guess needs some work, not active
           // initial guess
@@ -488,9 +491,9 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(typename Traits::EvalData w
           while (!converged) {
             // set up data types
             // again inside this loop everything is a local 'Fad'
-            std::vector<Fad>     XFad(num_vars);
-            std::vector<Fad>     RFad(num_vars);
-            std::vector<ScalarT> Xval(num_vars);
+            std::array<Fad, num_vars>     XFad;
+            std::array<Fad, num_vars>     RFad;
+            std::array<ScalarT, num_vars> Xval;
             for (std::size_t i = 0; i < num_vars; ++i) {
               Xval[i] = Sacado::ScalarValue<ScalarT>::eval(X[i]);
               XFad[i] = Fad(num_vars, i, Xval[i]);
@@ -7,6 +7,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Layouts.hpp"
 #include "LCM/models/ConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -108,9 +110,9 @@ class GursonHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   void
   ResidualJacobian(
-      std::vector<ScalarT>&        X,
-      std::vector<ScalarT>&        R,
-      std::vector<ScalarT>&        dRdX,
+      std::array<ScalarT, 4>&      X,
+      std::array<ScalarT, 4>&      R,
+      std::array<ScalarT, 16>&     dRdX,
       ScalarT const&               p,
       ScalarT const&               fvoid,
       ScalarT const&               es,
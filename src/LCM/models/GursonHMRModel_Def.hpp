@@ -149,11 +149,11 @@ GursonHMRModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, D
   ScalarT fvoid, eq, es, isoH, Phi, dgam, Ybar;
 
   // local unknowns and residual vectors
-  std::vector<ScalarT>                X(4);
-  std::vector<ScalarT>                R(4);
-  std::vector<ScalarT>                dRdX(16);
-  ScalarT                             norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  std::array<ScalarT, 4>                      X{};
+  std::array<ScalarT, 4>                      R{};
+  std::array<ScalarT, 16>                     dRdX{};
+  ScalarT                                     norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
+  FixedLocalNonlinearSolver<EvalT, Traits, 4> solver;
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
@@ -373,9 +373,9 @@ GursonHMRModel<EvalT, Traits>::YieldFunction(
 template <typename EvalT, typename Traits>
 void
 GursonHMRModel<EvalT, Traits>::ResidualJacobian(
-    std::vector<ScalarT>&        X,
-    std::vector<ScalarT>&        R,
-    std::vector<ScalarT>&        dRdX,
+    std::array<ScalarT, 4>&      X,
+    std::array<ScalarT, 4>&      R,
+    std::array<ScalarT, 16>&     dRdX,
     ScalarT const&               p,
     ScalarT const&               fvoid,
     ScalarT const&               es,
@@ -387,16 +387,16 @@ GursonHMRModel<EvalT, Traits>::ResidualJacobian(
     ScalarT const&               Rd,
     ScalarT const&               jacobian)
 {
-  ScalarT               sq32 = std::sqrt(3.0 / 2.0);
-  ScalarT               sq23 = std::sqrt(2.0 / 3.0);
-  std::vector<DFadType> Rfad(4);
-  std::vector<DFadType> Xfad(4);
+  ScalarT                 sq32 = std::sqrt(3.0 / 2.0);
+  ScalarT                 sq23 = std::sqrt(2.0 / 3.0);
+  std::array<DFadType, 4> Rfad{};
+  std::array<DFadType, 4> Xfad{};
   // initialize DFadType local unknown vector Xfad
   // Note that since Xfad is a temporary variable
   // that gets changed within local iterations
   // when we initialize Xfad, we only pass in the values of X,
   // NOT the system sensitivity information
-  std::vector<ScalarT> Xval(4);
+  std::array<ScalarT, 4> Xval{};
   for (int i = 0; i < 4; ++i) {
     Xval[i] = Sacado::ScalarValue<ScalarT>::eval(X[i]);
     Xfad[i] = DFadType(4, i, Xval[i]);
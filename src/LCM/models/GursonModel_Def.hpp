@@ -121,9 +121,9 @@ GursonModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepF
   ScalarT fvoid, fvoid_star, eq, Phi, dgam, Ybar;
 
   // local unknowns and residual vectors
-  std::vector<ScalarT> X(4);
-  std::vector<ScalarT> R(4);
-  std::vector<ScalarT> dRdX(16);
+  std::array<ScalarT, 4>  X{};
+  std::array<ScalarT, 4>  R{};
+  std::array<ScalarT, 16> dRdX{};
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
@@ -165,7 +165,7 @@ GursonModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepF
         X[2] = fvoid;
         X[3] = eq;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 4> solver;
 
         int     iter = 0;
         ScalarT norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
@@ -325,9 +325,9 @@ GursonModel<EvalT, Traits>::YieldFunction(
 template <typename EvalT, typename Traits>
 void
 GursonModel<EvalT, Traits>::ResidualJacobian(
-    std::vector<ScalarT>&        X,
-    std::vector<ScalarT>&        R,
-    std::vector<ScalarT>&        dRdX,
+    std::array<ScalarT, 4>&      X,
+    std::array<ScalarT, 4>&      R,
+    std::array<ScalarT, 16>&     dRdX,
     ScalarT const&               p,
     ScalarT const&               fvoid,
     ScalarT const&               eq,
@@ -338,16 +338,16 @@ GursonModel<EvalT, Traits>::ResidualJacobian(
     ScalarT const&               Y,
     ScalarT const&               jacobian)
 {
-  ScalarT               sq32 = std::sqrt(3.0 / 2.0);
-  ScalarT               sq23 = std::sqrt(2.0 / 3.0);
-  std::vector<DFadType> Rfad(4);
-  std::vector<DFadType> Xfad(4);
+  ScalarT                 sq32 = std::sqrt(3.0 / 2.0);
+  ScalarT                 sq23 = std::sqrt(2.0 / 3.0);
+  std::array<DFadType, 4> Rfad{};
+  std::array<DFadType, 4> Xfad{};
   // initialize DFadType local unknown vector Xfad
   // Note that since Xfad is a temporary variable
   // that gets changed within local iterations
   // when we initialize Xfad, we only pass in the values of X,
   // NOT the system sensitivity information
-  std::vector<ScalarT> Xval(4);
+  std::array<ScalarT, 4> Xval{};
   for (int i = 0; i < 4; ++i) {
     Xval[i] = Sacado::ScalarValue<ScalarT>::eval(X[i]);
     Xfad[i] = DFadType(4, i, Xval[i]);
@@ -5,6 +5,7 @@
 #if !defined(LCM_J2Erosion_hpp)
 #define LCM_J2Erosion_hpp
 
+#include "ACEcommon.hpp"
 #include "ParallelConstitutiveModel.hpp"
 
 namespace LCM {
@@ -107,13 +108,16 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   RealType maximum_displacement_{0.0};
   bool     disable_erosion_{false};  // By default erosion is ON so not disabled
 
-  // Params with depth or time:
-  std::vector<RealType> z_above_mean_sea_level_;
-  std::vector<RealType> peat_from_file_;
-  std::vector<RealType> porosity_from_file_;
-  std::vector<RealType> air_from_file_;
-  std::vector<RealType> sea_level_;
-  std::vector<RealType> time_;
+  // Params with depth, cached at the integration points
+  DepthTableCache depth_tables_;
+  int             peat_table_{0};
+  int             porosity_table_{0};
+  int             air_table_{0};
+  int             workset_index_{0};
+
+  // Params with time, evaluated once per workset
+  InterpolationTable sea_level_table_;
+  RealType           sea_level_{-999.0};
 
   // Sea level arrays
   RealType current_time_{0.0};
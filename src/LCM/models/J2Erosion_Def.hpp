@@ -37,46 +37,61 @@ J2ErosionKernel<EvalT, Traits>::J2ErosionKernel(ConstitutiveModel<EvalT, Traits>
     ALBANY_ABORT("ACE Maximum Displacement not specified in mechanics material file!  To get the old default behavior, set this parameter to 0.35.");
   }
 
+  std::vector<RealType> sea_level;
+  std::vector<RealType> time;
   if (p->isParameter("ACE Sea Level File") == true) {
     auto const filename = p->get<std::string>("ACE Sea Level File");
-    sea_level_          = vectorFromFile(filename);
+    sea_level           = vectorFromFile(filename);
   }
   if (p->isParameter("ACE Time File") == true) {
     auto const filename = p->get<std::string>("ACE Time File");
-    time_               = vectorFromFile(filename);
+    time                = vectorFromFile(filename);
   }
   ALBANY_ASSERT(
-      time_.size() == sea_level_.size(),
+      time.size() == sea_level.size(),
       "*** ERROR: Number of times and number of sea level values "
       "must match.");
+  if (sea_level.size() > 0) {
+    sea_level_table_ = InterpolationTable(time, sea_level);
+  }
+  std::vector<RealType> z_above_mean_sea_level;
+  std::vector<RealType> peat_from_file;
+  std::vector<RealType> porosity_from_file;
+  std::vector<RealType> air_from_file;
   if (p->isParameter("ACE Z Depth File") == true) {
-    auto const filename     = p->get<std::string>("ACE Z Depth File");
-    z_above_mean_sea_level_ = vectorFromFile(filename);
+    auto const filename    = p->get<std::string>("ACE Z Depth File");
+    z_above_mean_sea_level = vectorFromFile(filename);
   }
   if (p->isParameter("ACE_Porosity File") == true) {
     auto const filename = p->get<std::string>("ACE_Porosity File");
-    porosity_from_file_ = vectorFromFile(filename);
+    porosity_from_file  = vectorFromFile(filename);
     ALBANY_ASSERT(
-        z_above_mean_sea_level_.size() == porosity_from_file_.size(),
+        z_above_mean_sea_level.size() == porosity_from_file.size(),
         "*** ERROR: Number of z values and number of porosity values in "
         "ACE_Porosity File must match.");
   }
   if (p->isParameter("ACE Peat File") == true) {
     auto const filename = p->get<std::string>("ACE Peat File");
-    peat_from_file_     = vectorFromFile(filename);
+    peat_from_file      = vectorFromFile(filename);
     ALBANY_ASSERT(
-        z_above_mean_sea_level_.size() == peat_from_file_.size(),
+        z_above_mean_sea_level.size() == peat_from_file.size(),
         "*** ERROR: Number of z values and number of peat values in "
         "ACE Peat File must match.");
   }
   if (p->isParameter("ACE Air File") == true) {
     auto const filename = p->get<std::string>("ACE Air File");
-    air_from_file_      = vectorFromFile(filename);
+    air_from_file       = vectorFromFile(filename);
     ALBANY_ASSERT(
-        z_above_mean_sea_level_.size() == air_from_file_.size(),
+        z_above_mean_sea_level.size() == air_from_file.size(),
         "*** ERROR: Number of z values and number of air values in "
         "ACE Air File must match.");
   }
+  auto const depth_table = [&](std::vector<RealType> const& values) {
+    return values.size() > 0 ? InterpolationTable(z_above_mean_sea_level, values) : InterpolationTable();
+  };
+  peat_table_     = depth_tables_.addTable(depth_table(peat_from_file));
+  porosity_table_ = depth_tables_.addTable(depth_table(porosity_from_file));
+  air_table_      = depth_tables_.addTable(depth_table(air_from_file));
 
   // retrieve appropriate field name strings
 
@@ -214,11 +229,22 @@ J2ErosionKernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT const>&
   }
 
   current_time_ = workset.current_time;
+  sea_level_    = sea_level_table_.empty() == false ? sea_level_table_(current_time_) : -999.0;
 
   auto const num_cells = workset.numCells;
   for (auto cell = 0; cell < num_cells; ++cell) {
     failed_(cell, 0) = 0.0;
   }
+
+  // Depth-dependent params only change if the integration points move
+  workset_index_    = workset.wsIndex;
+  auto const coords = this->model_.getCoordVecField();
+  for (auto cell = 0; cell < num_cells; ++cell) {
+    for (auto pt = 0; pt < num_pts_; ++pt) {
+      auto const height = Sacado::Value<ScalarT>::eval(coords(cell, pt, 2));
+      depth_tables_.update(workset_index_, cell * num_pts_ + pt, height);
+    }
+  }
 }
 
 // J2 nonlinear system
@@ -397,18 +423,18 @@ J2ErosionKernel<EvalT, Traits>::operator()(int cell, int pt) const
   Tensor       sigma(num_dims_);
   Vector       displacement(num_dims_);
 
-  auto const coords       = this->model_.getCoordVecField();
-  auto const height       = Sacado::Value<ScalarT>::eval(coords(cell, pt, 2));
-  auto const current_time = current_time_;
-  auto const sea_level    = sea_level_.size() > 0 ? interpolateVectors(time_, sea_level_, current_time) : -999.0;
+  auto const coords    = this->model_.getCoordVecField();
+  auto const height    = Sacado::Value<ScalarT>::eval(coords(cell, pt, 2));
+  auto const sea_level = sea_level_;
+  auto const point     = cell * num_pts_ + pt;
 
   ScalarT const ice_saturation = ice_saturation_(cell, pt);
 
-  auto const peat     = peat_from_file_.size() > 0 ? interpolateVectors(z_above_mean_sea_level_, peat_from_file_, height) : 0.0;
-  auto const porosity = porosity_from_file_.size() > 0 ? interpolateVectors(z_above_mean_sea_level_, porosity_from_file_, height) : bulk_porosity_;
+  auto const peat     = depth_tables_.value(workset_index_, point, peat_table_);
+  auto const porosity = depth_tables_.hasTable(porosity_table_) ? depth_tables_.value(workset_index_, point, porosity_table_) : bulk_porosity_;
   // IKT, 2/17/2024: added air for specification of snow
   // TODO: work this variable into implementation
-  auto const air = air_from_file_.size() > 0 ? interpolateVectors(z_above_mean_sea_level_, air_from_file_, height) : 0.0;
+  auto const air = depth_tables_.value(workset_index_, point, air_table_);
   // std::cout << "IKT J2Erosion air = " << air << "\n";
   ScalarT ne{1.0};
   ScalarT ny{1.0};
@@ -178,6 +178,12 @@ class J2HMCModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   int numMicroScales;
 
+  ///
+  /// capacity of the local return-mapping system: one macro and two
+  /// unknowns per additional scale, up to 8 additional scales
+  ///
+  static constexpr int maxLocalVars = 17;
+
   ///
   /// INDEPENDENT FIELD NAMES
   ///
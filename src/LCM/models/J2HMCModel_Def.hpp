@@ -4,6 +4,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Macros.hpp"
 #include "Albany_Utils.hpp"
 #include "LocalNonlinearSolver.hpp"
@@ -27,6 +29,10 @@ J2HMCModel<EvalT, Traits>::J2HMCModel(Teuchos::ParameterList* p, const Teuchos::
       C66(p->get<RealType>("C66"))
 /******************************************************************************/
 {
+  ALBANY_PANIC(
+      1 + 2 * numMicroScales > maxLocalVars,
+      "J2HMCModel supports at most " << (maxLocalVars - 1) / 2 << " additional scales, " << numMicroScales << " requested" << std::endl);
+
   lengthScale.resize(numMicroScales);
   betaParameter.resize(numMicroScales);
   microYieldStress0.resize(numMicroScales);
@@ -320,6 +326,14 @@ J2HMCModel<EvalT, Traits>::radialReturn(
   int                  nvars = 1 + 2 * numMicroScales;
   std::vector<ScalarT> Fvals(nvars);
 
+  // The local system of the yielding scales, of at most nvars unknowns.
+  // Allocated once, its size changes with the point within the capacity.
+  std::vector<int>     yieldMask(nvars), yieldMap(nvars);
+  std::vector<ScalarT> X, R, dRdX;
+  X.reserve(nvars);
+  R.reserve(nvars);
+  dRdX.reserve(nvars * nvars);
+
   int numCells = workset.numCells;
   for (std::size_t cell = 0; cell < numCells; ++cell) {
     for (std::size_t qp = 0; qp < num_pts_; ++qp) {
@@ -362,8 +376,7 @@ J2HMCModel<EvalT, Traits>::radialReturn(
         }
 
       if (yielding) {
-        std::vector<int> yieldMask(nvars), yieldMap(nvars);
-        int              nyield = 0;
+        int nyield = 0;
         for (int i = 0; i < Fvals.size(); i++) {
           if (Fvals[i] > 0.0) {
             yieldMap[i]  = nyield;
@@ -373,13 +386,11 @@ J2HMCModel<EvalT, Traits>::radialReturn(
             yieldMask[i] = 0;
           }
         }
-        std::vector<ScalarT> X(nyield);
-        std::vector<ScalarT> R(nyield);
-        std::vector<ScalarT> dRdX(nyield * nyield);
-
-        for (int i = 0; i < X.size(); i++) X[i] = 0.0;
+        X.assign(nyield, 0.0);
+        R.assign(nyield, 0.0);
+        dRdX.assign(nyield * nyield, 0.0);
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, maxLocalVars> solver;
 
         int     iter     = 0;
         ScalarT initNorm = 0.0;
@@ -539,10 +550,10 @@ J2HMCModel<EvalT, Traits>::computeResidualandJacobian(
     std::vector<ScalarT>&                      doubleAlpha)
 /******************************************************************************/
 {
-  int                   nvars = X.size();
-  std::vector<DFadType> Rfad(nvars);
-  std::vector<DFadType> Xfad(nvars);
-  std::vector<ScalarT>  Xval(nvars);
+  int                                nvars = X.size();
+  std::array<DFadType, maxLocalVars> Rfad{};
+  std::array<DFadType, maxLocalVars> Xfad{};
+  std::array<ScalarT, maxLocalVars>  Xval{};
   for (std::size_t i = 0; i < nvars; ++i) {
     Xval[i] = Sacado::ScalarValue<ScalarT>::eval(X[i]);
     Xfad[i] = DFadType(nvars, i, Xval[i]);
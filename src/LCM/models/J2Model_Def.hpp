@@ -4,6 +4,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Macros.hpp"
 #include "LocalNonlinearSolver.hpp"
 #include "Phalanx_DataLayout.hpp"
@@ -190,11 +192,11 @@ J2Model<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepField
 
         int const num_max_iter = 30;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        FixedLocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F;
+        std::array<ScalarT, 1> dFdX;
+        std::array<ScalarT, 1> X;
 
         F[0] = f;
         X[0] = 0.0;
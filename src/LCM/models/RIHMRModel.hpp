@@ -7,6 +7,8 @@
 
 #include <MiniTensor.h>
 
+#include <array>
+
 #include "Albany_Layouts.hpp"
 #include "LCM/models/ConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -77,17 +79,17 @@ class RIHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   void
   ResidualJacobian(
-      std::vector<ScalarT>& X,
-      std::vector<ScalarT>& R,
-      std::vector<ScalarT>& dRdX,
-      ScalarT const&        es,
-      ScalarT const&        smag,
-      ScalarT const&        mubar,
-      ScalarT&              mu,
-      ScalarT&              kappa,
-      ScalarT&              K,
-      ScalarT&              Y,
-      ScalarT&              Rd);
+      std::array<ScalarT, 2>& X,
+      std::array<ScalarT, 2>& R,
+      std::array<ScalarT, 4>& dRdX,
+      ScalarT const&          es,
+      ScalarT const&          smag,
+      ScalarT const&          mubar,
+      ScalarT&                mu,
+      ScalarT&                kappa,
+      ScalarT&                K,
+      ScalarT&                Y,
+      ScalarT&                Rd);
 };
 }  // namespace LCM
 
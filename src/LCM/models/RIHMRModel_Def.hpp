@@ -122,11 +122,11 @@ RIHMRModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
   ScalarT sq23 = std::sqrt(2.0 / 3.0);
 
   // local unknowns and residual vectors
-  std::vector<ScalarT>                R(2);
-  std::vector<ScalarT>                X(2);
-  std::vector<ScalarT>                dRdX(4);
-  ScalarT                             normR0(0.0), normR(0.0), conv(0.0);
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  std::array<ScalarT, 2>                      R{};
+  std::array<ScalarT, 2>                      X{};
+  std::array<ScalarT, 4>                      dRdX{};
+  ScalarT                                     normR0(0.0), normR(0.0), conv(0.0);
+  FixedLocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int pt = 0; pt < num_pts_; ++pt) {
@@ -268,22 +268,22 @@ RIHMRModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
 template <typename EvalT, typename Traits>
 void
 RIHMRModel<EvalT, Traits>::ResidualJacobian(
-    std::vector<ScalarT>& X,
-    std::vector<ScalarT>& R,
-    std::vector<ScalarT>& dRdX,
-    ScalarT const&        isoH,
-    ScalarT const&        smag,
-    ScalarT const&        mubar,
-    ScalarT&              mu,
-    ScalarT&              kappa,
-    ScalarT&              K,
-    ScalarT&              Y,
-    ScalarT&              Rd)
+    std::array<ScalarT, 2>& X,
+    std::array<ScalarT, 2>& R,
+    std::array<ScalarT, 4>& dRdX,
+    ScalarT const&          isoH,
+    ScalarT const&          smag,
+    ScalarT const&          mubar,
+    ScalarT&                mu,
+    ScalarT&                kappa,
+    ScalarT&                K,
+    ScalarT&                Y,
+    ScalarT&                Rd)
 {
-  ScalarT               sq23 = std::sqrt(2.0 / 3.0);
-  std::vector<DFadType> Rfad(2);
-  std::vector<DFadType> Xfad(2);
-  std::vector<ScalarT>  Xval(2);
+  ScalarT                 sq23 = std::sqrt(2.0 / 3.0);
+  std::array<DFadType, 2> Rfad{};
+  std::array<DFadType, 2> Xfad{};
+  std::array<ScalarT, 2>  Xval{};
 
   // initialize DFadType local unknown vector Xfad
   // Note that since Xfad is a temporary variable
@@ -7,18 +7,23 @@
 #include "Albany_BCUtils.hpp"
 #include "Albany_ProblemUtils.hpp"
 #include "Albany_Utils.hpp"
+#include "SolutionSniffer.hpp"
 
 Albany::HMCProblem::HMCProblem(
     const Teuchos::RCP<Teuchos::ParameterList>& params_,
     const Teuchos::RCP<ParamLib>&               paramLib_,
     int const                                   numDim_,
     Teuchos::RCP<Teuchos::Comm<int> const>&     commT)
-    : Albany::AbstractProblem(params_, paramLib_, numDim_ + params_->get("Additional Scales", 1) * numDim_ * numDim_),
+    : Albany::AbstractProblem(
+          params_,
+          paramLib_,
+          numDim_ + (params_->get("Condense Micro Scales", false) ? 0 : params_->get("Additional Scales", 1) * numDim_ * numDim_)),
       params(params_),
       haveSource(false),
       use_sdbcs_(false),
       numDim(numDim_),
-      numMicroScales(params_->get("Additional Scales", 1))
+      numMicroScales(params_->get("Additional Scales", 1)),
+      condenseMicroScales(params_->get("Condense Micro Scales", false))
 {
   std::string& method = params->get("Name", "HMC ");
   *out << "Problem Name = " << method << std::endl;
@@ -31,6 +36,13 @@ Albany::HMCProblem::HMCProblem(
   }
   ALBANY_PANIC(!validMaterialDB, "Mechanics Problem Requires a Material Database");
 
+  // User-defined NOX status test that can be passed to the evaluators
+  if (params->isParameter("Constitutive Model NOX Status Test")) {
+    nox_status_test_ = params->get<Teuchos::RCP<NOX::StatusTest::Generic>>("Constitutive Model NOX Status Test");
+  } else {
+    nox_status_test_ = Teuchos::rcp(new NOX::StatusTest::ModelEvaluatorFlag);
+  }
+
   // the following function returns the problem information required for setting
   // the rigid body modes (RBMs) for elasticity problems
   // written by IK, Feb. 2012
@@ -48,13 +60,24 @@ Albany::HMCProblem::HMCProblem(
     }
   }
 
-  int numPDEs = numMicroScales * numDim * numDim;
+  // With condensed micro scales only the displacement is in the global system.
+  int numPDEs = condenseMicroScales ? neq : numMicroScales * numDim * numDim;
 
   rigidBodyModes->setParameters(numPDEs, numDim, numScalar, nullSpaceDim);
 }
 
 Albany::HMCProblem::~HMCProblem() {}
 
+void
+Albany::HMCProblem::applyProblemSpecificSolverSettings(Teuchos::RCP<Teuchos::ParameterList> solver_params)
+{
+  if (condenseMicroScales == false) return;
+  bool const have_status_test = LCM::addModelEvaluatorFlagStatusTest(*solver_params, nox_status_test_);
+  ALBANY_PANIC(
+      have_status_test == false,
+      "Error in HMCProblem: Condense Micro Scales needs the NOX Solver Options and Status Tests, with which a singular micro balance fails the step.\n");
+}
+
 void
 Albany::HMCProblem::buildProblem(Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>> meshSpecs, Albany::StateManager& stateMgr)
 {
@@ -184,6 +207,10 @@ Albany::HMCProblem::getValidProblemParameters() const
   Teuchos::RCP<Teuchos::ParameterList> validPL = this->getGenericProblemParams("ValidHMCProblemParams");
 
   validPL->set<int>("Additional Scales", false, "1");
+  validPL->set<bool>(
+      "Condense Micro Scales",
+      false,
+      "Eliminate the microstrains element by element so that only the displacement is solved for globally (Linear HMC model only)");
   validPL->set<std::string>("MaterialDB Filename", "materials.xml", "Filename of material database xml file");
   validPL->sublist("Hierarchical Elasticity Model", false, "");
   validPL->sublist("Topology Parameters", false, "");
@@ -8,6 +8,7 @@
 #include "Albany_AbstractProblem.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "ConstitutiveModelInterface.hpp"
+#include "NOX_StatusTest_ModelEvaluatorFlag.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dimension.hpp"
 #include "PHAL_Workset.hpp"
@@ -91,6 +92,11 @@ class HMCProblem : public virtual Albany::AbstractProblem
       Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::RCP<Kokkos::DynRankView<RealType, PHX::Device>>>> oldState_,
       Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::RCP<Kokkos::DynRankView<RealType, PHX::Device>>>> newState_) const;
 
+  //! Add the NOX Status Test with which the condensation fails a step on a
+  //! singular micro balance
+  void
+  applyProblemSpecificSolverSettings(Teuchos::RCP<Teuchos::ParameterList> solver_params);
+
  private:
   //! Private to prohibit copying
   HMCProblem(const HMCProblem&);
@@ -131,6 +137,13 @@ class HMCProblem : public virtual Albany::AbstractProblem
   int  numDim;
   int  numMicroScales;
 
+  //! Microstrains are element-interior unknowns condensed out of the global
+  //! system (see HMC::CondensedMicroStrain)
+  bool condenseMicroScales;
+
+  //! User defined NOX Status Test that allows the evaluators to fail a step
+  Teuchos::RCP<NOX::StatusTest::Generic> nox_status_test_;
+
   //! Problem parameter list
   const Teuchos::RCP<Teuchos::ParameterList> params;
 
@@ -165,6 +178,7 @@ class HMCProblem : public virtual Albany::AbstractProblem
 #include "DefGrad.hpp"
 #include "ElasticityResid.hpp"
 #include "FieldNameMap.hpp"
+#include "HMC_CondensedMicroStrain.hpp"
 #include "HMC_MicroResidual.hpp"
 #include "HMC_StrainDifference.hpp"
 #include "HMC_TotalStress.hpp"
@@ -197,6 +211,9 @@ Albany::HMCProblem::constructEvaluators(
   // get the name of the material model to be used (and make sure there is one)
   std::string material_model_name = material_db_->getElementBlockSublist(eb_name, "Material Model").get<std::string>("Model Name");
   ALBANY_PANIC(material_model_name.length() == 0, "A material model must be defined for block: " + eb_name);
+  ALBANY_PANIC(
+      condenseMicroScales && material_model_name != "Linear HMC",
+      "Condense Micro Scales requires the Linear HMC material model in block: " + eb_name);
 
 #if defined(ALBANY_VERBOSE)
   *out << "In MechanicsProblem::constructEvaluators" << std::endl;
@@ -460,9 +477,11 @@ Albany::HMCProblem::constructEvaluators(
   int dof_offset = numDim;  // dof layout is {x, y, ..., xx, xy, xz, yx, ...}
   int dof_stride = numDim * numDim;
   int tensorRank = 2;
-  for (int i = 0; i < numMicroScales; i++) {
-    fm0.template registerEvaluator<EvalT>(evalUtils.constructGatherSolutionEvaluator_withAcceleration(
-        tensorRank, micro_dof_names[i], Teuchos::null, micro_dof_names_dotdot[i], dof_offset + i * dof_stride));
+  if (!condenseMicroScales) {
+    for (int i = 0; i < numMicroScales; i++) {
+      fm0.template registerEvaluator<EvalT>(evalUtils.constructGatherSolutionEvaluator_withAcceleration(
+          tensorRank, micro_dof_names[i], Teuchos::null, micro_dof_names_dotdot[i], dof_offset + i * dof_stride));
+    }
   }
 
   // Gather Coordinates
@@ -560,8 +579,10 @@ Albany::HMCProblem::constructEvaluators(
   & "Microstrain\_n"  & dims(cell,p=nQPs,i=vecDim,j=spcDim)
     \end{tabular} \\
   \end{text}*/
-  for (int i = 0; i < numMicroScales; i++)
-    fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorInterpolationEvaluator(micro_dof_names[i][0], dof_offset + i * dof_stride));
+  if (!condenseMicroScales) {
+    for (int i = 0; i < numMicroScales; i++)
+      fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorInterpolationEvaluator(micro_dof_names[i][0], dof_offset + i * dof_stride));
+  }
 
   // Project accelerations to Gauss points
   /*\begin{text}
@@ -606,8 +627,10 @@ Albany::HMCProblem::constructEvaluators(
   dims(cell,p=nQPs,i=vecDim,j=vecDim)
     \end{tabular} \\
   \end{text}*/
-  for (int i = 0; i < numMicroScales; i++)
-    fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorInterpolationEvaluator(micro_dof_names_dotdot[i][0], dof_offset + i * dof_stride));
+  if (!condenseMicroScales) {
+    for (int i = 0; i < numMicroScales; i++)
+      fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorInterpolationEvaluator(micro_dof_names_dotdot[i][0], dof_offset + i * dof_stride));
+  }
 
   // Project nodal coordinates to Gauss points
   /*\begin{text}
@@ -673,7 +696,8 @@ Albany::HMCProblem::constructEvaluators(
     \end{tabular} \\
   \end{text}*/
   for (int i = 0; i < numMicroScales; i++) {
-    fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorGradInterpolationEvaluator(micro_dof_names[i][0], dof_offset + i * dof_stride));
+    if (!condenseMicroScales)
+      fm0.template registerEvaluator<EvalT>(evalUtils.constructDOFTensorGradInterpolationEvaluator(micro_dof_names[i][0], dof_offset + i * dof_stride));
 
     std::string strMSGrad_Inc = micro_dof_names[i][0] + " Gradient";
     std::string msGrad        = Albany::strint(strMicrostrain, i) + " Gradient";
@@ -798,6 +822,49 @@ Albany::HMCProblem::constructEvaluators(
     fm0.template registerEvaluator<EvalT>(ev);
   }
 
+  // Condense the microstrains
+  /*\begin{text}
+     With "Condense Micro Scales" the microstrain increments are element-interior
+  unknowns. Instead of being gathered from the global solution, they are
+  recovered from the micro balance in each element given the updated macro strain:
+    \begin{align*}
+       \left(l_n^2 L_{IJ} - M_{IJ}\right) \Delta\epsilon^n_{Jij} = -G^n_{Iij}(\epsilon_{ij})
+    \end{align*}
+     \textbf{DEPENDENT FIELDS:} \\
+       $\epsilon_{ij}$ & Macro strain at state N+1 & "Strain" & dims(cell, p=nQPs, i=vecDim, j=spcDim) \\
+    \textbf{EVALUATED FIELDS:} \\
+    \begin{tabular}{l l l l}
+       $\Delta\epsilon^n_{ij}$   & Microstrain n increment          & "DeltaMicrostrain\_n"          & dims(cell, p=nQPs, i=vecDim, j=spcDim) \\
+       $\Delta\epsilon^n_{ij,k}$ & Microstrain n gradient increment & "DeltaMicrostrain\_n Gradient" & dims(cell, p=nQPs, i=vecDim, j=vecDim, k=spcDim)
+    \end{tabular}
+  \end{text}*/
+  if (condenseMicroScales) {
+    std::string             matName    = material_db_->getElementBlockParam<std::string>(eb_name, "material");
+    Teuchos::ParameterList& param_list = material_db_->getElementBlockSublist(eb_name, matName);
+    for (int i = 0; i < numMicroScales; i++) {
+      RCP<ParameterList> p = rcp(new ParameterList("Condensed Microstrain"));
+
+      // Input
+      p->set<std::string>("Macro Strain Name", strStrain_Updated);
+      p->set<std::string>("BF Name", "BF");
+      p->set<std::string>("Weighted BF Name", "wBF");
+      p->set<std::string>("Gradient BF Name", "Grad BF");
+      p->set<std::string>("Weighted Gradient BF Name", "wGrad BF");
+      p->set<std::string>("Micro Strain Name", strMicrostrains_Current[i]);
+      p->set<std::string>("Micro Strain Gradient Name", Albany::strint(strMicrostrain, i) + " Gradient_old");
+      p->set<RealType>("Length Scale", param_list.sublist(Albany::strint("Microscale", i + 1)).get<RealType>("Length Scale"));
+      p->set<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>(
+          "NOX Status Test", Teuchos::rcp_dynamic_cast<NOX::StatusTest::ModelEvaluatorFlag>(nox_status_test_));
+
+      // Output
+      p->set<std::string>("Micro Strain Increment Name", micro_dof_names[i][0]);
+      p->set<std::string>("Micro Strain Gradient Increment Name", micro_dof_names[i][0] + " Gradient");
+
+      ev = rcp(new HMC::CondensedMicroStrain<EvalT, AlbanyTraits>(*p, dl));
+      fm0.template registerEvaluator<EvalT>(ev);
+    }
+  }
+
   // Compute microstrain difference
   /*\begin{text}
      Register new evaluator:
@@ -971,7 +1038,7 @@ Albany::HMCProblem::constructEvaluators(
     ev = rcp(new LCM::ElasticityResid<EvalT, AlbanyTraits>(*p));
     fm0.template registerEvaluator<EvalT>(ev);
   }
-  for (int i = 0; i < numMicroScales; i++) {
+  for (int i = 0; i < numMicroScales && !condenseMicroScales; i++) {
     RCP<ParameterList> p = rcp(new ParameterList("Microstrain Resid"));
 
     // Input: Micro stresses
@@ -1006,7 +1073,7 @@ Albany::HMCProblem::constructEvaluators(
 
   int numTensorFields = numDim * numDim;
   int dofOffset       = numDim;
-  for (int i = 0; i < numMicroScales; i++) {  // Micro forces
+  for (int i = 0; i < numMicroScales && !condenseMicroScales; i++) {  // Micro forces
     fm0.template registerEvaluator<EvalT>(evalUtils.constructScatterResidualEvaluator(tensorRank, micro_resid_names[i], dofOffset, micro_scatter_names[i][0]));
     dofOffset += numTensorFields;
   }
@@ -1030,7 +1097,7 @@ Albany::HMCProblem::constructEvaluators(
   if (fieldManagerChoice == Albany::BUILD_RESID_FM) {
     PHX::Tag<typename EvalT::ScalarT> res_tag("Scatter", dl->dummy);
     fm0.requireField<EvalT>(res_tag);
-    for (int i = 0; i < numMicroScales; i++) {  // Micro forces
+    for (int i = 0; i < numMicroScales && !condenseMicroScales; i++) {  // Micro forces
       PHX::Tag<typename EvalT::ScalarT> res_tag(micro_scatter_names[i][0], dl->dummy);
       fm0.requireField<EvalT>(res_tag);
     }
@@ -12,6 +12,7 @@
 #include "BodyForce.hpp"
 #include "CurrentCoords.hpp"
 #include "FieldNameMap.hpp"
+#include "FusedMechanicsResidual.hpp"
 #include "MechanicsResidual.hpp"
 #include "MeshSizeField.hpp"
 #include "PHAL_NSMaterialProperty.hpp"
@@ -197,6 +198,30 @@ MechanicsProblem::constructEvaluators(
 
   bool const compute_membrane_forces = material_db_->getElementBlockParam<bool>(eb_name, "Compute Membrane Forces", false);
 
+  // Fused kinematics -> constitutive update -> first PK -> residual kernel.
+  // Only for plain 3D bulk mechanics; anything else uses the evaluator chain.
+  bool use_fused_kernel = material_db_->getElementBlockParam<bool>(eb_name, "Use Fused Mechanics Kernel", false);
+
+  if (use_fused_kernel) {
+    bool const is_eligible =
+        have_mech_eq_ && meshSpecs.ctd.dimension == 3 && surface_element == false && composite_ == false &&
+        LCM::FusedMechanicsResidual<EvalT, PHAL::AlbanyTraits>::isSupportedModel(material_model_name) &&
+        material_db_->isElementBlockParam(eb_name, "Strain Flag") == false && have_temperature_ == false && have_ace_temperature_ == false &&
+        is_ace_sequential_thermomechanical_ == false && have_pore_pressure_ == false && have_transport_ == false && have_hydrostress_ == false &&
+        have_stab_pressure_eq_ == false && param_list.isSublist("Tritium Coefficients") == false && volume_average_j == false &&
+        volume_average_pressure == false && Teuchos::is_null(rc_mgr_) &&
+        material_db_->getElementBlockParam<bool>(eb_name, "Velocity Gradient Flag", false) == false &&
+        material_db_->getElementBlockParam<bool>(eb_name, "Plastic Velocity Gradient Flag", false) == false &&
+        material_db_->isElementBlockSublist(eb_name, "Body Force") == false &&
+        material_db_->getElementBlockParam<bool>(eb_name, "Use Analytic Mass", false) == false;
+
+    if (is_eligible == false) {
+      *out << "Warning: \"Use Fused Mechanics Kernel\" is not supported for block " << eb_name
+           << " with this material model and physics; using the standard mechanics evaluators." << std::endl;
+      use_fused_kernel = false;
+    }
+  }
+
   // FIXME: really need to check for WEDGE_12 topologies
   ALBANY_PANIC(composite_ && surface_element, "Surface elements are not yet supported with the composite tet");
 
@@ -942,7 +967,9 @@ MechanicsProblem::constructEvaluators(
     }
 
     auto cmi_rcp = Teuchos::rcp(new LCM::ConstitutiveModelInterface<EvalT, PHAL::AlbanyTraits>(*p, dl_));
-    fm0.template registerEvaluator<EvalT>(cmi_rcp);
+    // The fused kernel evaluates the model fields itself, but the state
+    // variables are still registered from the model below.
+    if (use_fused_kernel == false) fm0.template registerEvaluator<EvalT>(cmi_rcp);
 
     // register state variables
     auto       cmi            = (*cmi_rcp);
@@ -1263,8 +1290,10 @@ MechanicsProblem::constructEvaluators(
       }
 
       // ev = Teuchos::rcp(new LCM::DefGrad<EvalT,PHAL::AlbanyTraits>(*p));
-      ev = Teuchos::rcp(new LCM::Kinematics<EvalT, PHAL::AlbanyTraits>(*p, dl_));
-      fm0.template registerEvaluator<EvalT>(ev);
+      if (use_fused_kernel == false) {
+        ev = Teuchos::rcp(new LCM::Kinematics<EvalT, PHAL::AlbanyTraits>(*p, dl_));
+        fm0.template registerEvaluator<EvalT>(ev);
+      }
 
       // optional output
       bool const output_flag = material_db_->getElementBlockParam<bool>(eb_name, "Output Deformation Gradient", false);
@@ -1369,7 +1398,39 @@ MechanicsProblem::constructEvaluators(
       fm0.template registerEvaluator<EvalT>(ev);
     }  // end if (have_mech_eq_)
 
-    if (have_mech_eq_) {  // Mechanics Residual
+    if (have_mech_eq_ && use_fused_kernel) {  // Fused Mechanics Residual
+
+      Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Fused Displacement Residual"));
+
+      p->set<std::string>("Model Name", material_model_name);
+
+      // Input
+      p->set<std::string>("Gradient QP Variable Name", "Displacement Gradient");
+      p->set<std::string>("Weighted Gradient BF Name", "wGrad BF");
+      p->set<std::string>("Weighted BF Name", "wBF");
+      p->set<std::string>("Acceleration Name", "Acceleration");
+      if (material_db_->isElementBlockParam(eb_name, "Density")) {
+        p->set<RealType>("Density", material_db_->getElementBlockParam<RealType>(eb_name, "Density"));
+      }
+      p->set<RealType>("Saturation Modulus", param_list.get<RealType>("Saturation Modulus", 0.0));
+      p->set<RealType>("Saturation Exponent", param_list.get<RealType>("Saturation Exponent", 0.0));
+
+      // Output: residual and the fields saved as state variables
+      p->set<std::string>("Residual Name", "Displacement Residual");
+      p->set<std::string>("DefGrad Name", defgrad);
+      p->set<std::string>("DetDefGrad Name", J);
+      p->set<std::string>("Stress Name", cauchy);
+      if (small_strain) {
+        p->set<std::string>("Strain Name", "Strain");
+      }
+      p->set<std::string>("Fp Name", Fp);
+      p->set<std::string>("Eqps Name", eqps);
+      p->set<std::string>("Yield Surface Name", fnm["Yield_Surface"]);
+
+      ev = Teuchos::rcp(new LCM::FusedMechanicsResidual<EvalT, PHAL::AlbanyTraits>(*p, dl_));
+      fm0.template registerEvaluator<EvalT>(ev);
+
+    } else if (have_mech_eq_) {  // Mechanics Residual
 
       Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("Displacement Residual"));
 
@@ -1420,7 +1481,7 @@ MechanicsProblem::constructEvaluators(
     }  // end if (have_mech_eq_)
   }    // end if(surface_element)
 
-  if (have_mech_eq_) {
+  if (have_mech_eq_ && use_fused_kernel == false) {
     // convert Cauchy stress to first Piola-Kirchhoff
 
     Teuchos::RCP<Teuchos::ParameterList> p = Teuchos::rcp(new Teuchos::ParameterList("First PK Stress"));
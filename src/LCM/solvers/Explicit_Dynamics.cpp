@@ -0,0 +1,652 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Explicit_Dynamics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_MaterialDatabase.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_SolverFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_Utils.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_Time.hpp"
+
+namespace LCM {
+
+namespace {
+
+// Dilatational wave speed sqrt((lambda + 2 mu) / rho) of an element block
+ST
+waveSpeed(Albany::MaterialDatabase& material_db, std::string const& eb_name)
+{
+  auto const has_value = [&](std::string const& name) {
+    return material_db.isElementBlockSublist(eb_name, name) == true && material_db.getElementBlockSublist(eb_name, name).isParameter("Value") == true;
+  };
+  auto const value = [&](std::string const& name) { return material_db.getElementBlockSublist(eb_name, name).get<ST>("Value"); };
+
+  ALBANY_ASSERT(material_db.isElementBlockParam(eb_name, "Density") == true, "Explicit Dynamics: no Density for element block " << eb_name << ".\n");
+  ST const density = material_db.getElementBlockParam<ST>(eb_name, "Density");
+
+  ST modulus{0.0};
+  if (has_value("Elastic Modulus") == true) {
+    ST const E  = value("Elastic Modulus");
+    ST const nu = has_value("Poissons Ratio") == true ? value("Poissons Ratio") : 0.0;
+    modulus     = E * (1.0 - nu) / ((1.0 + nu) * (1.0 - 2.0 * nu));
+  } else if (has_value("Bulk Modulus") == true && has_value("Shear Modulus") == true) {
+    modulus = value("Bulk Modulus") + 4.0 / 3.0 * value("Shear Modulus");
+  } else {
+    ALBANY_ABORT("Explicit Dynamics: no constant elastic moduli to estimate the wave speed of element block " << eb_name << ". Specify a Time Step.\n");
+  }
+
+  ALBANY_ASSERT(density > 0.0 && modulus > 0.0, "Explicit Dynamics: non-positive Density or modulus in element block " << eb_name << ".\n");
+  return std::sqrt(modulus / density);
+}
+
+// Characteristic length of an element for the stable time step: its
+// smallest altitude for simplices (3 V / largest face area for tetrahedra,
+// 2 A / longest edge for triangles) and its measure over that of its largest
+// facet for hexahedra and quadrilaterals. Quadratic elements have nodes
+// halfway along their edges, and half that length.
+ST
+characteristicLength(Teuchos::ArrayRCP<double*> const& nodes, int const dim)
+{
+  using Point = std::array<ST, 3>;
+
+  auto const point = [&](int const i) {
+    Point x{0.0, 0.0, 0.0};
+    for (auto k = 0; k < dim; ++k) x[k] = nodes[i][k];
+    return x;
+  };
+  auto const minus = [](Point const& x, Point const& y) { return Point{x[0] - y[0], x[1] - y[1], x[2] - y[2]}; };
+  auto const cross = [](Point const& x, Point const& y) {
+    return Point{x[1] * y[2] - x[2] * y[1], x[2] * y[0] - x[0] * y[2], x[0] * y[1] - x[1] * y[0]};
+  };
+  auto const dot  = [](Point const& x, Point const& y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+  auto const norm = [&](Point const& x) { return std::sqrt(dot(x, x)); };
+
+  // Volume of a tetrahedron, area of a triangle and of a planar quadrilateral
+  auto const tet_volume = [&](int const i, int const j, int const k, int const l) {
+    return std::abs(dot(minus(point(j), point(i)), cross(minus(point(k), point(i)), minus(point(l), point(i))))) / 6.0;
+  };
+  auto const tri_area  = [&](int const i, int const j, int const k) { return 0.5 * norm(cross(minus(point(j), point(i)), minus(point(k), point(i)))); };
+  auto const quad_area = [&](int const i, int const j, int const k, int const l) {
+    return 0.5 * norm(cross(minus(point(k), point(i)), minus(point(l), point(j))));
+  };
+  auto const edge_length = [&](int const i, int const j) { return norm(minus(point(j), point(i))); };
+
+  int const num_nodes = nodes.size();
+  ST        length{0.0};
+  bool      quadratic{false};
+  if (dim == 3 && (num_nodes == 4 || num_nodes == 10)) {
+    ST const volume   = tet_volume(0, 1, 2, 3);
+    ST const max_area = std::max({tri_area(0, 1, 3), tri_area(1, 2, 3), tri_area(0, 3, 2), tri_area(0, 2, 1)});
+    length            = 3.0 * volume / max_area;
+    quadratic         = num_nodes == 10;
+  } else if (dim == 3 && (num_nodes == 8 || num_nodes == 20 || num_nodes == 27)) {
+    // Six tetrahedra around the diagonal 0-6
+    ST const volume = tet_volume(0, 1, 2, 6) + tet_volume(0, 2, 3, 6) + tet_volume(0, 3, 7, 6) + tet_volume(0, 7, 4, 6) + tet_volume(0, 4, 5, 6) +
+                      tet_volume(0, 5, 1, 6);
+    ST const max_area = std::max(
+        {quad_area(0, 1, 5, 4), quad_area(1, 2, 6, 5), quad_area(2, 3, 7, 6), quad_area(0, 4, 7, 3), quad_area(0, 3, 2, 1), quad_area(4, 5, 6, 7)});
+    length    = volume / max_area;
+    quadratic = num_nodes != 8;
+  } else if (dim == 2 && (num_nodes == 3 || num_nodes == 6)) {
+    ST const max_edge = std::max({edge_length(0, 1), edge_length(1, 2), edge_length(2, 0)});
+    length            = 2.0 * tri_area(0, 1, 2) / max_edge;
+    quadratic         = num_nodes == 6;
+  } else if (dim == 2 && (num_nodes == 4 || num_nodes == 8 || num_nodes == 9)) {
+    ST const max_edge = std::max({edge_length(0, 1), edge_length(1, 2), edge_length(2, 3), edge_length(3, 0)});
+    length            = quad_area(0, 1, 2, 3) / max_edge;
+    quadratic         = num_nodes != 4;
+  } else if (dim == 1 && (num_nodes == 2 || num_nodes == 3)) {
+    length    = std::abs(nodes[1][0] - nodes[0][0]);
+    quadratic = num_nodes == 3;
+  } else {
+    ALBANY_ABORT("Explicit Dynamics: no characteristic length for elements of " << num_nodes << " nodes in " << dim << "D. Specify a Time Step.\n");
+  }
+  return quadratic == true ? 0.5 * length : length;
+}
+
+}  // anonymous namespace
+
+ExplicitDynamics::ExplicitDynamics(Teuchos::RCP<Teuchos::ParameterList> const& app_params, Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  Teuchos::ParameterList& explicit_params = app_params->sublist("Explicit Dynamics");
+
+  std::string const model_filename = explicit_params.get<std::string>("Model Input File");
+
+  initial_time_       = explicit_params.get<ST>("Initial Time", 0.0);
+  final_time_         = explicit_params.get<ST>("Final Time", 0.0);
+  time_step_          = explicit_params.get<ST>("Time Step", 0.0);
+  stable_step_factor_ = explicit_params.get<ST>("Stable Time Step Factor", 0.9);
+  maximum_steps_      = explicit_params.get<int>("Maximum Steps", std::numeric_limits<int>::max());
+  subcycling_         = explicit_params.get<bool>("Subcycling", false);
+  maximum_subcycles_  = explicit_params.get<int>("Maximum Subcycles", 8);
+
+  // Firewalls
+  ALBANY_ASSERT(final_time_ > initial_time_, "");
+  ALBANY_ASSERT(time_step_ >= 0.0, "");
+  ALBANY_ASSERT(stable_step_factor_ > 0.0, "");
+  ALBANY_ASSERT(stable_step_factor_ <= 1.0, "");
+  ALBANY_ASSERT(maximum_steps_ >= 1, "");
+  ALBANY_ASSERT(maximum_subcycles_ >= 1, "");
+  ALBANY_ASSERT((maximum_subcycles_ & (maximum_subcycles_ - 1)) == 0, "Explicit Dynamics: Maximum Subcycles must be a power of two.\n");
+
+  // The application of the model, without the Piro solver of its input file
+  Albany::SolverFactory solver_factory(model_filename, comm);
+
+  app_ = Teuchos::rcp(new Albany::Application(comm, solver_factory.getParametersRCP()));
+
+  ALBANY_ASSERT(app_->num_time_deriv == 2, "Explicit Dynamics: the model needs Number Of Time Derivatives: 2.\n");
+
+  disc_ = app_->getDiscretization();
+
+  Albany::STKDiscretization& stk_disc = *static_cast<Albany::STKDiscretization*>(disc_.get());
+
+  stk_mesh_struct_ = stk_disc.getSTKMeshStruct();
+
+  // The driver writes every output_interval_ steps itself
+  output_interval_                    = explicit_params.get<int>("Exodus Write Interval", stk_mesh_struct_->exoOutputInterval);
+  stk_mesh_struct_->exoOutputInterval = 1;
+
+  ALBANY_ASSERT(output_interval_ >= 1, "");
+
+  std::map<std::string, int> const& eb_name_to_index = disc_->getMeshStruct()->getMeshSpecs()[0]->ebNameToIndex;
+
+  block_names_.resize(eb_name_to_index.size());
+  for (auto const& name_index : eb_name_to_index) {
+    block_names_[name_index.second] = name_index.first;
+  }
+
+  auto const& ws_eb_names = disc_->getWsEBNames();
+
+  block_of_workset_.resize(ws_eb_names.size());
+  for (auto ws = 0; ws < ws_eb_names.size(); ++ws) {
+    block_of_workset_[ws] = eb_name_to_index.at(ws_eb_names[ws]);
+  }
+
+  Teuchos::FancyOStream& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  // Time step
+  std::vector<ST> block_steps;
+
+  if (time_step_ == 0.0 || subcycling_ == true) {
+    block_steps = computeStableTimeSteps(comm);
+
+    ST const min_step = stable_step_factor_ * *std::min_element(block_steps.begin(), block_steps.end());
+    ST const max_step = stable_step_factor_ * *std::max_element(block_steps.begin(), block_steps.end());
+
+    if (time_step_ == 0.0) {
+      time_step_ = subcycling_ == true ? std::min(max_step, maximum_subcycles_ * min_step) : min_step;
+    } else if (subcycling_ == false && time_step_ > min_step) {
+      fos << "\nWARNING: Time Step " << time_step_ << " exceeds the estimated stable step " << min_step << '\n';
+    }
+
+    for (auto block = 0; block < block_steps.size(); ++block) {
+      fos << "INFO: Stable time step of element block " << block_names_[block] << ": " << block_steps[block] << '\n';
+    }
+  }
+
+  computeSubcycles(block_steps, comm);
+
+  fos << "INFO: Explicit Dynamics time step " << time_step_ << " in " << num_substeps_ << " substeps\n";
+
+  // Work vectors
+  Teuchos::RCP<Thyra_VectorSpace const> const space = app_->getVectorSpace();
+
+  disp_     = Thyra::createMember(space);
+  velo_     = Thyra::createMember(space);
+  acce_     = Thyra::createMember(space);
+  zero_     = Thyra::createMember(space);
+  resi_     = Thyra::createMember(space);
+  part_     = Thyra::createMember(space);
+  inv_mass_ = Thyra::createMember(space);
+
+  zero_->assign(0.0);
+
+  return;
+}
+
+ExplicitDynamics::~ExplicitDynamics() { return; }
+
+Teuchos::RCP<Thyra_VectorSpace const>
+ExplicitDynamics::get_x_space() const
+{
+  return Teuchos::null;
+}
+
+Teuchos::RCP<Thyra_VectorSpace const>
+ExplicitDynamics::get_f_space() const
+{
+  return Teuchos::null;
+}
+
+Teuchos::RCP<Thyra_VectorSpace const>
+ExplicitDynamics::get_p_space(int) const
+{
+  return Teuchos::null;
+}
+
+// The responses of the model, and the final displacement as the last one
+Teuchos::RCP<Thyra_VectorSpace const>
+ExplicitDynamics::get_g_space(int j) const
+{
+  int const num_responses = app_->getNumResponses();
+  ALBANY_ASSERT(j >= 0 && j <= num_responses, "Explicit Dynamics: invalid response index " << j << ".\n");
+  if (j == num_responses) return app_->getVectorSpace();
+  return app_->getResponse(j)->responseVectorSpace();
+}
+
+Teuchos::RCP<const Teuchos::Array<std::string>>
+ExplicitDynamics::get_p_names(int) const
+{
+  return Teuchos::null;
+}
+
+Teuchos::ArrayView<std::string const>
+ExplicitDynamics::get_g_names(int) const
+{
+  ALBANY_ABORT("not implemented");
+  return Teuchos::ArrayView<std::string const>(Teuchos::null);
+}
+
+Thyra_ModelEvaluator::InArgs<ST>
+ExplicitDynamics::getNominalValues() const
+{
+  return this->createInArgsImpl();
+}
+
+Thyra_ModelEvaluator::InArgs<ST>
+ExplicitDynamics::getLowerBounds() const
+{
+  return Thyra_ModelEvaluator::InArgs<ST>();  // Default value
+}
+
+Thyra_ModelEvaluator::InArgs<ST>
+ExplicitDynamics::getUpperBounds() const
+{
+  return Thyra_ModelEvaluator::InArgs<ST>();  // Default value
+}
+
+Teuchos::RCP<Thyra::LinearOpBase<ST>>
+ExplicitDynamics::create_W_op() const
+{
+  return Teuchos::null;
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+ExplicitDynamics::create_W_prec() const
+{
+  return Teuchos::null;
+}
+
+Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<ST>>
+ExplicitDynamics::get_W_factory() const
+{
+  return Teuchos::null;
+}
+
+Thyra_ModelEvaluator::InArgs<ST>
+ExplicitDynamics::createInArgs() const
+{
+  return this->createInArgsImpl();
+}
+
+Teuchos::RCP<Albany::Application>
+ExplicitDynamics::getApp() const
+{
+  return app_;
+}
+
+// Create operator form of dg/dx for distributed responses
+Teuchos::RCP<Thyra::LinearOpBase<ST>>
+ExplicitDynamics::create_DgDx_op_impl(int /* j */) const
+{
+  return Teuchos::null;
+}
+
+// Create operator form of dg/dx_dot for distributed responses
+Teuchos::RCP<Thyra::LinearOpBase<ST>>
+ExplicitDynamics::create_DgDx_dot_op_impl(int /* j */) const
+{
+  return Teuchos::null;
+}
+
+// Create InArgs
+Thyra_InArgs
+ExplicitDynamics::createInArgsImpl() const
+{
+  Thyra::ModelEvaluatorBase::InArgsSetup<ST> ias;
+
+  ias.setModelEvalDescription(this->description());
+
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_x, true);
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_x_dot, true);
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_x_dot_dot, true);
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_t, true);
+
+  return static_cast<Thyra_InArgs>(ias);
+}
+
+// Create OutArgs
+Thyra_OutArgs
+ExplicitDynamics::createOutArgsImpl() const
+{
+  Thyra::ModelEvaluatorBase::OutArgsSetup<ST> oas;
+
+  oas.setModelEvalDescription(this->description());
+  oas.set_Np_Ng(0, app_->getNumResponses() + 1);
+
+  return static_cast<Thyra_OutArgs>(oas);
+}
+
+// Evaluate model on InArgs
+void
+ExplicitDynamics::evalModelImpl(Thyra_ModelEvaluator::InArgs<ST> const&, Thyra_ModelEvaluator::OutArgs<ST> const& out_args) const
+{
+  ST const time = ExplicitLoop();
+
+  int const num_responses = app_->getNumResponses();
+  for (auto j = 0; j < out_args.Ng(); ++j) {
+    Teuchos::RCP<Thyra_Vector> const g = out_args.get_g(j);
+    if (g == Teuchos::null) continue;
+    if (j == num_responses) {
+      Thyra::copy(*disp_, g.ptr());
+    } else {
+      app_->evaluateResponse(j, time, disp_, velo_, acce_, params_, g);
+    }
+  }
+  return;
+}
+
+std::vector<ST>
+ExplicitDynamics::computeStableTimeSteps(Teuchos::RCP<Teuchos::Comm<int> const> const& comm) const
+{
+  Teuchos::RCP<Teuchos_Comm const> db_comm = comm;
+
+  Teuchos::RCP<Albany::MaterialDatabase> material_db = Albany::createMaterialDatabase(app_->getProblemPL(), db_comm);
+
+  int const num_blocks = block_names_.size();
+
+  std::vector<ST> wave_speeds(num_blocks);
+  for (auto block = 0; block < num_blocks; ++block) {
+    wave_speeds[block] = waveSpeed(*material_db, block_names_[block]);
+  }
+
+  auto const& coords = disc_->getCoords();
+  int const   dim    = disc_->getNumDim();
+
+  std::vector<ST> local_steps(num_blocks, std::numeric_limits<ST>::max());
+  for (auto ws = 0; ws < coords.size(); ++ws) {
+    int const block = block_of_workset_[ws];
+    for (auto cell = 0; cell < coords[ws].size(); ++cell) {
+      local_steps[block] = std::min(local_steps[block], characteristicLength(coords[ws][cell], dim) / wave_speeds[block]);
+    }
+  }
+
+  std::vector<ST> block_steps(num_blocks);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, num_blocks, local_steps.data(), block_steps.data());
+  return block_steps;
+}
+
+void
+ExplicitDynamics::computeSubcycles(std::vector<ST> const& block_steps, Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  int const num_blocks = block_names_.size();
+
+  // Substeps of each block, a power of two so that the substeps nest
+  std::vector<int> block_ratio(num_blocks, 1);
+  if (subcycling_ == true) {
+    for (auto block = 0; block < num_blocks; ++block) {
+      ST const ratio = time_step_ / (stable_step_factor_ * block_steps[block]);
+      int      r     = 1;
+      while (r < ratio && r < maximum_subcycles_) r *= 2;
+      ALBANY_ASSERT(r >= ratio * (1.0 - 1.0e-12), "Explicit Dynamics: element block " << block_names_[block] << " needs more than Maximum Subcycles.\n");
+      block_ratio[block] = r;
+    }
+  }
+  num_substeps_ = *std::max_element(block_ratio.begin(), block_ratio.end());
+
+  dof_period_.assign(app_->getVectorSpace()->localSubDim(), num_substeps_);
+  block_period_.assign(num_blocks, num_substeps_);
+  periods_.assign(1, num_substeps_);
+  active_worksets_.assign(block_of_workset_.size(), true);
+
+  if (num_substeps_ == 1) return;
+
+  // A degree of freedom takes the substeps of the finest block it belongs to
+  auto const& ws_el_node_eq_id = disc_->getWsElNodeEqID();
+  auto const& cas_manager      = *app_->getAdaptSolMgr()->get_cas_manager();
+
+  Teuchos::RCP<Thyra_Vector> overlap_ratio = Thyra::createMember(disc_->getOverlapVectorSpace());
+  Teuchos::RCP<Thyra_Vector> owned_ratio   = Thyra::createMember(disc_->getVectorSpace());
+  overlap_ratio->assign(0.0);
+  owned_ratio->assign(0.0);
+
+  {
+    auto overlap_data = Albany::getNonconstLocalData(*overlap_ratio);
+    for (auto ws = 0; ws < ws_el_node_eq_id.size(); ++ws) {
+      auto const& conn  = ws_el_node_eq_id[ws];
+      ST const    ratio = block_ratio[block_of_workset_[ws]];
+      for (auto cell = 0; cell < conn.extent(0); ++cell) {
+        for (auto node = 0; node < conn.extent(1); ++node) {
+          for (auto eq = 0; eq < conn.extent(2); ++eq) {
+            ST& dof_ratio = overlap_data[conn(cell, node, eq)];
+            dof_ratio     = std::max(dof_ratio, ratio);
+          }
+        }
+      }
+    }
+  }
+  cas_manager.combine(*overlap_ratio, *owned_ratio, Albany::CombineMode::ABSMAX);
+  cas_manager.scatter(*owned_ratio, *overlap_ratio, Albany::CombineMode::INSERT);
+
+  {
+    auto const owned_data = Albany::getLocalData(*owned_ratio);
+    for (auto dof = 0; dof < dof_period_.size(); ++dof) {
+      dof_period_[dof] = num_substeps_ / std::max(static_cast<int>(owned_data[dof]), 1);
+    }
+  }
+
+  // A block is evaluated at the substeps of its finest degree of freedom
+  std::vector<int> local_ratio(num_blocks, 1);
+  {
+    auto const overlap_data = Albany::getLocalData(*overlap_ratio);
+    for (auto ws = 0; ws < ws_el_node_eq_id.size(); ++ws) {
+      auto const& conn  = ws_el_node_eq_id[ws];
+      int&        ratio = local_ratio[block_of_workset_[ws]];
+      for (auto cell = 0; cell < conn.extent(0); ++cell) {
+        for (auto node = 0; node < conn.extent(1); ++node) {
+          for (auto eq = 0; eq < conn.extent(2); ++eq) {
+            ratio = std::max(ratio, static_cast<int>(overlap_data[conn(cell, node, eq)]));
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<int> ratio(num_blocks);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, num_blocks, local_ratio.data(), ratio.data());
+
+  Teuchos::FancyOStream& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  for (auto block = 0; block < num_blocks; ++block) {
+    block_period_[block] = num_substeps_ / ratio[block];
+    fos << "INFO: Element block " << block_names_[block] << " takes " << block_ratio[block] << " substeps, evaluated in " << ratio[block] << '\n';
+  }
+
+  periods_ = block_period_;
+  std::sort(periods_.begin(), periods_.end());
+  periods_.erase(std::unique(periods_.begin(), periods_.end()), periods_.end());
+}
+
+void
+ExplicitDynamics::assembleLumpedMass() const
+{
+  Teuchos::RCP<Thyra_Vector> unit = Thyra::createMember(disp_->space());
+  Teuchos::RCP<Thyra_Vector> mass = Thyra::createMember(disp_->space());
+  unit->assign(1.0);
+
+  // The residual is linear in the acceleration, so this is the row sum of
+  // the mass matrix
+  app_->computeGlobalResidual(initial_time_, disp_, velo_, unit, params_, mass);
+  app_->computeGlobalResidual(initial_time_, disp_, velo_, zero_, params_, resi_);
+  Thyra::Vp_StV(mass.ptr(), -1.0, *resi_);
+
+  // The degrees of freedom without mass, like the prescribed ones, are not
+  // accelerated by the residual
+  auto const mass_data     = Albany::getLocalData(*mass);
+  auto       inv_mass_data = Albany::getNonconstLocalData(*inv_mass_);
+  for (auto dof = 0; dof < inv_mass_data.size(); ++dof) {
+    ALBANY_ASSERT(
+        mass_data[dof] >= 0.0,
+        "Explicit Dynamics: negative lumped mass. Quadratic simplices need a "
+        "positive lumping, e.g. Use Composite Tet 10.\n");
+    inv_mass_data[dof] = mass_data[dof] > 0.0 ? 1.0 / mass_data[dof] : 0.0;
+  }
+}
+
+void
+ExplicitDynamics::computeAcceleration(ST const time, ST const substep_size, int const substep) const
+{
+  // The blocks of each period due at substep are evaluated in a fill of
+  // their own, with their own time step for the rate-dependent models. The
+  // degrees of freedom with mass add up the contributions of the fills; the
+  // residual of the prescribed ones is the same in all of them.
+  bool first_fill{true};
+  for (int const period : periods_) {
+    if (substep % period != 0) continue;
+
+    if (num_substeps_ > 1) {
+      for (auto ws = 0; ws < active_worksets_.size(); ++ws) {
+        active_worksets_[ws] = block_period_[block_of_workset_[ws]] == period;
+      }
+      app_->setActiveWorksets(active_worksets_);
+    }
+
+    Teuchos::RCP<Thyra_Vector> const fill = first_fill == true ? resi_ : part_;
+    app_->computeGlobalResidual(time, disp_, velo_, zero_, params_, fill, period * substep_size);
+
+    if (first_fill == false) {
+      auto const part_data     = Albany::getLocalData(*part_);
+      auto const inv_mass_data = Albany::getLocalData(*inv_mass_);
+      auto       resi_data     = Albany::getNonconstLocalData(*resi_);
+      for (auto dof = 0; dof < resi_data.size(); ++dof) {
+        if (inv_mass_data[dof] > 0.0) resi_data[dof] += part_data[dof];
+      }
+    }
+    first_fill = false;
+  }
+  if (num_substeps_ > 1) app_->setActiveWorksets(std::vector<bool>());
+
+  // The residual of a prescribed degree of freedom, without mass, is its
+  // value minus the prescribed one. It is moved to the prescribed value,
+  // with the acceleration that makes the kicks around the update give it
+  // the velocity of the move over its substep.
+  {
+    auto const resi_data     = Albany::getLocalData(*resi_);
+    auto const inv_mass_data = Albany::getLocalData(*inv_mass_);
+    auto       disp_data     = Albany::getNonconstLocalData(*disp_);
+    auto       acce_data     = Albany::getNonconstLocalData(*acce_);
+    for (auto dof = 0; dof < acce_data.size(); ++dof) {
+      if (substep % dof_period_[dof] != 0) continue;
+      if (inv_mass_data[dof] > 0.0) {
+        acce_data[dof] = -inv_mass_data[dof] * resi_data[dof];
+        continue;
+      }
+      ST const step = dof_period_[dof] * substep_size;
+      disp_data[dof] -= resi_data[dof];
+      acce_data[dof] = substep > 0 ? -resi_data[dof] / (step * step) : 0.0;
+    }
+  }
+
+  // The blocks not evaluated keep their states
+  app_->getStateMgr().updateStates();
+}
+
+ST
+ExplicitDynamics::ExplicitLoop() const
+{
+  Teuchos::FancyOStream& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  Teuchos::RCP<Thyra_MultiVector const> const initial = app_->getAdaptSolMgr()->getInitialSolution();
+
+  Thyra::copy(*initial->col(0), disp_.ptr());
+  Thyra::copy(*initial->col(1), velo_.ptr());
+  Thyra::copy(*initial->col(2), acce_.ptr());
+
+  assembleLumpedMass();
+
+  computeAcceleration(initial_time_, time_step_ / num_substeps_, 0);
+
+  doOutput(initial_time_);
+
+  Teuchos::Time timer("Explicit Dynamics");
+  timer.start(true);
+
+  int const steps_to_final = static_cast<int>(std::ceil((final_time_ - initial_time_) / time_step_ * (1.0 - 1.0e-12)));
+  int const num_steps      = std::min(maximum_steps_, steps_to_final);
+
+  ST time{initial_time_};
+
+  for (auto step = 1; step <= num_steps; ++step) {
+    ST const next_time = step == steps_to_final ? final_time_ : initial_time_ + step * time_step_;
+    ST const h         = (next_time - time) / num_substeps_;
+
+    for (auto substep = 1; substep <= num_substeps_; ++substep) {
+      // Half kick at the start of the substep of a degree of freedom, and
+      // drift at constant velocity through it
+      {
+        auto const acce_data = Albany::getLocalData(*acce_);
+        auto       velo_data = Albany::getNonconstLocalData(*velo_);
+        auto       disp_data = Albany::getNonconstLocalData(*disp_);
+        for (auto dof = 0; dof < disp_data.size(); ++dof) {
+          int const period = dof_period_[dof];
+          if ((substep - 1) % period == 0) velo_data[dof] += 0.5 * period * h * acce_data[dof];
+          disp_data[dof] += h * velo_data[dof];
+        }
+      }
+
+      computeAcceleration(time + substep * h, h, substep);
+
+      // Half kick at the end of the substep of a degree of freedom
+      {
+        auto const acce_data = Albany::getLocalData(*acce_);
+        auto       velo_data = Albany::getNonconstLocalData(*velo_);
+        for (auto dof = 0; dof < velo_data.size(); ++dof) {
+          int const period = dof_period_[dof];
+          if (substep % period == 0) velo_data[dof] += 0.5 * period * h * acce_data[dof];
+        }
+      }
+    }
+
+    time = next_time;
+
+    if (step % output_interval_ == 0 || step == num_steps) {
+      fos << "INFO: Explicit Dynamics step " << step << ", time " << time << '\n';
+      doOutput(time);
+    }
+  }
+
+  timer.stop();
+
+  fos << "\nINFO: Explicit Dynamics took " << num_steps << " steps in " << timer.totalElapsedTime() << " s, ";
+  fos << timer.totalElapsedTime() / std::max(num_steps, 1) << " s per step\n";
+
+  return time;
+}
+
+void
+ExplicitDynamics::doOutput(ST const time) const
+{
+  disc_->writeSolution(*disp_, *velo_, *acce_, time);
+}
+
+}  // namespace LCM
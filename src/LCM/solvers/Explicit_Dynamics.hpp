@@ -0,0 +1,187 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_ExplicitDynamics_hpp)
+#define LCM_ExplicitDynamics_hpp
+
+#include <vector>
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Albany_AbstractSTKMeshStruct.hpp"
+#include "Albany_Application.hpp"
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+
+namespace LCM {
+
+///
+/// Explicit central difference time integrator with lumped mass.
+///
+/// Drives the Albany application of a model input file directly. The
+/// lumped (row sum) mass vector is assembled once, from two residual
+/// evaluations that differ only in a unit acceleration. Each step is then
+/// a residual evaluation with zero acceleration and an update of the
+/// velocity and displacement with the inverse of the lumped mass:
+///
+///   v_{n+1/2} = v_n + dt/2 a_n
+///   u_{n+1}   = u_n + dt v_{n+1/2}
+///   a_{n+1}   = -R(u_{n+1}, v_{n+1/2}, 0) / m
+///   v_{n+1}   = v_{n+1/2} + dt/2 a_{n+1}
+///
+/// The stable time step is estimated per element block from the smallest
+/// characteristic length of its elements, their smallest altitude for
+/// simplices, and its dilatational wave speed. With subcycling, the block
+/// with the largest stable step sets the step and every block takes a power
+/// of two of substeps within it. Each degree of freedom moves with the
+/// substep of the finest block it belongs to, and a block is evaluated only
+/// at the substeps at which one of its degrees of freedom is updated, with
+/// the time step since its previous evaluation.
+///
+/// The prescribed degrees of freedom have no mass. After each evaluation
+/// they are set to their prescribed values, so the residual sees them at
+/// the values predicted by the velocity of their last substep, exact for
+/// prescribed values linear in time.
+///
+/// The responses are the ones of the model at the time reached, followed
+/// by the final displacement.
+///
+class ExplicitDynamics : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
+{
+ public:
+  /// Constructor
+  ExplicitDynamics(Teuchos::RCP<Teuchos::ParameterList> const& app_params, Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+  /// Destructor
+  ~ExplicitDynamics();
+
+  /// Return solution vector map
+  Teuchos::RCP<Thyra::VectorSpaceBase<ST> const>
+  get_x_space() const;
+
+  /// Return residual vector map
+  Teuchos::RCP<Thyra::VectorSpaceBase<ST> const>
+  get_f_space() const;
+
+  /// Return parameter vector map
+  Teuchos::RCP<Thyra::VectorSpaceBase<ST> const>
+  get_p_space(int l) const;
+
+  /// Return response function map
+  Teuchos::RCP<Thyra::VectorSpaceBase<ST> const>
+  get_g_space(int j) const;
+
+  /// Return array of parameter names
+  Teuchos::RCP<Teuchos::Array<std::string> const>
+  get_p_names(int l) const;
+
+  Teuchos::ArrayView<std::string const>
+  get_g_names(int j) const;
+
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  getNominalValues() const;
+
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  getLowerBounds() const;
+
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  getUpperBounds() const;
+
+  Teuchos::RCP<Thyra::LinearOpBase<ST>>
+  create_W_op() const;
+
+  /// Create preconditioner operator
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+  create_W_prec() const;
+
+  Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<ST> const>
+  get_W_factory() const;
+
+  /// Create InArgs
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  createInArgs() const;
+
+  Teuchos::RCP<Albany::Application>
+  getApp() const;
+
+ private:
+  /// Create operator form of dg/dx for distributed responses
+  Teuchos::RCP<Thyra::LinearOpBase<ST>>
+  create_DgDx_op_impl(int j) const;
+
+  /// Create operator form of dg/dx_dot for distributed responses
+  Teuchos::RCP<Thyra::LinearOpBase<ST>>
+  create_DgDx_dot_op_impl(int j) const;
+
+  /// Create OutArgs
+  Thyra::ModelEvaluatorBase::OutArgs<ST>
+  createOutArgsImpl() const;
+
+  /// Evaluate model on InArgs
+  void
+  evalModelImpl(Thyra::ModelEvaluatorBase::InArgs<ST> const& in_args, Thyra::ModelEvaluatorBase::OutArgs<ST> const& out_args) const;
+
+  Thyra::ModelEvaluatorBase::InArgs<ST>
+  createInArgsImpl() const;
+
+  /// Stable time step of each element block
+  std::vector<ST>
+  computeStableTimeSteps(Teuchos::RCP<Teuchos::Comm<int> const> const& comm) const;
+
+  /// Substep periods of the degrees of freedom and the element blocks
+  void
+  computeSubcycles(std::vector<ST> const& block_steps, Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+  /// Lumped mass by the difference of two residuals
+  void
+  assembleLumpedMass() const;
+
+  /// Residual evaluation at zero acceleration, a = -R / m for the degrees
+  /// of freedom updated at substep, and the prescribed values imposed
+  void
+  computeAcceleration(ST const time, ST const substep_size, int const substep) const;
+
+  /// Time integration from the initial state, to the final time or for
+  /// the maximum number of steps. Returns the time reached.
+  ST
+  ExplicitLoop() const;
+
+  void
+  doOutput(ST const time) const;
+
+  Teuchos::RCP<Albany::Application>            app_{Teuchos::null};
+  Teuchos::RCP<Albany::AbstractDiscretization> disc_{Teuchos::null};
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct>  stk_mesh_struct_{Teuchos::null};
+
+  ST   initial_time_{0.0};
+  ST   final_time_{0.0};
+  ST   time_step_{0.0};
+  ST   stable_step_factor_{0.0};
+  int  maximum_steps_{0};
+  int  maximum_subcycles_{1};
+  int  output_interval_{1};
+  bool subcycling_{false};
+
+  // Substeps per step, and substep period of each element block and each
+  // owned degree of freedom: updated at the substeps that are multiples
+  std::vector<std::string> block_names_;
+  std::vector<int>         block_of_workset_;
+  int                      num_substeps_{1};
+  std::vector<int>         block_period_;
+  std::vector<int>         dof_period_;
+  std::vector<int>         periods_;  // distinct periods of the blocks
+
+  Teuchos::Array<ParamVec> params_;
+
+  mutable std::vector<bool>          active_worksets_;
+  mutable Teuchos::RCP<Thyra_Vector> disp_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> velo_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> acce_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> zero_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> resi_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> part_{Teuchos::null};
+  mutable Teuchos::RCP<Thyra_Vector> inv_mass_{Teuchos::null};
+};
+
+}  // namespace LCM
+
+#endif  // LCM_ExplicitDynamics_hpp
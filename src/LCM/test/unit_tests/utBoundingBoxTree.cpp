@@ -0,0 +1,127 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "mortar/Moertel_BoundingBoxTree.hpp"
+
+namespace {
+
+using MoertelT::BoundingBox;
+using MoertelT::BoundingBoxTree;
+
+// Boxes of the quads of an n x n grid on a slightly curved surface,
+// grown like the mortar segment boxes.
+std::vector<BoundingBox>
+surfaceBoxes(int const n, double const shift, double const grow)
+{
+  std::vector<BoundingBox> boxes;
+  double const             h = 1.0 / n;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      BoundingBox box;
+      for (int a = 0; a < 2; ++a) {
+        for (int b = 0; b < 2; ++b) {
+          double const x    = (i + a) * h + shift;
+          double const y    = (j + b) * h;
+          double const p[3] = {x, y, 0.1 * std::sin(3.0 * x) * std::cos(2.0 * y)};
+          box.Add(p);
+        }
+      }
+      box.Inflate(grow * h);
+      boxes.push_back(box);
+    }
+  }
+  return boxes;
+}
+
+std::vector<int>
+bruteForce(std::vector<BoundingBox> const& boxes, BoundingBox const& box)
+{
+  std::vector<int> result;
+  for (int i = 0; i < static_cast<int>(boxes.size()); ++i)
+    if (boxes[i].Overlaps(box)) result.push_back(i);
+  return result;
+}
+
+TEUCHOS_UNIT_TEST(BoundingBoxTree, QueryMatchesBruteForce)
+{
+  std::mt19937                           gen(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  std::vector<BoundingBox> boxes(1000);
+  for (auto& box : boxes) {
+    double const p[3] = {dist(gen), dist(gen), dist(gen)};
+    box.Add(p);
+    box.Inflate(0.02 * dist(gen));
+  }
+
+  BoundingBoxTree tree;
+  tree.Build(boxes);
+  TEST_EQUALITY(tree.Nbox(), 1000);
+
+  for (int k = 0; k < 100; ++k) {
+    BoundingBox  query;
+    double const p[3] = {dist(gen), dist(gen), dist(gen)};
+    query.Add(p);
+    query.Inflate(0.05);
+    std::vector<int> result;
+    tree.Query(query, result);
+    std::sort(result.begin(), result.end());
+    TEST_COMPARE_ARRAYS(result, bruteForce(boxes, query));
+  }
+
+  // move the boxes and refit: queries must still be exact
+  for (auto& box : boxes) {
+    double const d[3] = {0.1 * (dist(gen) - 0.5), 0.1 * (dist(gen) - 0.5), 0.1 * (dist(gen) - 0.5)};
+    for (int i = 0; i < 3; ++i) {
+      box.min[i] += d[i];
+      box.max[i] += d[i];
+    }
+  }
+  tree.Refit(boxes);
+
+  for (int k = 0; k < 100; ++k) {
+    BoundingBox  query;
+    double const p[3] = {dist(gen), dist(gen), dist(gen)};
+    query.Add(p);
+    query.Inflate(0.05);
+    std::vector<int> result;
+    tree.Query(query, result);
+    std::sort(result.begin(), result.end());
+    TEST_COMPARE_ARRAYS(result, bruteForce(boxes, query));
+  }
+}
+
+// The broad phase of Integrate_3D on interfaces of curved quads, the slave
+// side shifted by half a segment and the master side moved after the build:
+// the tree finds the pairs of the all-pairs loop it replaces. The timings
+// are in test/utils/BoundingBoxTreeBenchmark.cpp.
+TEUCHOS_UNIT_TEST(BoundingBoxTree, InterfacePairs)
+{
+  for (int n = 4; n <= 32; n *= 2) {
+    auto const master = surfaceBoxes(n, 0.0, 2.5);
+    auto const moved  = surfaceBoxes(n, 0.1 / n, 2.5);
+    auto const slave  = surfaceBoxes(n, 0.5 / n, 2.5);
+
+    BoundingBoxTree tree;
+    tree.Build(master);
+    tree.Refit(moved);
+
+    std::vector<int> result;
+    for (auto const& box : slave) {
+      result.clear();
+      tree.Query(box, result);
+      std::sort(result.begin(), result.end());
+      TEST_COMPARE_ARRAYS(result, bruteForce(moved, box));
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,108 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <random>
+
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_ThyraCrsMatrixFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_TpetraThyraUtils.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Tpetra_Core.hpp"
+
+namespace {
+
+// A chain of two node elements, elements_per_rank of them on every process.
+// Node n is owned by the process of element n, or by the last process, so
+// the first node of the elements of a process is shared with the previous
+// process and owned by this one, and the last node is owned by the next one.
+int const elements_per_rank = 4;
+
+Teuchos::RCP<Thyra_VectorSpace const>
+chainVectorSpace(Teuchos::RCP<Teuchos_Comm const> const& comm, bool const overlapped)
+{
+  int const  rank      = comm->getRank();
+  bool const last      = rank == comm->getSize() - 1;
+  int const  num_nodes = (overlapped == true || last == true) ? elements_per_rank + 1 : elements_per_rank;
+
+  Teuchos::Array<Tpetra_GO> gids(num_nodes);
+  for (int i = 0; i < num_nodes; ++i) gids[i] = rank * elements_per_rank + i;
+  auto const invalid = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid();
+  auto const map     = Teuchos::rcp(new Tpetra_Map(invalid, gids(), 0, comm));
+  return Albany::createThyraVectorSpace(map);
+}
+
+// Random values in all the entries of the overlapped matrix
+void
+fillRandom(Teuchos::RCP<Thyra_LinearOp> const& op, int const seed)
+{
+  std::mt19937                           generator(seed);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  auto const         num_rows = Albany::getTpetraMatrix(op)->getLocalNumRows();
+  Teuchos::Array<LO> indices;
+  Teuchos::Array<ST> values;
+  for (LO row = 0; row < static_cast<LO>(num_rows); ++row) {
+    Albany::getLocalRowValues(op, row, indices, values);
+    for (auto& value : values) value = distribution(generator);
+    Albany::setLocalRowValues(op, row, indices(), values());
+  }
+}
+
+}  // anonymous namespace
+
+TEUCHOS_UNIT_TEST(CombineAndScatterManager, CombineMatrixAsExport)
+{
+  auto const comm = Tpetra::getDefaultComm();
+
+  auto const owned_vs      = chainVectorSpace(comm, false);
+  auto const overlapped_vs = chainVectorSpace(comm, true);
+
+  // The graph of the chain, as the discretizations build it
+  auto overlapped_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(overlapped_vs, overlapped_vs));
+  for (int e = 0; e < elements_per_rank; ++e) {
+    GO const nodes[2] = {comm->getRank() * elements_per_rank + e, comm->getRank() * elements_per_rank + e + 1};
+    for (GO const row : nodes) overlapped_factory->insertGlobalIndices(row, Teuchos::arrayView(nodes, 2));
+  }
+  overlapped_factory->fillComplete();
+  auto const owned_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(owned_vs, owned_vs, overlapped_factory));
+
+  auto const cas_manager = Albany::createCombineAndScatterManager(owned_vs, overlapped_vs);
+  auto       overlapped  = overlapped_factory->createOp();
+  auto       combined    = owned_factory->createOp();
+  auto       exported    = owned_factory->createOp();
+
+  auto const overlappedT = Albany::getTpetraMatrix(overlapped);
+  auto const exportedT   = Albany::getTpetraMatrix(exported);
+
+  Tpetra_Export const exporter(overlappedT->getRowMap(), exportedT->getRowMap());
+
+  // The second fill reuses the plan of the first one
+  for (int fill = 0; fill < 2; ++fill) {
+    Albany::resumeFill(overlapped);
+    Albany::resumeFill(combined);
+    Albany::resumeFill(exported);
+    fillRandom(overlapped, 1000 * fill + comm->getRank());
+    Albany::assign(combined, 0.0);
+    Albany::assign(exported, 0.0);
+
+    cas_manager->combine(*overlapped, *combined, Albany::CombineMode::ADD);
+    exportedT->doExport(*overlappedT, exporter, Tpetra::ADD);
+
+    Albany::fillComplete(overlapped);
+    Albany::fillComplete(combined);
+    Albany::fillComplete(exported);
+
+    // Same graph, so the same local indices in the same order
+    auto const         num_rows = Albany::getTpetraMatrix(combined)->getLocalNumRows();
+    Teuchos::Array<LO> combined_indices, exported_indices;
+    Teuchos::Array<ST> combined_values, exported_values;
+    for (LO row = 0; row < static_cast<LO>(num_rows); ++row) {
+      Albany::getLocalRowValues(combined, row, combined_indices, combined_values);
+      Albany::getLocalRowValues(exported, row, exported_indices, exported_values);
+      TEST_COMPARE_ARRAYS(combined_indices, exported_indices);
+      TEST_COMPARE_FLOATING_ARRAYS(combined_values, exported_values, 1.0e-14);
+    }
+  }
+}
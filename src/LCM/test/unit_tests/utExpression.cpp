@@ -0,0 +1,205 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Albany_Expression.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+namespace {
+
+using Albany::Expression;
+using OpCode = Albany::Expression::OpCode;
+
+double const tolerance = 1.0e-14;
+
+// Value at (x, y, z, t)
+double
+value(std::string const& expression, double const x = 0.0, double const y = 0.0, double const z = 0.0, double const t = 0.0)
+{
+  double const coords[] = {x, y, z};
+  return Expression(expression).evaluate(coords, 3, t);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Precedence)
+{
+  TEST_FLOATING_EQUALITY(value("2 + 3 * 4"), 14.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("(2 + 3) * 4"), 20.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 * 3 ^ 2"), 18.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 * 3 ** 2"), 18.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("-2 ^ 2"), -4.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 ^ -1"), 0.5, tolerance);
+  TEST_FLOATING_EQUALITY(value("7 % 4 + 1"), 4.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("1 + 2 < 4"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("1 < 2 == 1"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("1 || 0 && 0"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("!0 + 1"), 2.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("!(1 != 1)"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 <= 2"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 >= 3"), 0.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 > 3"), 0.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("+x * -y", 3.0, 2.0), -6.0, tolerance);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Associativity)
+{
+  TEST_FLOATING_EQUALITY(value("10 - 4 - 3"), 3.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("8 / 4 / 2"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("2 ^ 3 ^ 2"), 512.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("x - y - z", 10.0, 4.0, 3.0), 3.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("x / y / z", 8.0, 4.0, 2.0), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("x ^ y ^ z", 2.0, 3.0, 2.0), 512.0, tolerance);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Ternary)
+{
+  std::string const sign = "x < 0 ? -1 : x == 0 ? 0 : 1";
+  TEST_FLOATING_EQUALITY(value(sign, -2.0), -1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value(sign, 0.0), 0.0, tolerance);
+  TEST_FLOATING_EQUALITY(value(sign, 3.0), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("(t > 1 ? 2 : 3) * 10", 0.0, 0.0, 0.0, 2.0), 20.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("1 ? 4 : 5"), 4.0, tolerance);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Statements)
+{
+  TEST_FLOATING_EQUALITY(value("a = x + 1; b = a * 2; a + b", 1.0), 6.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("a = 3"), 3.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("a = y; a = a * a; a", 0.0, 3.0), 9.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("x; 5", 1.0), 5.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("a = 2 * x; a == 4", 2.0), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("x + 1;", 1.0), 2.0, tolerance);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Functions)
+{
+  double const a = 0.5;
+  double const b = 1.5;
+
+  TEST_FLOATING_EQUALITY(value("sin(0.5)"), std::sin(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("cos(0.5)"), std::cos(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("tan(0.5)"), std::tan(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("asin(0.5)"), std::asin(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("acos(0.5)"), std::acos(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("atan(0.5)"), std::atan(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("sinh(0.5)"), std::sinh(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("cosh(0.5)"), std::cosh(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("tanh(0.5)"), std::tanh(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("exp(0.5)"), std::exp(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("log(0.5)"), std::log(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("ln(0.5)"), std::log(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("log10(0.5)"), std::log10(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("sqrt(0.5)"), std::sqrt(a), tolerance);
+  TEST_FLOATING_EQUALITY(value("abs(-0.5)"), a, tolerance);
+  TEST_FLOATING_EQUALITY(value("fabs(-0.5)"), a, tolerance);
+  TEST_FLOATING_EQUALITY(value("floor(1.5)"), 1.0, tolerance);
+  TEST_FLOATING_EQUALITY(value("ceil(1.5)"), 2.0, tolerance);
+
+  TEST_FLOATING_EQUALITY(value("atan2(0.5, 1.5)"), std::atan2(a, b), tolerance);
+  TEST_FLOATING_EQUALITY(value("pow(0.5, 1.5)"), std::pow(a, b), tolerance);
+  TEST_FLOATING_EQUALITY(value("min(0.5, 1.5)"), a, tolerance);
+  TEST_FLOATING_EQUALITY(value("max(0.5, 1.5)"), b, tolerance);
+  TEST_FLOATING_EQUALITY(value("fmod(1.5, 0.5 + 0.2)"), std::fmod(b, 0.7), tolerance);
+
+  TEST_FLOATING_EQUALITY(value("pi"), std::acos(-1.0), tolerance);
+  TEST_FLOATING_EQUALITY(value("e"), std::exp(1.0), tolerance);
+
+  // Arguments that are not constants
+  TEST_FLOATING_EQUALITY(value("250 * cosh(0.054 * x) * exp(2.25e-06 * t)", 2.0, 0.0, 0.0, 1.0e4), 250 * std::cosh(0.108) * std::exp(2.25e-2), tolerance);
+  TEST_FLOATING_EQUALITY(value("max(x, y) - min(x, y)", 1.0, 4.0), 3.0, tolerance);
+}
+
+TEUCHOS_UNIT_TEST(Expression, ConstantFolding)
+{
+  {
+    Expression const e("2 * 3 + 4");
+    TEST_EQUALITY(e.instructions().size(), 1);
+    TEST_ASSERT(e.instructions()[0].op == OpCode::Constant);
+    TEST_FLOATING_EQUALITY(e.instructions()[0].value, 10.0, tolerance);
+  }
+  {
+    Expression const e("sin(0) + cos(0) * pi / pi");
+    TEST_EQUALITY(e.instructions().size(), 1);
+    TEST_FLOATING_EQUALITY(e.instructions()[0].value, 1.0, tolerance);
+  }
+  {
+    Expression const e("1 > 0 ? 2 : 3");
+    TEST_EQUALITY(e.instructions().size(), 1);
+    TEST_FLOATING_EQUALITY(e.instructions()[0].value, 2.0, tolerance);
+  }
+  {
+    // x, 6, + with the constant product folded
+    Expression const e("x + 2 * 3");
+    TEST_EQUALITY(e.instructions().size(), 3);
+    TEST_ASSERT(e.instructions()[0].op == OpCode::Variable);
+    TEST_ASSERT(e.instructions()[1].op == OpCode::Constant);
+    TEST_FLOATING_EQUALITY(e.instructions()[1].value, 6.0, tolerance);
+    TEST_ASSERT(e.instructions()[2].op == OpCode::Add);
+  }
+  {
+    // Nothing to fold past a variable
+    Expression const e("x * 2 * 3");
+    TEST_EQUALITY(e.instructions().size(), 5);
+  }
+}
+
+TEUCHOS_UNIT_TEST(Expression, Arrays)
+{
+  int const            dim        = 3;
+  int const            num_points = 100;
+  std::vector<double>  storage(num_points * dim);
+  std::vector<double*> coords(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    coords[i]    = &storage[i * dim];
+    coords[i][0] = 0.1 * i;
+    coords[i][1] = 1.0 - 0.01 * i;
+    coords[i][2] = 0.5 * i;
+  }
+
+  // Every other point, in reverse order
+  std::vector<int> points;
+  for (int i = num_points - 1; i >= 0; i -= 2) points.push_back(i);
+
+  double const        t = 2.5;
+  Expression const    e("x * y + z * t");
+  std::vector<double> values;
+  e.evaluate(coords, points, dim, t, values);
+
+  TEST_EQUALITY(values.size(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    double const* c = coords[points[i]];
+    TEST_FLOATING_EQUALITY(values[i], c[0] * c[1] + c[2] * t, tolerance);
+  }
+
+  // In 2D, z is 0
+  Expression const    e2("x + y + z");
+  std::vector<double> values2;
+  e2.evaluate(coords, points, 2, t, values2);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    double const* c = coords[points[i]];
+    TEST_FLOATING_EQUALITY(values2[i], c[0] + c[1], tolerance);
+  }
+}
+
+TEUCHOS_UNIT_TEST(Expression, Errors)
+{
+  TEST_THROW(Expression("x + w"), std::invalid_argument);
+  TEST_THROW(Expression("(x + 1"), std::invalid_argument);
+  TEST_THROW(Expression("x + 1)"), std::invalid_argument);
+  TEST_THROW(Expression("sec(x)"), std::invalid_argument);
+  TEST_THROW(Expression("pow(x)"), std::invalid_argument);
+  TEST_THROW(Expression("x = 1"), std::invalid_argument);
+  TEST_THROW(Expression(""), std::invalid_argument);
+  TEST_THROW(Expression("x ? 1"), std::invalid_argument);
+
+  // A variable is defined by an earlier statement only
+  TEST_THROW(Expression("a + 1; a = 2"), std::invalid_argument);
+  TEST_NOTHROW(Expression("a = 2; a + 1"));
+  TEST_NOTHROW(Expression("x + 1"));
+}
+
+}  // anonymous namespace
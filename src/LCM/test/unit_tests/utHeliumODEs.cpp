@@ -34,6 +34,42 @@ using minitensor::Vector;
 using Teuchos::ArrayRCP;
 using Teuchos::RCP;
 using Teuchos::rcp;
+typedef PHAL::AlbanyTraits::Jacobian FadEvalT;
+
+// Total concentration, delta time and diffusion coefficient set for the
+// helium ODEs, for the evaluation type EvalT
+template <typename EvalT>
+void
+registerHeliumODEs(
+    PHX::FieldManager<Traits>&               fm,
+    RCP<Albany::Layouts> const&              dl,
+    Teuchos::ParameterList&                  hoPL,
+    ArrayRCP<typename EvalT::ScalarT> const& total_concentration,
+    ArrayRCP<typename EvalT::ScalarT> const& delta_time,
+    ArrayRCP<typename EvalT::ScalarT> const& diffusion_coefficient)
+{
+  typedef typename EvalT::ScalarT T;
+
+  Teuchos::ParameterList tcPL;
+  tcPL.set<std::string>("Evaluated Field Name", "Total Concentration");
+  tcPL.set<ArrayRCP<T>>("Field Values", total_concentration);
+  tcPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout", dl->qp_scalar);
+  fm.template registerEvaluator<EvalT>(rcp(new LCM::SetField<EvalT, Traits>(tcPL)));
+
+  Teuchos::ParameterList dtPL;
+  dtPL.set<std::string>("Evaluated Field Name", "Delta Time");
+  dtPL.set<ArrayRCP<T>>("Field Values", delta_time);
+  dtPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout", dl->workset_scalar);
+  fm.template registerEvaluator<EvalT>(rcp(new LCM::SetField<EvalT, Traits>(dtPL)));
+
+  Teuchos::ParameterList dcPL;
+  dcPL.set<std::string>("Evaluated Field Name", "Diffusion Coefficient");
+  dcPL.set<ArrayRCP<T>>("Field Values", diffusion_coefficient);
+  dcPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout", dl->qp_scalar);
+  fm.template registerEvaluator<EvalT>(rcp(new LCM::SetField<EvalT, Traits>(dcPL)));
+
+  fm.template registerEvaluator<EvalT>(rcp(new LCM::HeliumODEs<EvalT, Traits>(hoPL, dl)));
+}
 
 TEUCHOS_UNIT_TEST(HeliumODEs, test1)
 {
@@ -292,4 +328,152 @@ TEUCHOS_UNIT_TEST(HeliumODEs, test1)
     for (size_type pt = 0; pt < num_pts; ++pt) TEST_COMPARE(fabs(bub_vol_frac(cell, pt) - expected_vol_frac), <=, tolerance);
 }
 
+// The derivatives of the Jacobian evaluation, recovered with the tangent at
+// the solution (implicit function theorem), against central differences of
+// the Residual evaluation, over steps that start from zero bubble density
+// (explicit predictor) and from the previous solution
+TEUCHOS_UNIT_TEST(HeliumODEs, Sensitivities)
+{
+  Teuchos::RCP<Teuchos_Comm const> commT = Albany::createTeuchosCommFromMpiComm(MPI_COMM_WORLD);
+
+  std::string const element_block_name = "Block0";
+
+  int const                  workset_size = 1;
+  int const                  num_pts      = 1;
+  int const                  num_dims     = 3;
+  int const                  num_nodes    = 8;
+  const RCP<Albany::Layouts> dl           = rcp(new Albany::Layouts(workset_size, num_nodes, num_nodes, num_pts, num_dims));
+
+  Teuchos::ParameterList hoPL;
+  hoPL.set<std::string>("Total Concentration Name", "Total Concentration");
+  hoPL.set<std::string>("Delta Time Name", "Delta Time");
+  hoPL.set<std::string>("Diffusion Coefficient Name", "Diffusion Coefficient");
+  hoPL.set<std::string>("He Concentration Name", "He Concentration");
+  hoPL.set<std::string>("Total Bubble Density Name", "Total Bubble Density");
+  hoPL.set<std::string>("Bubble Volume Fraction Name", "Bubble Volume Fraction");
+  Teuchos::ParameterList trans_params;
+  trans_params.set<double>("Avogadro's Number", 6.0221413e11);
+  hoPL.set<Teuchos::ParameterList*>("Transport Parameters", &trans_params);
+  Teuchos::ParameterList tri_params;
+  tri_params.set<double>("Tritium Decay Constant", 1.79e-9);
+  tri_params.set<double>("Helium Radius", 2.5e-4);
+  tri_params.set<double>("Atoms Per Cluster", 10);
+  hoPL.set<Teuchos::ParameterList*>("Tritium Parameters", &tri_params);
+  Teuchos::ParameterList mol_vol;
+  mol_vol.set<double>("Value", 7.116);
+  hoPL.set<Teuchos::ParameterList*>("Molar Volume", &mol_vol);
+
+  double const total_concentration = 5.0e-3;
+  double const delta_time          = 1.0e-2;
+  double const diffusion_coeff     = 2.0;
+
+  // The Residual and Jacobian evaluations, and the one that saves the states
+  ArrayRCP<ScalarT> residual_tc(1, total_concentration), residual_dt(1, delta_time), residual_dc(1, diffusion_coeff);
+  ArrayRCP<ScalarT> state_tc(1, total_concentration), state_dt(1, delta_time), state_dc(1, diffusion_coeff);
+  ArrayRCP<FadType> jacobian_tc(1, FadType(2, 0, total_concentration)), jacobian_dt(1, FadType(2, delta_time)),
+      jacobian_dc(1, FadType(2, 1, diffusion_coeff));
+
+  PHX::FieldManager<Traits> residual_fm;
+  PHX::FieldManager<Traits> jacobian_fm;
+  PHX::FieldManager<Traits> state_fm;
+  registerHeliumODEs<Residual>(residual_fm, dl, hoPL, residual_tc, residual_dt, residual_dc);
+  registerHeliumODEs<FadEvalT>(jacobian_fm, dl, hoPL, jacobian_tc, jacobian_dt, jacobian_dc);
+  registerHeliumODEs<Residual>(state_fm, dl, hoPL, state_tc, state_dt, state_dc);
+
+  std::vector<std::string> const names = {"He Concentration", "Total Bubble Density", "Bubble Volume Fraction"};
+  for (auto const& name : names) {
+    residual_fm.requireField<Residual>(PHX::Tag<ScalarT>(name, dl->qp_scalar));
+    jacobian_fm.requireField<FadEvalT>(PHX::Tag<FadType>(name, dl->qp_scalar));
+  }
+
+  Albany::StateManager stateMgr;
+  for (auto const& name : {"Total Concentration", "He Concentration", "Total Bubble Density", "Bubble Volume Fraction"}) {
+    double const init = std::string(name) == "Total Concentration" ? total_concentration : 0.0;
+    auto         p    = stateMgr.registerStateVariable(name, dl->qp_scalar, dl->dummy, element_block_name, "scalar", init, true, false);
+    state_fm.registerEvaluator<Residual>(rcp(new PHAL::SaveStateField<Residual, Traits>(*p)));
+  }
+
+  PHAL::Setup setupData;
+  residual_fm.postRegistrationSetup(setupData);
+  std::vector<PHX::index_size_type> derivative_dimensions(1, 2);
+  jacobian_fm.setKokkosExtendedDataTypeDimensions<FadEvalT>(derivative_dimensions);
+  jacobian_fm.postRegistrationSetup(setupData);
+  RCP<PHX::DataLayout> dummy = rcp(new PHX::MDALayout<Dummy>(0));
+  for (auto const& responseID : stateMgr.getResidResponseIDsToRequire(element_block_name)) {
+    state_fm.requireField<Residual>(PHX::Tag<ScalarT>(responseID, dummy));
+  }
+  state_fm.postRegistrationSetup(setupData);
+
+  // Create discretization, as required by the StateManager
+  RCP<Teuchos::ParameterList> discretizationParameterList = rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct = rcp(new Albany::TmplSTKMeshStruct<3>(discretizationParameterList, Teuchos::null, commT));
+  stkMeshStruct->setFieldAndBulkData(commT, discretizationParameterList, 3, req, stateMgr.getStateInfoStruct(), stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+  RCP<Albany::AbstractDiscretization> discretization = rcp(new Albany::STKDiscretization(discretizationParameterList, stkMeshStruct, commT));
+  static_cast<Albany::STKDiscretization&>(*discretization).updateMesh();
+  stateMgr.setupStateArrays(discretization);
+
+  PHAL::Workset workset;
+  workset.numCells      = workset_size;
+  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  // The solution of the Residual evaluation for the inputs
+  auto solve = [&](double const tc, double const dc) {
+    residual_tc[0] = tc;
+    residual_dc[0] = dc;
+    residual_fm.preEvaluate<Residual>(workset);
+    residual_fm.evaluateFields<Residual>(workset);
+    residual_fm.postEvaluate<Residual>(workset);
+    std::vector<double> x;
+    for (auto const& name : names) {
+      PHX::MDField<ScalarT, Cell, QuadPoint> field(name, dl->qp_scalar);
+      residual_fm.getFieldData<Residual>(field);
+      x.push_back(field(0, 0));
+    }
+    return x;
+  };
+
+  double const perturbation = 1.0e-6;
+  double const tolerance    = 1.0e-5;
+
+  for (int step = 0; step < 5; ++step) {
+    jacobian_fm.preEvaluate<FadEvalT>(workset);
+    jacobian_fm.evaluateFields<FadEvalT>(workset);
+    jacobian_fm.postEvaluate<FadEvalT>(workset);
+
+    std::vector<double> const x = solve(total_concentration, diffusion_coeff);
+    std::vector<double> const inputs{total_concentration, diffusion_coeff};
+
+    for (int k = 0; k < 3; ++k) {
+      PHX::MDField<FadType, Cell, QuadPoint> field(names[k], dl->qp_scalar);
+      jacobian_fm.getFieldData<FadEvalT>(field);
+      TEST_FLOATING_EQUALITY(field(0, 0).val(), x[k], 1.0e-14);
+    }
+
+    for (int input = 0; input < 2; ++input) {
+      double const        h  = perturbation * inputs[input];
+      std::vector<double> xp = input == 0 ? solve(total_concentration + h, diffusion_coeff) : solve(total_concentration, diffusion_coeff + h);
+      std::vector<double> xm = input == 0 ? solve(total_concentration - h, diffusion_coeff) : solve(total_concentration, diffusion_coeff - h);
+      for (int k = 0; k < 3; ++k) {
+        PHX::MDField<FadType, Cell, QuadPoint> field(names[k], dl->qp_scalar);
+        jacobian_fm.getFieldData<FadEvalT>(field);
+        double const finite_difference = (xp[k] - xm[k]) / (2.0 * h);
+        out << "step " << step << ", " << names[k] << ", input " << input << ": " << field(0, 0).dx(input) << " " << finite_difference << "\n";
+        TEST_FLOATING_EQUALITY(field(0, 0).dx(input), finite_difference, tolerance);
+      }
+    }
+
+    state_fm.preEvaluate<Residual>(workset);
+    state_fm.evaluateFields<Residual>(workset);
+    state_fm.postEvaluate<Residual>(workset);
+    stateMgr.updateStates();
+  }
+}
+
 }  // namespace
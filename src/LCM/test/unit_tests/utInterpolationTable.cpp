@@ -0,0 +1,124 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "ACEcommon.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+
+namespace {
+
+double const tolerance = 1.0e-14;
+
+// The lookup by linear scan that the table replaces: the first abscissa not
+// less than x, the first and last ordinates outside the table and in the
+// last interval
+RealType
+scan(std::vector<RealType> const& xv, std::vector<RealType> const& yv, RealType const x)
+{
+  auto const  n = xv.size();
+  std::size_t i{0};
+  while (xv[i] < x) {
+    if (i + 1 == n) break;
+    ++i;
+  }
+  if (i == 0) return yv[0];
+  if (i + 1 == n) return yv[i];
+  return yv[i - 1] + (yv[i] - yv[i - 1]) / (xv[i] - xv[i - 1]) * (x - xv[i - 1]);
+}
+
+// The knots, the midpoints of the intervals, points outside the table and
+// random points in it
+std::vector<RealType>
+samplePoints(std::vector<RealType> const& xv)
+{
+  std::vector<RealType> points(xv);
+  for (std::size_t i = 1; i < xv.size(); ++i) points.push_back(0.5 * (xv[i - 1] + xv[i]));
+  RealType const length = xv.back() - xv.front();
+  points.push_back(xv.front() - length);
+  points.push_back(xv.back() + length);
+
+  std::mt19937                             generator(1);
+  std::uniform_real_distribution<RealType> distribution(xv.front(), xv.back());
+  for (int i = 0; i < 1000; ++i) points.push_back(distribution(generator));
+  return points;
+}
+
+std::vector<RealType>
+ordinates(std::vector<RealType> const& xv)
+{
+  std::vector<RealType> yv;
+  for (RealType const x : xv) yv.push_back(3.0 * x * x - x + 1.0);
+  return yv;
+}
+
+TEUCHOS_UNIT_TEST(InterpolationTable, Values)
+{
+  LCM::InterpolationTable const table({0.0, 1.0, 2.0, 3.0, 4.0}, {0.0, 10.0, 20.0, 40.0, 80.0});
+
+  TEST_FLOATING_EQUALITY(table(0.5), 5.0, tolerance);
+  TEST_FLOATING_EQUALITY(table(1.25), 12.5, tolerance);
+  TEST_FLOATING_EQUALITY(table(2.5), 30.0, tolerance);
+
+  // The last ordinate in the last interval
+  TEST_EQUALITY(table(3.5), 80.0);
+}
+
+TEUCHOS_UNIT_TEST(InterpolationTable, Clamping)
+{
+  for (bool const uniform : {true, false}) {
+    std::vector<RealType> const xv = uniform == true ? std::vector<RealType>{1.0, 2.0, 3.0, 4.0} : std::vector<RealType>{1.0, 1.5, 3.0, 4.0};
+    LCM::InterpolationTable const table(xv, {7.0, 8.0, 9.0, 10.0});
+
+    TEST_EQUALITY(table(-100.0), 7.0);
+    TEST_EQUALITY(table(0.999), 7.0);
+    TEST_EQUALITY(table(1.0), 7.0);
+    TEST_EQUALITY(table(4.0), 10.0);
+    TEST_EQUALITY(table(4.001), 10.0);
+    TEST_EQUALITY(table(100.0), 10.0);
+  }
+}
+
+TEUCHOS_UNIT_TEST(InterpolationTable, KnotHits)
+{
+  // Abscissae equally spaced up to round-off, so that the index computed
+  // from the spacing is off by one at some knots
+  std::vector<RealType> xv;
+  for (int i = 0; i <= 100; ++i) xv.push_back(0.1 * i);
+  std::vector<RealType> const   yv = ordinates(xv);
+  LCM::InterpolationTable const table(xv, yv);
+
+  for (std::size_t i = 0; i + 1 < xv.size(); ++i) TEST_FLOATING_EQUALITY(table(xv[i]), yv[i], tolerance);
+  TEST_EQUALITY(table(xv.back()), yv.back());
+}
+
+// Equally spaced abscissae are looked up by direct indexing
+TEUCHOS_UNIT_TEST(InterpolationTable, UniformGrid)
+{
+  std::vector<RealType> xv;
+  for (int i = 0; i <= 200; ++i) xv.push_back(-2.0 + 0.05 * i);
+  std::vector<RealType> const   yv = ordinates(xv);
+  LCM::InterpolationTable const table(xv, yv);
+
+  for (RealType const x : samplePoints(xv)) TEST_EQUALITY(table(x), scan(xv, yv, x));
+}
+
+// Other abscissae are looked up by binary search
+TEUCHOS_UNIT_TEST(InterpolationTable, BinarySearch)
+{
+  std::mt19937                             generator(2);
+  std::uniform_real_distribution<RealType> distribution(0.0, 1.0);
+
+  std::vector<RealType> xv(200);
+  for (auto& x : xv) x = 10.0 * distribution(generator);
+  std::sort(xv.begin(), xv.end());
+  std::vector<RealType> const   yv = ordinates(xv);
+  LCM::InterpolationTable const table(xv, yv);
+
+  for (RealType const x : samplePoints(xv)) TEST_EQUALITY(table(x), scan(xv, yv, x));
+}
+
+}  // anonymous namespace
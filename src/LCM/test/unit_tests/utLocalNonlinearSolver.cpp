@@ -5,6 +5,8 @@
 #include <Sacado.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
 
+#include <array>
+
 #include "PHAL_AlbanyTraits.hpp"
 
 using namespace std;
@@ -117,4 +119,38 @@ TEUCHOS_UNIT_TEST(LocalNonlinearSolver, Jacobian)
   TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
 }
 
+TEUCHOS_UNIT_TEST(FixedLocalNonlinearSolver, Jacobian)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Jacobian          EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // x0^2 + x1 - p == 0, x0 - x1 == 0, with p = 2 the only global variable
+  std::array<ScalarT, 2>                           F;
+  std::array<ScalarT, 4>                           dFdX;
+  std::array<ScalarT, 2>                           X{{1.0, 1.0}};
+  LCM::FixedLocalNonlinearSolver<EvalT, Traits, 2> solver;
+
+  ScalarT const p(1, 0, 2.0);
+  for (int count(0); count < 20; ++count) {
+    F[0]    = X[0] * X[0] + X[1] - p;
+    F[1]    = X[0] - X[1];
+    dFdX[0] = 2.0 * X[0];
+    dFdX[1] = 1.0;
+    dFdX[2] = 1.0;
+    dFdX[3] = -1.0;
+    solver.solve(dFdX, X, F);
+  }
+
+  F[0] = X[0] * X[0] + X[1] - p;
+  F[1] = X[0] - X[1];
+  solver.computeFadInfo(dFdX, X, F);
+
+  // x0 = x1 = 1, dx/dp = 1 / (2 x0 + 1)
+  TEST_COMPARE(fabs(X[0].val() - 1.0), <=, 1.0e-14);
+  TEST_COMPARE(fabs(X[1].val() - 1.0), <=, 1.0e-14);
+  TEST_COMPARE(fabs(X[0].dx(0) - 1.0 / 3.0), <=, 1.0e-14);
+  TEST_COMPARE(fabs(X[1].dx(0) - 1.0 / 3.0), <=, 1.0e-14);
+}
+
 }  // namespace
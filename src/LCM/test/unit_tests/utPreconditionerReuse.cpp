@@ -0,0 +1,279 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_PreconditionerReuse.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Thyra_DefaultSpmdVectorSpace.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+// What the preconditioner reuse factory asks of the solvers it decorates
+struct Calls
+{
+  int builds{0};      // initializeOp on a new solver
+  int recomputes{0};  // initializeOp on an initialized solver
+  int reuses{0};      // initializeAndReuseOp
+  int iterations{0};  // reported by the next solves
+};
+
+// A solver that does nothing and reports the iterations of Calls
+class ScriptedLOWS : public Thyra_LOWS
+{
+ public:
+  explicit ScriptedLOWS(Teuchos::RCP<Calls> const& calls) : calls_(calls), space_(Thyra::defaultSpmdVectorSpace<ST>(1)) {}
+
+  Teuchos::RCP<Thyra_VectorSpace const>
+  range() const override
+  {
+    return space_;
+  }
+
+  Teuchos::RCP<Thyra_VectorSpace const>
+  domain() const override
+  {
+    return space_;
+  }
+
+  bool initialized{false};
+
+ protected:
+  bool
+  opSupportedImpl(Thyra::EOpTransp M_trans) const override
+  {
+    return M_trans == Thyra::NOTRANS;
+  }
+
+  void
+  applyImpl(Thyra::EOpTransp const, Thyra_MultiVector const&, Teuchos::Ptr<Thyra_MultiVector> const&, ST const, ST const) const override
+  {
+  }
+
+  bool
+  solveSupportsImpl(Thyra::EOpTransp transp) const override
+  {
+    return transp == Thyra::NOTRANS;
+  }
+
+  Thyra::SolveStatus<ST>
+  solveImpl(Thyra::EOpTransp const, Thyra_MultiVector const&, Teuchos::Ptr<Thyra_MultiVector> const&, Teuchos::Ptr<Thyra::SolveCriteria<ST> const> const)
+      const override
+  {
+    Thyra::SolveStatus<ST> status;
+    status.solveStatus     = Thyra::SOLVE_STATUS_CONVERGED;
+    status.extraParameters = Teuchos::parameterList();
+    status.extraParameters->set("Belos/Iteration Count", calls_->iterations);
+    return status;
+  }
+
+ private:
+  Teuchos::RCP<Calls>                   calls_;
+  Teuchos::RCP<Thyra_VectorSpace const> space_;
+};
+
+class ScriptedLOWSFactory : public Thyra_LOWS_Factory
+{
+ public:
+  explicit ScriptedLOWSFactory(Teuchos::RCP<Calls> const& calls) : calls_(calls) {}
+
+  bool
+  isCompatible(Thyra::LinearOpSourceBase<ST> const&) const override
+  {
+    return true;
+  }
+
+  Teuchos::RCP<Thyra_LOWS>
+  createOp() const override
+  {
+    return Teuchos::rcp(new ScriptedLOWS(calls_));
+  }
+
+  void
+  initializeOp(Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const&, Thyra_LOWS* Op, Thyra::ESupportSolveUse const) const override
+  {
+    auto& op = dynamic_cast<ScriptedLOWS&>(*Op);
+    if (op.initialized == true) {
+      ++calls_->recomputes;
+    } else {
+      ++calls_->builds;
+    }
+    op.initialized = true;
+  }
+
+  void
+  initializeAndReuseOp(Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const&, Thyra_LOWS*) const override
+  {
+    ++calls_->reuses;
+  }
+
+  void
+  uninitializeOp(
+      Thyra_LOWS*,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>*,
+      Teuchos::RCP<Thyra::PreconditionerBase<ST> const>*,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const>*,
+      Thyra::ESupportSolveUse*) const override
+  {
+  }
+
+  bool
+  supportsPreconditionerInputType(Thyra::EPreconditionerInputType const) const override
+  {
+    return false;
+  }
+
+  void
+  initializePreconditionedOp(
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const&,
+      Teuchos::RCP<Thyra::PreconditionerBase<ST> const> const&,
+      Thyra_LOWS*,
+      Thyra::ESupportSolveUse const) const override
+  {
+  }
+
+  void
+  initializeApproxPreconditionedOp(
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const&,
+      Teuchos::RCP<Thyra::LinearOpSourceBase<ST> const> const&,
+      Thyra_LOWS*,
+      Thyra::ESupportSolveUse const) const override
+  {
+  }
+
+  void
+  setParameterList(Teuchos::RCP<Teuchos::ParameterList> const& paramList) override
+  {
+    params_ = paramList;
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  getNonconstParameterList() override
+  {
+    return params_;
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  unsetParameterList() override
+  {
+    auto params = params_;
+    params_     = Teuchos::null;
+    return params;
+  }
+
+ private:
+  Teuchos::RCP<Calls>                  calls_;
+  Teuchos::RCP<Teuchos::ParameterList> params_;
+};
+
+// A Newton solve: a new Jacobian, then a linear solve with the given number
+// of iterations
+class Newton
+{
+ public:
+  explicit Newton(Teuchos::ParameterList const& reuse_params)
+      : calls_(Teuchos::rcp(new Calls)), factory_(Teuchos::rcp(new ScriptedLOWSFactory(calls_)), reuse_params), op_(factory_.createOp())
+  {
+    b_ = Thyra::createMember(op_->range());
+    x_ = Thyra::createMember(op_->domain());
+    Thyra::assign(b_.ptr(), 1.0);
+  }
+
+  void
+  iterate(int const iterations)
+  {
+    factory_.initializeOp(Teuchos::null, op_.get(), Thyra::SUPPORT_SOLVE_UNSPECIFIED);
+    calls_->iterations = iterations;
+    op_->solve(Thyra::NOTRANS, *b_, x_.ptr());
+  }
+
+  Calls const&
+  calls() const
+  {
+    return *calls_;
+  }
+
+  Albany::PreconditionerReuseStats const&
+  stats() const
+  {
+    return factory_.stats();
+  }
+
+ private:
+  Teuchos::RCP<Calls>                    calls_;
+  Albany::PreconditionerReuseLOWSFactory factory_;
+  Teuchos::RCP<Thyra_LOWS>               op_;
+  Teuchos::RCP<Thyra_Vector>             b_;
+  Teuchos::RCP<Thyra_Vector>             x_;
+};
+
+Teuchos::ParameterList
+reuseParameters(std::string const& type, double const growth_factor, int const max_reuses)
+{
+  Teuchos::ParameterList params("Preconditioner Reuse");
+  params.set("Reuse Type", type);
+  params.set("Iteration Growth Factor", growth_factor);
+  params.set("Maximum Reuses", max_reuses);
+  params.set("Report Timings", false);
+  return params;
+}
+
+TEUCHOS_UNIT_TEST(PreconditionerReuse, FullReuseUntilIterationGrowth)
+{
+  Newton newton(reuseParameters("Full", 2.0, -1));
+
+  // Built for the first Jacobian, with 10 iterations as reference, and
+  // reused up to a solve of 20 iterations. After the one of 21, rebuilt
+  // with 12 as reference.
+  for (int const iterations : {10, 15, 20, 21, 12, 12}) newton.iterate(iterations);
+
+  TEST_EQUALITY(newton.calls().builds, 2);
+  TEST_EQUALITY(newton.calls().recomputes, 0);
+  TEST_EQUALITY(newton.calls().reuses, 4);
+  TEST_EQUALITY(newton.stats().total_rebuilds, 2);
+  TEST_EQUALITY(newton.stats().total_reuses, 4);
+}
+
+TEUCHOS_UNIT_TEST(PreconditionerReuse, MaximumReuses)
+{
+  Newton newton(reuseParameters("Full", 2.0, 2));
+
+  for (int i = 0; i < 7; ++i) newton.iterate(10);
+
+  // Built, reused twice, built, reused twice, built
+  TEST_EQUALITY(newton.calls().builds, 3);
+  TEST_EQUALITY(newton.calls().reuses, 4);
+  TEST_EQUALITY(newton.stats().total_rebuilds, 3);
+  TEST_EQUALITY(newton.stats().total_reuses, 4);
+}
+
+TEUCHOS_UNIT_TEST(PreconditionerReuse, SymbolicRecomputes)
+{
+  Newton newton(reuseParameters("Symbolic", 1.5, -1));
+
+  // The reuses recompute the preconditioner on the solver that holds it,
+  // and the rebuild starts from a new solver
+  for (int const iterations : {10, 12, 16, 10}) newton.iterate(iterations);
+
+  TEST_EQUALITY(newton.calls().builds, 2);
+  TEST_EQUALITY(newton.calls().recomputes, 2);
+  TEST_EQUALITY(newton.calls().reuses, 0);
+  TEST_EQUALITY(newton.stats().total_rebuilds, 2);
+  TEST_EQUALITY(newton.stats().total_reuses, 2);
+}
+
+TEUCHOS_UNIT_TEST(PreconditionerReuse, NoneRebuildsEveryJacobian)
+{
+  Newton newton(reuseParameters("None", 2.0, -1));
+
+  for (int i = 0; i < 4; ++i) newton.iterate(10);
+
+  // A single solver, built once and recomputed, as without the decorator
+  TEST_EQUALITY(newton.calls().builds, 1);
+  TEST_EQUALITY(newton.calls().recomputes, 3);
+  TEST_EQUALITY(newton.calls().reuses, 0);
+  TEST_EQUALITY(newton.stats().total_rebuilds, 4);
+  TEST_EQUALITY(newton.stats().total_reuses, 0);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,150 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+// Time of the broad phase of the Moertel 3D integration with the bounding
+// box tree, against the all-pairs loop it replaces in Integrate_3D, for
+// interfaces of n x n quads on a slightly curved surface. The slave side is
+// shifted by half a segment, and the master side is moved by a tenth of a
+// segment between the build and the refit of the tree.
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "mortar/Moertel_BoundingBoxTree.hpp"
+
+namespace {
+
+using MoertelT::BoundingBox;
+using MoertelT::BoundingBoxTree;
+
+// Boxes of the quads of an n x n grid on a slightly curved surface, grown
+// like the mortar segment boxes
+std::vector<BoundingBox>
+surfaceBoxes(int const n, double const shift, double const grow)
+{
+  std::vector<BoundingBox> boxes;
+  double const             h = 1.0 / n;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      BoundingBox box;
+      for (int a = 0; a < 2; ++a) {
+        for (int b = 0; b < 2; ++b) {
+          double const x    = (i + a) * h + shift;
+          double const y    = (j + b) * h;
+          double const p[3] = {x, y, 0.1 * std::sin(3.0 * x) * std::cos(2.0 * y)};
+          box.Add(p);
+        }
+      }
+      box.Inflate(grow * h);
+      boxes.push_back(box);
+    }
+  }
+  return boxes;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  // Create a command line processor and parse command line options
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Mortar broad phase benchmark.\n"
+      "Compares the bounding box tree over the master segments with the "
+      "all-pairs loop, for interface sizes doubling from min-size to max-size.\n");
+
+  int min_size = 16;
+  command_line_processor.setOption("min-size", &min_size, "Smallest number of segments along each side of the interface");
+
+  int max_size = 256;
+  command_line_processor.setOption("max-size", &max_size, "Largest number of segments along each side of the interface");
+
+  int all_pairs_size = 128;
+  command_line_processor.setOption("all-pairs-size", &all_pairs_size, "Largest number of segments along each side for which the all-pairs loop runs");
+
+  // Throw a warning and not error for unrecognized options
+  command_line_processor.recogniseAllOptions(true);
+
+  // Don't throw exceptions for errors
+  command_line_processor.throwExceptions(false);
+
+  // Parse command line
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  using Clock = std::chrono::steady_clock;
+
+  std::cout << '\n';
+  std::cout << std::setw(10) << "segments" << std::setw(14) << "build [s]" << std::setw(14) << "refit [s]" << std::setw(14) << "query [s]" << std::setw(14)
+            << "all pairs [s]" << std::setw(12) << "pairs" << '\n';
+  std::cout << std::scientific << std::setprecision(4);
+
+  int mismatches = 0;
+
+  for (int n = min_size; n <= max_size; n *= 2) {
+    auto const master = surfaceBoxes(n, 0.0, 2.5);
+    auto const moved  = surfaceBoxes(n, 0.1 / n, 2.5);
+    auto const slave  = surfaceBoxes(n, 0.5 / n, 2.5);
+
+    BoundingBoxTree tree;
+
+    auto t0 = Clock::now();
+    tree.Build(master);
+    auto       t1    = Clock::now();
+    auto const build = std::chrono::duration<double>(t1 - t0).count();
+
+    t0 = Clock::now();
+    tree.Refit(moved);
+    t1               = Clock::now();
+    auto const refit = std::chrono::duration<double>(t1 - t0).count();
+
+    std::size_t      tree_pairs = 0;
+    std::vector<int> result;
+    t0 = Clock::now();
+    for (auto const& box : slave) {
+      result.clear();
+      tree.Query(box, result);
+      tree_pairs += result.size();
+    }
+    t1               = Clock::now();
+    auto const query = std::chrono::duration<double>(t1 - t0).count();
+
+    // The all-pairs loop gets slow quickly, and only runs for small sizes
+    double all_pairs = -1.0;
+    if (n <= all_pairs_size) {
+      std::size_t brute_pairs = 0;
+      t0                      = Clock::now();
+      for (auto const& box : slave)
+        for (auto const& mbox : moved)
+          if (mbox.Overlaps(box)) ++brute_pairs;
+      t1        = Clock::now();
+      all_pairs = std::chrono::duration<double>(t1 - t0).count();
+      if (brute_pairs != tree_pairs) ++mismatches;
+    }
+
+    std::cout << std::setw(10) << n * n << std::setw(14) << build << std::setw(14) << refit << std::setw(14) << query << std::setw(14) << all_pairs
+              << std::setw(12) << tree_pairs << '\n';
+  }
+
+  if (mismatches > 0) {
+    std::cout << "The tree and the all-pairs loop found different pairs for " << mismatches << " sizes\n";
+    return 1;
+  }
+  return 0;
+}
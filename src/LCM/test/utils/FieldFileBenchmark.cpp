@@ -0,0 +1,202 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+// Time to load a nodal field from a field file, as done by
+// GenericSTKMeshStruct: an ascii file read by process 0 and scattered
+// to all processes, against a binary file read in parallel and
+// redistributed once. Run with different numbers of processes to get
+// the load time as a function of the number of processes.
+#include <Albany_BinaryFieldFile.hpp>
+#include <Albany_CombineAndScatterManager.hpp>
+#include <Albany_CommUtils.hpp>
+#include <Albany_Gather.hpp>
+#include <Albany_ThyraUtils.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Kokkos_Core.hpp"
+
+namespace {
+
+double
+fieldValue(GO const gid, int const column)
+{
+  return std::sin(0.001 * gid) + column;
+}
+
+// Largest difference between the loaded field and the values written
+double
+fieldError(Teuchos::RCP<Thyra_MultiVector> const& mvec, Teuchos::ArrayView<const GO> const& gids)
+{
+  auto   data  = Albany::getLocalData(*mvec);
+  double error = 0.0;
+  for (int col = 0; col < static_cast<int>(data.size()); ++col) {
+    for (LO i = 0; i < gids.size(); ++i) {
+      error = std::max(error, std::abs(data[col][i] - fieldValue(gids[i], col)));
+    }
+  }
+  return error;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+  Kokkos::initialize(ac, av);
+  {
+    // Create a command line processor and parse command line options
+    Teuchos::CommandLineProcessor command_line_processor;
+
+    command_line_processor.setDocString(
+        "Field file load benchmark.\n"
+        "Compares the serial load of ascii field files with the parallel "
+        "load of binary field files.\n");
+
+    int number_entities = 1000000;
+    command_line_processor.setOption("entities", &number_entities, "Number of entities in the field");
+
+    int number_components = 1;
+    command_line_processor.setOption("components", &number_components, "Number of components of the field");
+
+    int repetitions = 3;
+    command_line_processor.setOption("repetitions", &repetitions, "Number of loads of each file, the best time is reported");
+
+    std::string file_name = "field_benchmark";
+    command_line_processor.setOption("file", &file_name, "Base name of the field files written");
+
+    // Throw a warning and not error for unrecognized options
+    command_line_processor.recogniseAllOptions(true);
+
+    // Don't throw exceptions for errors
+    command_line_processor.throwExceptions(false);
+
+    // Parse command line
+    Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+    if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+      return 0;
+    }
+
+    if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+      return 1;
+    }
+
+    auto      comm = Albany::getDefaultComm();
+    int const rank = comm->getRank();
+    int const size = comm->getSize();
+
+    // Blocks of consecutive GIDs dealt round robin, so that every process
+    // owns entities from the whole file, like the nodes of a partitioned mesh
+    Teuchos::Array<GO> gids;
+    for (GO gid = 0; gid < number_entities; ++gid) {
+      if ((gid / 64) % size == rank) gids.push_back(gid);
+    }
+    auto vs = Albany::createVectorSpace(comm, gids());
+
+    std::string const ascii_file  = file_name + ".ascii";
+    std::string const binary_file = file_name + ".bin";
+
+    // Both files list the entities in GID order
+    if (rank == 0) {
+      std::ofstream ofile(ascii_file.c_str());
+      ofile << std::setprecision(17);
+      ofile << number_entities;
+      if (number_components > 1) ofile << " " << number_components;
+      ofile << "\n";
+
+      Teuchos::Array<GO> all_gids(number_entities);
+      Teuchos::Array<ST> values(number_entities * number_components);
+      for (GO gid = 0; gid < number_entities; ++gid) all_gids[gid] = gid;
+      for (int col = 0; col < number_components; ++col) {
+        for (GO gid = 0; gid < number_entities; ++gid) {
+          values[col * number_entities + gid] = fieldValue(gid, col);
+          ofile << values[col * number_entities + gid] << "\n";
+        }
+      }
+      Albany::writeBinaryFieldFile(binary_file, all_gids(), number_components, values());
+    }
+    comm->barrier();
+
+    using Clock = std::chrono::steady_clock;
+
+    double ascii_time   = 1.0e+300;
+    double binary_time  = 1.0e+300;
+    double ascii_error  = 0.0;
+    double binary_error = 0.0;
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+      // Ascii: the GIDs are gathered on process 0, which reads the whole file
+      // and scatters it
+      auto t0 = Clock::now();
+
+      Teuchos::Array<GO> serial_gids;
+      Albany::gatherV(comm, gids(), serial_gids, 0);
+      std::sort(serial_gids.begin(), serial_gids.end());
+      auto serial_vs   = Albany::createVectorSpace(comm, serial_gids());
+      auto serial_mvec = Thyra::createMembers(serial_vs, number_components);
+      if (rank == 0) {
+        std::ifstream ifile(ascii_file.c_str());
+        GO            num_entities;
+        int           num_components = 1;
+        ifile >> num_entities;
+        if (number_components > 1) ifile >> num_components;
+        auto data = Albany::getNonconstLocalData(serial_mvec);
+        for (int col = 0; col < num_components; ++col) {
+          for (GO i = 0; i < num_entities; ++i) ifile >> data[col][i];
+        }
+      }
+      auto ascii_mvec = Thyra::createMembers(vs, number_components);
+      Albany::createCombineAndScatterManager(serial_vs, vs)->scatter(*serial_mvec, *ascii_mvec, Albany::CombineMode::INSERT);
+      comm->barrier();
+
+      auto t1 = Clock::now();
+
+      // Binary: every process reads a contiguous chunk, redistributed once
+      std::vector<double> layers_coords;
+      auto                binary_mvec = Albany::loadBinaryFieldFile(binary_file, vs, comm, layers_coords);
+      comm->barrier();
+
+      auto t2 = Clock::now();
+
+      ascii_time   = std::min(ascii_time, std::chrono::duration<double>(t1 - t0).count());
+      binary_time  = std::min(binary_time, std::chrono::duration<double>(t2 - t1).count());
+      ascii_error  = std::max(ascii_error, fieldError(ascii_mvec, gids()));
+      binary_error = std::max(binary_error, fieldError(binary_mvec, gids()));
+    }
+
+    double times[2]  = {ascii_time, binary_time};
+    double errors[2] = {ascii_error, binary_error};
+    double max_times[2];
+    double max_errors[2];
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 2, times, max_times);
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 2, errors, max_errors);
+
+    if (rank == 0) {
+      std::remove(ascii_file.c_str());
+      std::remove(binary_file.c_str());
+
+      std::cout << '\n';
+      std::cout << "Processes       : " << size << '\n';
+      std::cout << "Entities        : " << number_entities << '\n';
+      std::cout << "Components      : " << number_components << '\n';
+      std::cout << std::scientific << std::setprecision(4);
+      std::cout << "Ascii load [s]  : " << max_times[0] << "  (max error " << max_errors[0] << ")\n";
+      std::cout << "Binary load [s] : " << max_times[1] << "  (max error " << max_errors[1] << ")\n";
+      std::cout << std::fixed << std::setprecision(2);
+      std::cout << "Speedup         : " << max_times[0] / max_times[1] << '\n';
+    }
+  }
+  Kokkos::finalize();
+  return 0;
+}
@@ -19,8 +19,18 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_as.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <new>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "Albany_MaterialDatabase.hpp"
 #include "BifurcationCheck.hpp"
@@ -43,6 +53,351 @@ struct KokkosGuard
   ~KokkosGuard() { Kokkos::finalize(); }
 };
 
+namespace {
+
+// Calls to operator new in the timed evaluations of the benchmark, for the
+// allocations per point
+std::atomic<bool>      count_allocations{false};
+std::atomic<long long> allocation_count{0};
+
+int const hex_nodes = 8;
+
+// Sign of the coordinate dim of node n of the reference hexahedron
+double
+hexNodeSign(int const n, int const dim)
+{
+  switch (dim) {
+    case 0: return (n % 4 == 1 || n % 4 == 2) ? 1.0 : -1.0;
+    case 1: return (n % 4 >= 2) ? 1.0 : -1.0;
+    default: return n >= 4 ? 1.0 : -1.0;
+  }
+}
+
+void
+seedDefGrad(RealType const value, int const, int const, RealType& def_grad)
+{
+  def_grad = value;
+}
+
+// The derivatives of F(i, j) with respect to the displacements of the nodes
+// of a trilinear hexahedron at its center, as in a finite element assembly
+void
+seedDefGrad(RealType const value, int const i, int const j, FadType& def_grad)
+{
+  def_grad = FadType(3 * hex_nodes, value);
+  for (int n = 0; n < hex_nodes; ++n) def_grad.fastAccessDx(3 * n + i) = 0.125 * hexNodeSign(n, j);
+}
+
+// Deformation gradient, its determinant and the small strain of a point
+template <typename ScalarT>
+void
+setKinematics(minitensor::Tensor<RealType> const& F, ScalarT* def_grad, ScalarT& det_def_grad, ScalarT* strain)
+{
+  minitensor::Tensor<ScalarT> F_seeded(3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) seedDefGrad(F(i, j), i, j, F_seeded(i, j));
+  }
+  minitensor::Tensor<ScalarT> const small_strain = 0.5 * (F_seeded + minitensor::transpose(F_seeded)) - minitensor::eye<ScalarT>(3);
+
+  det_def_grad = minitensor::det(F_seeded);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      def_grad[3 * i + j] = F_seeded(i, j);
+      strain[3 * i + j]   = small_strain(i, j);
+    }
+  }
+}
+
+// Deformation gradient at the end of the loading of the input file
+minitensor::Tensor<RealType>
+finalDefGrad(Teuchos::ParameterList& mpsParams, int const number_steps, double const step_size)
+{
+  std::string const     load_case = mpsParams.get<std::string>("Loading Case Name", "uniaxial");
+  std::vector<RealType> F_vector(9, 0.0);
+  if (load_case == "uniaxial") {
+    F_vector[0] = 1.0 + number_steps * step_size;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (load_case == "simple-shear") {
+    F_vector[0] = 1.0;
+    F_vector[1] = number_steps * step_size;
+    F_vector[4] = 1.0;
+    F_vector[8] = 1.0;
+  } else if (load_case == "hydrostatic") {
+    F_vector[0] = 1.0 + number_steps * step_size;
+    F_vector[4] = 1.0 + number_steps * step_size;
+    F_vector[8] = 1.0 + number_steps * step_size;
+  } else if (load_case == "general") {
+    F_vector = mpsParams.get<Teuchos::Array<double>>("Deformation Gradient Components").toVector();
+  } else {
+    ALBANY_ABORT("Improper Loading Case in Material Point Simulator block");
+  }
+  return minitensor::Tensor<RealType>(3, &F_vector[0]);
+}
+
+// Options of the benchmark mode, the same for all the models
+struct BenchmarkOptions
+{
+  int                          workset_size;
+  int                          num_pts;
+  int                          number_steps;
+  double                       step_size;
+  double                       perturbation;
+  bool                         have_temperature;
+  double                       temperature;
+  minitensor::Tensor<RealType> log_F;
+};
+
+// Fields of the points set for the model by SetField evaluators
+template <typename EvalT>
+struct BenchmarkFields
+{
+  using ScalarT = typename EvalT::ScalarT;
+  using Traits  = PHAL::AlbanyTraits;
+
+  BenchmarkFields(int const num_points, BenchmarkOptions const& options)
+      : def_grad(9 * num_points),
+        det_def_grad(num_points),
+        strain(9 * num_points),
+        temperature(num_points, ScalarT(options.temperature)),
+        delta_time(1, ScalarT(options.step_size))
+  {
+  }
+
+  // The SetField evaluators, and the model with its parameters
+  Teuchos::RCP<LCM::ConstitutiveModelInterface<EvalT, Traits>>
+  registerEvaluators(
+      PHX::FieldManager<Traits>&           fm,
+      Teuchos::RCP<Albany::Layouts> const& dl,
+      bool const                           have_temperature,
+      Teuchos::ParameterList&              cmpPL,
+      Teuchos::ParameterList&              cmiPL) const
+  {
+    auto registerSetField = [&](std::string const& name, Teuchos::RCP<PHX::DataLayout> const& layout, Teuchos::ArrayRCP<ScalarT> const& values) {
+      Teuchos::ParameterList setP("SetField" + name);
+      setP.set<std::string>("Evaluated Field Name", name);
+      setP.set<Teuchos::RCP<PHX::DataLayout>>("Evaluated Field Data Layout", layout);
+      setP.set<Teuchos::ArrayRCP<ScalarT>>("Field Values", values);
+      fm.template registerEvaluator<EvalT>(Teuchos::rcp(new LCM::SetField<EvalT, Traits>(setP)));
+    };
+    registerSetField("F", dl->qp_tensor, def_grad);
+    registerSetField("J", dl->qp_scalar, det_def_grad);
+    registerSetField("Strain", dl->qp_tensor, strain);
+    registerSetField("Delta Time", dl->workset_scalar, delta_time);
+    if (have_temperature) registerSetField("Temperature", dl->qp_scalar, temperature);
+
+    fm.template registerEvaluator<EvalT>(Teuchos::rcp(new LCM::ConstitutiveModelParameters<EvalT, Traits>(cmpPL, dl)));
+    auto CMI = Teuchos::rcp(new LCM::ConstitutiveModelInterface<EvalT, Traits>(cmiPL, dl));
+    fm.template registerEvaluator<EvalT>(CMI);
+    return CMI;
+  }
+
+  Teuchos::ArrayRCP<ScalarT> def_grad;
+  Teuchos::ArrayRCP<ScalarT> det_def_grad;
+  Teuchos::ArrayRCP<ScalarT> strain;
+  Teuchos::ArrayRCP<ScalarT> temperature;
+  Teuchos::ArrayRCP<ScalarT> delta_time;
+};
+
+// Time and calls to operator new of an evaluation. Kokkos is fenced before
+// the clock is read on both ends, so the time includes the kernels that the
+// evaluation launched.
+template <typename Evaluation>
+void
+timeEvaluation(Evaluation const& evaluation, double& time, long long& allocations)
+{
+  using Clock = std::chrono::steady_clock;
+
+  Kokkos::fence();
+  allocation_count  = 0;
+  count_allocations = true;
+  auto const start  = Clock::now();
+  evaluation();
+  Kokkos::fence();
+  auto const end    = Clock::now();
+  count_allocations = false;
+  time += std::chrono::duration<double>(end - start).count();
+  allocations += allocation_count;
+}
+
+// Benchmark of the model of a material: the same loading at every point of
+// the workset, scaled by a factor in [1 - perturbation, 1 + perturbation]
+// drawn for every point, so that around the yield point some points load
+// plastically and others stay elastic. The model is evaluated for Residual
+// and Jacobian at every step, and the results are appended to bout.
+void
+benchmarkModel(Teuchos::ParameterList& paramList, BenchmarkOptions const& options, Teuchos::RCP<Teuchos_Comm const> const& comm, std::ostream& bout)
+{
+  using Residual = PHAL::AlbanyTraits::Residual;
+  using Jacobian = PHAL::AlbanyTraits::Jacobian;
+  using Traits   = PHAL::AlbanyTraits;
+
+  // The block of the mesh of the states
+  std::string const element_block_name = "Block0";
+  std::string const model_name         = paramList.sublist("Material Model").get<std::string>("Model Name");
+
+  int const  num_points = options.workset_size * options.num_pts;
+  auto const dl         = Teuchos::rcp(new Albany::Layouts(options.workset_size, hex_nodes, hex_nodes, options.num_pts, 3));
+
+  LCM::FieldNameMap field_name_map(false);
+  paramList.set<Teuchos::RCP<std::map<std::string, std::string>>>("Name Map", field_name_map.getMap());
+  paramList.set<bool>("Compute Tangent", false);
+  Teuchos::ParameterList cmpPL;
+  Teuchos::ParameterList cmiPL;
+  cmpPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
+  cmiPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
+  if (options.have_temperature) {
+    cmpPL.set<std::string>("Temperature Name", "Temperature");
+    cmiPL.set<std::string>("Temperature Name", "Temperature");
+    paramList.set<bool>("Have Temperature", true);
+  }
+
+  BenchmarkFields<Residual> residual_fields(num_points, options);
+  BenchmarkFields<Jacobian> jacobian_fields(num_points, options);
+
+  PHX::FieldManager<Traits> residualFieldManager;
+  PHX::FieldManager<Traits> jacobianFieldManager;
+  PHX::FieldManager<Traits> stateFieldManager;
+
+  auto residualCMI = residual_fields.registerEvaluators(residualFieldManager, dl, options.have_temperature, cmpPL, cmiPL);
+  auto jacobianCMI = jacobian_fields.registerEvaluators(jacobianFieldManager, dl, options.have_temperature, cmpPL, cmiPL);
+  auto stateCMI    = residual_fields.registerEvaluators(stateFieldManager, dl, options.have_temperature, cmpPL, cmiPL);
+  for (auto const& tag : residualCMI->evaluatedFields()) residualFieldManager.requireField<Residual>(*tag);
+  for (auto const& tag : jacobianCMI->evaluatedFields()) jacobianFieldManager.requireField<Jacobian>(*tag);
+
+  // The states of the model, saved after every step
+  Albany::StateManager stateMgr;
+  for (int sv = 0; sv < stateCMI->getNumStateVars(); ++sv) {
+    stateCMI->fillStateVariableStruct(sv);
+    auto p = stateMgr.registerStateVariable(
+        stateCMI->getName(),
+        stateCMI->getLayout(),
+        dl->dummy,
+        element_block_name,
+        stateCMI->getInitType(),
+        stateCMI->getInitValue(),
+        stateCMI->getStateFlag(),
+        stateCMI->getOutputFlag());
+    stateFieldManager.registerEvaluator<Residual>(Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p)));
+  }
+
+  PHAL::Setup setupData;
+  residualFieldManager.postRegistrationSetup(setupData);
+  std::vector<PHX::index_size_type> derivative_dimensions(1, 3 * hex_nodes);
+  jacobianFieldManager.setKokkosExtendedDataTypeDimensions<Jacobian>(derivative_dimensions);
+  jacobianFieldManager.postRegistrationSetup(setupData);
+  Teuchos::RCP<PHX::DataLayout> dummy = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  for (auto const& responseID : stateMgr.getResidResponseIDsToRequire(element_block_name)) {
+    stateFieldManager.requireField<Residual>(PHX::Tag<Residual::ScalarT>(responseID, dummy));
+  }
+  stateFieldManager.postRegistrationSetup(setupData);
+
+  // Create discretization, as required by the StateManager
+  Teuchos::RCP<Teuchos::ParameterList> discretizationParameterList = Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", options.workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<int>("Workset Size", options.workset_size);
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct = Teuchos::rcp(new Albany::TmplSTKMeshStruct<3>(discretizationParameterList, Teuchos::null, comm));
+  stkMeshStruct->setFieldAndBulkData(comm, discretizationParameterList, 3, req, stateMgr.getStateInfoStruct(), stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization = Teuchos::rcp(new Albany::STKDiscretization(discretizationParameterList, stkMeshStruct, comm));
+  static_cast<Albany::STKDiscretization&>(*discretization).updateMesh();
+  stateMgr.setupStateArrays(discretization);
+
+  PHAL::Workset workset;
+  workset.numCells      = options.workset_size;
+  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+
+  std::mt19937                           generator(0);
+  std::uniform_real_distribution<double> distribution(-options.perturbation, options.perturbation);
+  std::vector<double>                    load_factors(num_points);
+  for (auto& factor : load_factors) factor = 1.0 + distribution(generator);
+
+  double    residual_time        = 0.0;
+  double    jacobian_time        = 0.0;
+  long long residual_allocations = 0;
+  long long jacobian_allocations = 0;
+
+  for (int istep(0); istep <= options.number_steps; ++istep) {
+    double const alpha = double(istep) / options.number_steps;
+    for (int p = 0; p < num_points; ++p) {
+      minitensor::Tensor<RealType> const current_F = minitensor::exp(alpha * load_factors[p] * options.log_F);
+      setKinematics(current_F, &residual_fields.def_grad[9 * p], residual_fields.det_def_grad[p], &residual_fields.strain[9 * p]);
+      setKinematics(current_F, &jacobian_fields.def_grad[9 * p], jacobian_fields.det_def_grad[p], &jacobian_fields.strain[9 * p]);
+    }
+
+    timeEvaluation(
+        [&]() {
+          residualFieldManager.preEvaluate<Residual>(workset);
+          residualFieldManager.evaluateFields<Residual>(workset);
+          residualFieldManager.postEvaluate<Residual>(workset);
+        },
+        residual_time,
+        residual_allocations);
+
+    timeEvaluation(
+        [&]() {
+          jacobianFieldManager.preEvaluate<Jacobian>(workset);
+          jacobianFieldManager.evaluateFields<Jacobian>(workset);
+          jacobianFieldManager.postEvaluate<Jacobian>(workset);
+        },
+        jacobian_time,
+        jacobian_allocations);
+
+    // Save the states for the next step, not timed
+    stateFieldManager.preEvaluate<Residual>(workset);
+    stateFieldManager.evaluateFields<Residual>(workset);
+    stateFieldManager.postEvaluate<Residual>(workset);
+    stateMgr.updateStates();
+  }
+
+  int const num_evaluations = options.number_steps + 1;
+
+  std::cout << "\nBenchmark of " << model_name << " over " << options.workset_size << " cells x " << options.num_pts << " points, " << num_evaluations
+            << " steps\n";
+  for (int eval = 0; eval < 2; ++eval) {
+    std::string const evaluation        = eval == 0 ? "Residual" : "Jacobian";
+    double const      time              = eval == 0 ? residual_time : jacobian_time;
+    long long const   allocations       = eval == 0 ? residual_allocations : jacobian_allocations;
+    double const      step_time         = time / num_evaluations;
+    double const      throughput        = double(num_points) * num_evaluations / time;
+    double const      point_allocations = double(allocations) / (double(num_points) * num_evaluations);
+
+    std::cout << std::setw(8) << evaluation << ": " << std::scientific << std::setprecision(4) << step_time << " s/step, " << throughput << " points/s, "
+              << std::fixed << std::setprecision(2) << point_allocations << " allocations/point\n";
+    bout << model_name << "," << evaluation << "," << options.workset_size << "," << options.num_pts << "," << num_evaluations << "," << options.perturbation
+         << "," << std::scientific << std::setprecision(6) << time << "," << step_time << "," << throughput << "," << point_allocations << "\n";
+    bout << std::defaultfloat;
+  }
+}
+
+}  // anonymous namespace
+
+void*
+operator new(std::size_t size)
+{
+  if (count_allocations.load(std::memory_order_relaxed) == true) allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
 int
 main(int ac, char* av[])
 {
@@ -74,6 +429,23 @@ main(int ac, char* av[])
   size_t memlimit = 1024;  // 1GB heap limit by default
   command_line_processor.setOption("memlimit", &memlimit, "Heap memory limit in MB for CUDA kernels");
 
+  bool benchmark = false;
+  command_line_processor.setOption(
+      "benchmark", "no-benchmark", &benchmark, "Measure the throughput of the model over wsize cells of npoints points, without output");
+
+  double perturbation = 0.0;
+  command_line_processor.setOption("perturbation", &perturbation, "Relative spread of the load over the points in benchmark mode");
+
+  std::string benchmark_file = "benchmark.csv";
+  command_line_processor.setOption("benchmark-output", &benchmark_file, "Benchmark results file, appended to");
+
+  std::string benchmark_models = "";
+  command_line_processor.setOption(
+      "models",
+      &benchmark_models,
+      "Models to benchmark, separated by commas, or all for every model known to ConstitutiveModelInterface. Each model runs with the first material of "
+      "the input file that uses it. By default, the model of Block0");
+
   // Throw a warning and not error for unrecognized options
   command_line_processor.recogniseAllOptions(true);
 
@@ -114,6 +486,62 @@ main(int ac, char* av[])
   material_model_name = material_db->getElementBlockSublist(element_block_name, "Material Model").get<std::string>("Model Name");
   ALBANY_PANIC(material_model_name.length() == 0, "A material model must be defined for block: " + element_block_name);
 
+  // Benchmark mode, with the loading of the material of Block0 for all the
+  // models
+  if (benchmark) {
+    std::string const       block_material = material_db->getElementBlockParam<std::string>(element_block_name, "material");
+    Teuchos::ParameterList& mps            = material_db->getElementBlockSublist(element_block_name, block_material).sublist("Material Point Simulator");
+
+    BenchmarkOptions options;
+    options.workset_size     = workset_size;
+    options.num_pts          = num_pts;
+    options.number_steps     = mps.get<int>("Number of Steps", 10);
+    options.step_size        = mps.get<double>("Step Size", 1.0e-2);
+    options.perturbation     = perturbation;
+    options.have_temperature = mps.get<bool>("Use Temperature", false);
+    options.temperature      = mps.get<double>("Temperature", 1.0);
+    options.log_F            = minitensor::log(finalDefGrad(mps, options.number_steps, options.step_size));
+
+    // The first block of the input file for every model
+    std::map<std::string, std::string> model_blocks;
+    for (int block = 0; material_db->isElementBlockParam("Block" + std::to_string(block), "material"); ++block) {
+      std::string const block_name = "Block" + std::to_string(block);
+      std::string const model      = material_db->getElementBlockSublist(block_name, "Material Model").get<std::string>("Model Name");
+      model_blocks.emplace(model, block_name);
+    }
+
+    std::vector<std::string> models;
+    if (benchmark_models == "") {
+      models.push_back(material_model_name);
+    } else if (benchmark_models == "all") {
+      models = LCM::ConstitutiveModelInterface<Residual, Traits>::modelNames();
+    } else {
+      std::istringstream names(benchmark_models);
+      for (std::string name; std::getline(names, name, ',');) models.push_back(name);
+    }
+
+    std::ifstream existing(benchmark_file.c_str());
+    bool const    write_header = !existing.good() || existing.peek() == std::ifstream::traits_type::eof();
+    existing.close();
+
+    std::ofstream bout(benchmark_file.c_str(), std::ios::app);
+    if (write_header) {
+      bout << "model,evaluation,cells,points_per_cell,steps,perturbation,time_s,time_per_step_s,points_per_s,allocations_per_point\n";
+    }
+
+    for (auto const& model : models) {
+      auto const block = model_blocks.find(model);
+      if (block == model_blocks.end()) {
+        std::cout << "\nNo material of " << input_file << " uses " << model << ", not benchmarked\n";
+        continue;
+      }
+      std::string const      material     = material_db->getElementBlockParam<std::string>(block->second, "material");
+      Teuchos::ParameterList model_params = material_db->getElementBlockSublist(block->second, material);
+      benchmarkModel(model_params, options, commT, bout);
+    }
+    return 0;
+  }
+
   // Preloading stage setup
   // set up evaluators, create field and state managers
 
@@ -204,9 +632,8 @@ main(int ac, char* av[])
   Teuchos::ParameterList& mpsParams = paramList.sublist("Material Point Simulator");
 
   // Get loading parameters from .xml file
-  std::string load_case    = mpsParams.get<std::string>("Loading Case Name", "uniaxial");
-  int         number_steps = mpsParams.get<int>("Number of Steps", 10);
-  double      step_size    = mpsParams.get<double>("Step Size", 1.0e-2);
+  int    number_steps = mpsParams.get<int>("Number of Steps", 10);
+  double step_size    = mpsParams.get<double>("Step Size", 1.0e-2);
 
   std::cout << "Loading parameters:"
             << "\n  number of steps: " << number_steps << "\n  step_size      : " << step_size << std::endl;
@@ -216,9 +643,9 @@ main(int ac, char* av[])
   std::cout << "have_temp: " << have_temperature << std::endl;
   // Temperature (optional)
   if (have_temperature) {
-    Teuchos::ArrayRCP<ScalarT> temperature(workset_size);
+    Teuchos::ArrayRCP<ScalarT> temperature(workset_size * num_pts);
     ScalarT                    temp = mpsParams.get<double>("Temperature", 1.0);
-    for (int i = 0; i < workset_size * num_pts; ++i) temperature[0] = temp;
+    for (int i = 0; i < workset_size * num_pts; ++i) temperature[i] = temp;
     // SetField evaluator, which will be used to manually assign a value
     // to the detdefgrad field
     Teuchos::ParameterList setTempP("SetFieldTemperature");
@@ -400,28 +827,7 @@ main(int ac, char* av[])
   // create MDFields
   PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> stressField("Cauchy_Stress", dl->qp_tensor);
 
-  // construct the final deformation gradient based on the loading case
-  std::vector<ScalarT> F_vector(9, 0.0);
-  if (load_case == "uniaxial") {
-    F_vector[0] = 1.0 + number_steps * step_size;
-    F_vector[4] = 1.0;
-    F_vector[8] = 1.0;
-  } else if (load_case == "simple-shear") {
-    F_vector[0] = 1.0;
-    F_vector[1] = number_steps * step_size;
-    F_vector[4] = 1.0;
-    F_vector[8] = 1.0;
-  } else if (load_case == "hydrostatic") {
-    F_vector[0] = 1.0 + number_steps * step_size;
-    F_vector[4] = 1.0 + number_steps * step_size;
-    F_vector[8] = 1.0 + number_steps * step_size;
-  } else if (load_case == "general") {
-    F_vector = mpsParams.get<Teuchos::Array<double>>("Deformation Gradient Components").toVector();
-  } else {
-    ALBANY_ABORT("Improper Loading Case in Material Point Simulator block");
-  }
-
-  minitensor::Tensor<ScalarT> F_tensor(3, &F_vector[0]);
+  minitensor::Tensor<ScalarT> F_tensor = finalDefGrad(mpsParams, number_steps, step_size);
   minitensor::Tensor<ScalarT> log_F_tensor = minitensor::log(F_tensor);
 
   std::cout << "F\n" << F_tensor << std::endl;
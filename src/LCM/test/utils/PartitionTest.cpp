@@ -75,6 +75,19 @@ main(int ac, char* av[])
 
   command_line_processor.setOption("initializer", &initializer_scheme, number_initializers, initializer_values, initializer_names, "Initializer Scheme");
 
+  // Quality of a reference partition of the same mesh, checked if given
+  int reference_edge_cut = -1;
+
+  command_line_processor.setOption("reference-edge-cut", &reference_edge_cut, "Edge cut of the reference partition");
+
+  double reference_imbalance = 0.0;
+
+  command_line_processor.setOption("reference-imbalance", &reference_imbalance, "Imbalance of the reference partition");
+
+  double quality_tolerance = 0.1;
+
+  command_line_processor.setOption("quality-tolerance", &quality_tolerance, "Relative tolerance on the edge cut and imbalance");
+
   // Throw a warning and not error for unrecognized options
   command_line_processor.recogniseAllOptions(true);
 
@@ -197,9 +210,51 @@ main(int ac, char* av[])
     std::cout << volume / length_scale_cubed << '\n';
   }
 
+  // Quality: faces between elements of different partitions, and largest
+  // partition volume over the average one
+  LCM::DualGraph const    dual_graph(connectivity_array);
+  LCM::AdjacencyMap const edge_list = dual_graph.getEdgeList();
+
+  int edge_cut = 0;
+
+  for (auto&& edge_vertices : edge_list) {
+    LCM::IDList const& vertices = edge_vertices.second;
+
+    if (vertices.size() == 2 && partitions.at(vertices[0]) != partitions.at(vertices[1])) ++edge_cut;
+  }
+
+  double maximum_volume = 0.0;
+
+  for (auto&& partition_volume : partition_volumes) {
+    maximum_volume = std::max(maximum_volume, partition_volume.second);
+  }
+
+  double const imbalance = maximum_volume * number_partitions / volume;
+
+  std::cout << "------------------------------------------";
+  std::cout << '\n';
+  std::cout << "Edge Cut                 : " << edge_cut << '\n';
+  std::cout << "Imbalance (max Vi / V/n) : ";
+  std::cout << std::scientific << std::setw(14) << std::setprecision(8);
+  std::cout << imbalance << '\n';
+
   std::chrono::duration<double> elapsed_seconds = end - start;
   std::cout << std::scientific << std::setw(16) << std::setprecision(8);
   std::cout << "PARTITION TIME [s]: " << elapsed_seconds.count() << std::endl;
 
-  return 0;
+  // The partition may be better than the reference, but not worse by more
+  // than the tolerance
+  bool passed = true;
+
+  if (reference_edge_cut >= 0 && edge_cut > (1.0 + quality_tolerance) * reference_edge_cut) {
+    std::cerr << "Edge cut " << edge_cut << " is worse than the reference " << reference_edge_cut << '\n';
+    passed = false;
+  }
+
+  if (reference_imbalance > 0.0 && imbalance > (1.0 + quality_tolerance) * reference_imbalance) {
+    std::cerr << "Imbalance " << imbalance << " is worse than the reference " << reference_imbalance << '\n';
+    passed = false;
+  }
+
+  return passed == true ? 0 : 1;
 }
@@ -0,0 +1,306 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+// Time to scatter element residuals and Jacobians into the global ones, as
+// done by PHAL::ScatterResidual: one kernel per element color with plain
+// stores and whole-row sumIntoValues, against one kernel per workset with
+// atomics and one sumIntoValues per entry. The mesh is a cube of hexahedra.
+// Build with a serial and with a threaded Kokkos to compare both.
+#include <Albany_DiscretizationUtils.hpp>
+#include <Albany_ThyraCrsMatrixFactory.hpp>
+#include <Albany_ThyraUtils.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_DefaultSerialComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "Kokkos_Core.hpp"
+
+namespace {
+
+using ExecutionSpace = PHX::Device::execution_space;
+using Policy         = Kokkos::RangePolicy<ExecutionSpace>;
+
+// Elements of a workset, with their node GIDs, and their equation LIDs
+struct Workset
+{
+  Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>> elNodeID;
+  Albany::WorksetConn                      nodeID;
+  Albany::WorksetColoring                  coloring;
+};
+
+// Worksets of consecutive hexahedra of a cube of cells^3 hexahedra. The
+// equations of a node are consecutive.
+std::vector<Workset>
+cubeWorksets(int const cells, int const neq, int const workset_size)
+{
+  int const num_elements = cells * cells * cells;
+  auto      node_gid     = [cells](int const i, int const j, int const k) -> GO { return i + (cells + 1) * (j + (cells + 1) * k); };
+
+  std::vector<Workset> worksets;
+  for (int first = 0; first < num_elements; first += workset_size) {
+    int const num_cells = std::min(workset_size, num_elements - first);
+    Workset   ws;
+    ws.elNodeID = Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>(num_cells);
+    ws.nodeID   = Albany::WorksetConn("nodeID", num_cells, 8, neq);
+    auto nodeID = Kokkos::create_mirror_view(ws.nodeID);
+    for (int cell = 0; cell < num_cells; ++cell) {
+      int const e = first + cell;
+      int const i = e % cells;
+      int const j = (e / cells) % cells;
+      int const k = e / (cells * cells);
+      GO const  nodes[8] = {
+          node_gid(i, j, k),     node_gid(i + 1, j, k),     node_gid(i + 1, j + 1, k),     node_gid(i, j + 1, k),
+          node_gid(i, j, k + 1), node_gid(i + 1, j, k + 1), node_gid(i + 1, j + 1, k + 1), node_gid(i, j + 1, k + 1)};
+      ws.elNodeID[cell] = Teuchos::ArrayRCP<GO>(8);
+      for (int node = 0; node < 8; ++node) {
+        ws.elNodeID[cell][node] = nodes[node];
+        for (int eq = 0; eq < neq; ++eq) nodeID(cell, node, eq) = nodes[node] * neq + eq;
+      }
+    }
+    Kokkos::deep_copy(ws.nodeID, nodeID);
+    ws.coloring = Albany::colorElements(ws.elNodeID);
+    worksets.push_back(ws);
+  }
+  return worksets;
+}
+
+// Residual of an element unknown, and derivative of it with respect to
+// another unknown of the element
+KOKKOS_INLINE_FUNCTION
+ST
+residualValue(int const cell, int const unknown)
+{
+  return 1.0 + 0.001 * cell + 0.01 * unknown;
+}
+
+KOKKOS_INLINE_FUNCTION
+ST
+derivativeValue(int const cell, int const row, int const col)
+{
+  return (row == col ? 2.0 : -0.1) + 0.001 * cell;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+  Kokkos::initialize(ac, av);
+  {
+    // Create a command line processor and parse command line options
+    Teuchos::CommandLineProcessor command_line_processor;
+
+    command_line_processor.setDocString(
+        "Residual and Jacobian scatter benchmark.\n"
+        "Compares the scatter by element colors without atomics with the "
+        "scatter by worksets with atomics.\n");
+
+    int cells = 40;
+    command_line_processor.setOption("cells", &cells, "Number of hexahedra along each side of the cube");
+
+    int number_equations = 3;
+    command_line_processor.setOption("equations", &number_equations, "Number of equations per node");
+
+    int workset_size = 1000;
+    command_line_processor.setOption("workset-size", &workset_size, "Number of elements per workset");
+
+    int repetitions = 5;
+    command_line_processor.setOption("repetitions", &repetitions, "Number of scatters of each kind, the best time is reported");
+
+    // Throw a warning and not error for unrecognized options
+    command_line_processor.recogniseAllOptions(true);
+
+    // Don't throw exceptions for errors
+    command_line_processor.throwExceptions(false);
+
+    // Parse command line
+    Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+    if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+      return 0;
+    }
+
+    if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+      return 1;
+    }
+
+    // The scatter is local to a process
+    Teuchos::RCP<Teuchos_Comm const> comm = Teuchos::rcp(new Teuchos::SerialComm<int>());
+
+    int const neq      = number_equations;
+    int const nunk     = 8 * neq;
+    auto      worksets = cubeWorksets(cells, neq, workset_size);
+
+    GO const           num_dofs = static_cast<GO>(cells + 1) * (cells + 1) * (cells + 1) * neq;
+    Teuchos::Array<GO> gids(num_dofs);
+    for (GO dof = 0; dof < num_dofs; ++dof) gids[dof] = dof;
+    auto vs = Albany::createVectorSpace(comm, gids());
+
+    Albany::ThyraCrsMatrixFactory factory(vs, vs);
+    for (auto const& ws : worksets) {
+      for (int cell = 0; cell < ws.elNodeID.size(); ++cell) {
+        Teuchos::Array<GO> dofs;
+        for (int node = 0; node < 8; ++node) {
+          for (int eq = 0; eq < neq; ++eq) dofs.push_back(ws.elNodeID[cell][node] * neq + eq);
+        }
+        for (GO const row : dofs) factory.insertGlobalIndices(row, dofs());
+      }
+    }
+    factory.fillComplete();
+
+    auto                          f_colored   = Thyra::createMember(vs);
+    auto                          f_atomic    = Thyra::createMember(vs);
+    auto                          jac_colored = factory.createOp();
+    auto                          jac_atomic  = factory.createOp();
+    Albany::DeviceView1d<ST>      f_kokkos;
+    Albany::DeviceLocalMatrix<ST> Jac_kokkos;
+
+    // Per-cell column LIDs and derivative values, as in ScatterResidual
+    Kokkos::View<LO**, Kokkos::LayoutRight, PHX::Device> colScratch("colScratch", workset_size, nunk);
+    Kokkos::View<ST**, Kokkos::LayoutRight, PHX::Device> valScratch("valScratch", workset_size, nunk);
+
+    using Clock = std::chrono::steady_clock;
+
+    double colored_residual = 1.0e+300;
+    double atomic_residual  = 1.0e+300;
+    double colored_jacobian = 1.0e+300;
+    double atomic_jacobian  = 1.0e+300;
+    int    max_colors       = 0;
+    for (auto const& ws : worksets) max_colors = std::max(max_colors, ws.coloring.numColors());
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+      // Residual, by colors with plain stores
+      f_colored->assign(0.0);
+      f_kokkos = Albany::getNonconstDeviceData(f_colored);
+      Kokkos::fence();
+      auto t0 = Clock::now();
+      for (auto const& ws : worksets) {
+        auto const nodeID   = ws.nodeID;
+        auto const elements = ws.coloring.elements;
+        for (int color = 0; color < ws.coloring.numColors(); ++color) {
+          Kokkos::parallel_for(
+              "ScatterBenchmark::colored_residual", Policy(ws.coloring.offsets[color], ws.coloring.offsets[color + 1]), KOKKOS_LAMBDA(int const index) {
+                int const cell = elements(index);
+                for (int node = 0; node < 8; ++node)
+                  for (int eq = 0; eq < neq; ++eq) f_kokkos(nodeID(cell, node, eq)) += residualValue(cell, node * neq + eq);
+              });
+        }
+      }
+      Kokkos::fence();
+      auto t1 = Clock::now();
+
+      // Residual, by worksets with atomics
+      f_atomic->assign(0.0);
+      f_kokkos = Albany::getNonconstDeviceData(f_atomic);
+      Kokkos::fence();
+      auto t2 = Clock::now();
+      for (auto const& ws : worksets) {
+        auto const nodeID = ws.nodeID;
+        Kokkos::parallel_for(
+            "ScatterBenchmark::atomic_residual", Policy(0, ws.elNodeID.size()), KOKKOS_LAMBDA(int const cell) {
+              for (int node = 0; node < 8; ++node)
+                for (int eq = 0; eq < neq; ++eq) Kokkos::atomic_fetch_add(&f_kokkos(nodeID(cell, node, eq)), residualValue(cell, node * neq + eq));
+            });
+      }
+      Kokkos::fence();
+      auto t3 = Clock::now();
+
+      // Jacobian, by colors with whole-row sumIntoValues
+      Albany::resumeFill(jac_colored);
+      Albany::assign(jac_colored, 0.0);
+      Jac_kokkos = Albany::getNonconstDeviceData(jac_colored);
+      Kokkos::fence();
+      auto t4 = Clock::now();
+      for (auto const& ws : worksets) {
+        auto const nodeID   = ws.nodeID;
+        auto const elements = ws.coloring.elements;
+        for (int color = 0; color < ws.coloring.numColors(); ++color) {
+          Kokkos::parallel_for(
+              "ScatterBenchmark::colored_jacobian", Policy(ws.coloring.offsets[color], ws.coloring.offsets[color + 1]), KOKKOS_LAMBDA(int const index) {
+                int const cell = elements(index);
+                LO*       col  = &colScratch(cell, 0);
+                ST*       vals = &valScratch(cell, 0);
+                for (int node = 0; node < 8; ++node)
+                  for (int eq = 0; eq < neq; ++eq) col[node * neq + eq] = nodeID(cell, node, eq);
+                for (int row = 0; row < nunk; ++row) {
+                  for (int unk = 0; unk < nunk; ++unk) vals[unk] = derivativeValue(cell, row, unk);
+                  Jac_kokkos.sumIntoValues(col[row], col, nunk, vals, false, false);
+                }
+              });
+        }
+      }
+      Kokkos::fence();
+      auto t5 = Clock::now();
+      Albany::fillComplete(jac_colored);
+
+      // Jacobian, by worksets with one atomic sumIntoValues per entry
+      Albany::resumeFill(jac_atomic);
+      Albany::assign(jac_atomic, 0.0);
+      Jac_kokkos = Albany::getNonconstDeviceData(jac_atomic);
+      Kokkos::fence();
+      auto t6 = Clock::now();
+      for (auto const& ws : worksets) {
+        auto const nodeID = ws.nodeID;
+        Kokkos::parallel_for(
+            "ScatterBenchmark::atomic_jacobian", Policy(0, ws.elNodeID.size()), KOKKOS_LAMBDA(int const cell) {
+              for (int row = 0; row < nunk; ++row) {
+                LO const grow = nodeID(cell, row / neq, row % neq);
+                for (int unk = 0; unk < nunk; ++unk) {
+                  LO const gcol = nodeID(cell, unk / neq, unk % neq);
+                  ST const val  = derivativeValue(cell, row, unk);
+                  Jac_kokkos.sumIntoValues(grow, &gcol, 1, &val, false, true);
+                }
+              }
+            });
+      }
+      Kokkos::fence();
+      auto t7 = Clock::now();
+      Albany::fillComplete(jac_atomic);
+
+      colored_residual = std::min(colored_residual, std::chrono::duration<double>(t1 - t0).count());
+      atomic_residual  = std::min(atomic_residual, std::chrono::duration<double>(t3 - t2).count());
+      colored_jacobian = std::min(colored_jacobian, std::chrono::duration<double>(t5 - t4).count());
+      atomic_jacobian  = std::min(atomic_jacobian, std::chrono::duration<double>(t7 - t6).count());
+    }
+
+    // Both scatters must give the same residual and Jacobian
+    double residual_error = 0.0;
+    auto   colored_data   = Albany::getLocalData(*f_colored);
+    auto   atomic_data    = Albany::getLocalData(*f_atomic);
+    for (LO i = 0; i < colored_data.size(); ++i) residual_error = std::max(residual_error, std::abs(colored_data[i] - atomic_data[i]));
+
+    double             jacobian_error = 0.0;
+    Teuchos::Array<LO> colored_indices, atomic_indices;
+    Teuchos::Array<ST> colored_values, atomic_values;
+    for (LO row = 0; row < static_cast<LO>(num_dofs); ++row) {
+      Albany::getLocalRowValues(jac_colored, row, colored_indices, colored_values);
+      Albany::getLocalRowValues(jac_atomic, row, atomic_indices, atomic_values);
+      for (int k = 0; k < colored_values.size(); ++k) jacobian_error = std::max(jacobian_error, std::abs(colored_values[k] - atomic_values[k]));
+    }
+
+    std::cout << '\n';
+    std::cout << "Execution space        : " << ExecutionSpace::name() << '\n';
+    std::cout << "Concurrency            : " << ExecutionSpace().concurrency() << '\n';
+    std::cout << "Elements               : " << cells * cells * cells << '\n';
+    std::cout << "Equations              : " << neq << '\n';
+    std::cout << "Worksets               : " << worksets.size() << '\n';
+    std::cout << "Colors (max)           : " << max_colors << '\n';
+    std::cout << std::scientific << std::setprecision(4);
+    std::cout << "Residual, colored [s]  : " << colored_residual << '\n';
+    std::cout << "Residual, atomic [s]   : " << atomic_residual << "  (max difference " << residual_error << ")\n";
+    std::cout << "Jacobian, colored [s]  : " << colored_jacobian << '\n';
+    std::cout << "Jacobian, atomic [s]   : " << atomic_jacobian << "  (max difference " << jacobian_error << ")\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Residual speedup       : " << atomic_residual / colored_residual << '\n';
+    std::cout << "Jacobian speedup       : " << atomic_jacobian / colored_jacobian << '\n';
+  }
+  Kokkos::finalize();
+}
@@ -4,6 +4,7 @@
 
 #include "LCMPartition.hpp"
 
+#include <Kokkos_Core.hpp>
 #include <algorithm>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
@@ -11,6 +12,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -89,509 +91,414 @@ PrintPartitionInfo(
   return;
 }
 
-// Given a vector of points and a set of indices to this vector:
-// 1) Find the bounding box of the indexed points.
-// 2) Compute the vector sum of the indexed points.
-std::tuple<minitensor::Vector<double>, minitensor::Vector<double>, minitensor::Vector<double>>
-bounds_and_sum_subset(std::vector<minitensor::Vector<double>> const& points, std::set<minitensor::Index> const& indices)
+// Number of parts the K-means steps are split into to run in parallel.
+int
+number_parallel_parts(int const number_items)
 {
-  ALBANY_EXPECT(points.size() > 0);
-  ALBANY_EXPECT(indices.size() > 0);
-
-  minitensor::Index const first = *indices.begin();
-
-  minitensor::Vector<double> sum = points[first];
-
-  minitensor::Vector<double> lower_corner = sum;
-
-  minitensor::Vector<double> upper_corner = sum;
-
-  minitensor::Index const N = sum.get_dimension();
-
-  for (auto index : indices) {
-    minitensor::Vector<double> const& p = points[index];
-
-    sum += p;
-
-    for (minitensor::Index i = 0; i < N; ++i) {
-      lower_corner(i) = std::min(lower_corner(i), p(i));
-      upper_corner(i) = std::max(upper_corner(i), p(i));
-    }
-  }
+  int const concurrency = Kokkos::DefaultHostExecutionSpace::concurrency();
 
-  return std::make_tuple(lower_corner, upper_corner, sum);
+  return std::max(1, std::min(number_items, 2 * concurrency));
 }
 
-// Given point, a vector of centers and a set of indices into this vector:
-// Return the index of the center closest to the point among the
-// indexed centers.
-minitensor::Index
-closest_subset(minitensor::Vector<double> const& point, std::vector<ClusterCenter> const& centers, std::set<minitensor::Index> const& indices)
-{
-  ALBANY_EXPECT(centers.size() > 0);
-  ALBANY_EXPECT(indices.size() > 0);
-
-  minitensor::Index const first = *indices.begin();
-
-  double minimum = norm_square(centers[first].position - point);
-
-  minitensor::Index index_minimum = first;
-
-  for (auto index : indices) {
-    minitensor::Vector<double> const& p = centers[index].position;
-
-    double const s = norm_square(p - point);
+// Given partial sums of points and partial counts for each center,
+// computed independently by a number of parts:
+// Reduce them into the sums and counts for each center.
+void
+reduce_partial_sums(
+    int const                             number_parts,
+    int const                             number_centers,
+    int const                             dimension,
+    std::vector<double> const&            partial_sums,
+    std::vector<minitensor::Index> const& partial_counts,
+    std::vector<double>&                  sums,
+    std::vector<minitensor::Index>&       counts)
+{
+  sums.assign(number_centers * dimension, 0.0);
+  counts.assign(number_centers, 0);
+
+  Kokkos::parallel_for(
+      "LCM::reduce_partial_sums", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_centers), [&](int const center) {
+        for (int part = 0; part < number_parts; ++part) {
+          int const offset = part * number_centers + center;
+
+          for (int i = 0; i < dimension; ++i) {
+            sums[center * dimension + i] += partial_sums[offset * dimension + i];
+          }
 
-    if (s < minimum) {
-      minimum       = s;
-      index_minimum = index;
-    }
-  }
+          counts[center] += partial_counts[offset];
+        }
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
 
-  return index_minimum;
+  return;
 }
 
-// Given a vector of points and a set of indices:
-// 1) Find the bounding box of the indexed points.
-// 2) Divide the bounding box along its largest dimension, using median.
-// 3) Assign points to one side or the other, and return index sets.
-std::pair<std::set<minitensor::Index>, std::set<minitensor::Index>>
-split_box(std::vector<minitensor::Vector<double>> const& points, std::set<minitensor::Index> const& indices)
+// Given a vector of points and the index of the closest center to each:
+// Compute the sum of the points and their number for each center.
+// Chunks of points are summed in parallel, each into its own partial
+// sums, which are then reduced.
+void
+cluster_sums(
+    std::vector<minitensor::Vector<double>> const& points,
+    std::vector<int> const&                        closest,
+    int const                                      number_centers,
+    std::vector<double>&                           sums,
+    std::vector<minitensor::Index>&                counts)
 {
   ALBANY_EXPECT(points.size() > 0);
-  ALBANY_EXPECT(indices.size() > 0);
 
-  // Compute bounding box
-  minitensor::Index const first = *indices.begin();
+  int const number_points = points.size();
 
-  minitensor::Vector<double> lower_corner = points[first];
+  int const dimension = points[0].get_dimension();
 
-  minitensor::Vector<double> upper_corner = lower_corner;
+  int const number_chunks = number_parallel_parts(number_points);
 
-  minitensor::Index const N = lower_corner.get_dimension();
+  std::vector<double> partial_sums(number_chunks * number_centers * dimension, 0.0);
 
-  for (auto index : indices) {
-    minitensor::Vector<double> const& p = points[index];
+  std::vector<minitensor::Index> partial_counts(number_chunks * number_centers, 0);
 
-    for (minitensor::Index i = 0; i < N; ++i) {
-      lower_corner(i) = std::min(lower_corner(i), p(i));
-      upper_corner(i) = std::max(upper_corner(i), p(i));
-    }
-  }
+  Kokkos::parallel_for(
+      "LCM::cluster_sums", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_chunks), [&](int const chunk) {
+        int const begin = static_cast<long>(number_points) * chunk / number_chunks;
+        int const end   = static_cast<long>(number_points) * (chunk + 1) / number_chunks;
 
-  // Find largest dimension
-  minitensor::Vector<double> const span = upper_corner - lower_corner;
+        double* const            chunk_sums   = partial_sums.data() + chunk * number_centers * dimension;
+        minitensor::Index* const chunk_counts = partial_counts.data() + chunk * number_centers;
 
-  ALBANY_EXPECT(norm_square(span) > 0.0);
+        for (int p = begin; p < end; ++p) {
+          int const c = closest[p];
 
-  double maximum_span = span(0);
+          for (int i = 0; i < dimension; ++i) {
+            chunk_sums[c * dimension + i] += points[p](i);
+          }
 
-  minitensor::Index largest_dimension = 0;
+          ++chunk_counts[c];
+        }
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
 
-  for (minitensor::Index i = 1; i < N; ++i) {
-    double const s = span(i);
+  reduce_partial_sums(number_chunks, number_centers, dimension, partial_sums, partial_counts, sums, counts);
 
-    if (s > maximum_span) {
-      maximum_span      = s;
-      largest_dimension = i;
-    }
-  }
-
-  // Find median coordinate along largest dimension
-  std::vector<double> coordinates;
+  return;
+}
 
-  for (auto index : indices) {
-    minitensor::Vector<double> const& p = points[index];
+}  // anonymous namespace
 
-    coordinates.push_back(p(largest_dimension));
-  }
+// Build KD tree of list of points.
+KDTree::KDTree(std::vector<minitensor::Vector<double>> const& points)
+{
+  ALBANY_EXPECT(points.size() > 0);
 
-  std::sort(coordinates.begin(), coordinates.end());
+  int const number_points = points.size();
 
-  double split_coordinate = minitensor::median<double>(coordinates.begin(), coordinates.end());
+  dimension_ = points[0].get_dimension();
 
-  // Check whether splitting the box will result in one box of
-  // the same volume as the original and another one of zero volume.
-  // If so, split the original box into two of equal volume.
-  bool const box_unchanged = split_coordinate == lower_corner(largest_dimension) || split_coordinate == upper_corner(largest_dimension);
+  ALBANY_EXPECT(dimension_ <= 3);
 
-  if (box_unchanged == true) {
-    std::sort(coordinates.begin(), coordinates.end());
+  points_.resize(number_points * dimension_);
+  index_.resize(number_points);
 
-    split_coordinate = 0.5 * (coordinates[0] + coordinates[coordinates.size() - 1]);
+  for (int p = 0; p < number_points; ++p) {
+    for (minitensor::Index i = 0; i < dimension_; ++i) {
+      points_[p * dimension_ + i] = points[p](i);
+    }
+    index_[p] = p;
   }
 
-  // Assign points to lower or upper half.
-  std::set<minitensor::Index> indices_lower;
+  minitensor::Index const maximum_nodes = 2 * (number_points / leaf_size_ + 1);
 
-  std::set<minitensor::Index> indices_upper;
+  left_.reserve(maximum_nodes);
+  right_.reserve(maximum_nodes);
+  parent_.reserve(maximum_nodes);
+  first_.reserve(maximum_nodes);
+  count_.reserve(maximum_nodes);
 
-  minitensor::Vector<double> split_limit = upper_corner;
+  buildNode(-1, 0, 0, number_points);
 
-  split_limit(largest_dimension) = split_coordinate;
+  // Roots of the subtrees for the filtering step: the nodes at the
+  // shallowest level with enough of them to balance the load, and the
+  // leaves above that level.
+  int const number_subtrees = number_parallel_parts(number_points);
 
-  for (auto index : indices) {
-    minitensor::Vector<double> const& p = points[index];
+  int level = 0;
 
-    if (in_box(p, lower_corner, split_limit) == true) {
-      indices_lower.insert(index);
-    } else {
-      indices_upper.insert(index);
-    }
+  while ((1 << level) < number_subtrees && level < depth_) {
+    ++level;
   }
 
-  return std::make_pair(indices_lower, indices_upper);
-}
+  std::vector<std::pair<int, int>> stack(1, std::make_pair(0, 0));
 
-}  // anonymous namespace
+  while (stack.empty() == false) {
+    int const node  = stack.back().first;
+    int const depth = stack.back().second;
 
-// Build KD tree of list of points.
-// \param point list
-// \return Boost shared pointer to root node of tree.
-template <typename Node>
-std::shared_ptr<Node>
-buildKDTree(std::vector<minitensor::Vector<double>> const& points)
-{
-  // Initially all points are in the index set.
-  minitensor::Index const number_points = points.size();
+    stack.pop_back();
 
-  std::set<minitensor::Index> points_indices;
+    if (depth == level || left_[node] < 0) {
+      subtrees_.push_back(node);
+      continue;
+    }
 
-  for (minitensor::Index i = 0; i < number_points; ++i) {
-    points_indices.insert(i);
+    stack.push_back(std::make_pair(right_[node], depth + 1));
+    stack.push_back(std::make_pair(left_[node], depth + 1));
   }
 
-  std::shared_ptr<Node> dummy;
-
-  std::string name = "0";
-
-  std::shared_ptr<Node> root = createKDTreeNode(name, dummy, points, points_indices);
-
-  return root;
+  return;
 }
 
-// Create KD tree node.
-// \param point list
-// \return Boost shared pointer to node of tree if created, 0 otherwise.
-template <typename Node>
-std::shared_ptr<Node>
-createKDTreeNode(
-    std::string const&                             name,
-    std::shared_ptr<Node>                          parent,
-    std::vector<minitensor::Vector<double>> const& points,
-    std::set<minitensor::Index> const&             points_indices)
+// Create KD tree node for the points index_[first, last) and
+// recursively its children.
+// \return Index of the node.
+int
+KDTree::buildNode(int const parent, int const depth, int const first, int const last)
 {
-  if (name.length() >= 64) {
-    std::cout << "Name is too long: " << name << '\n';
-  }
-
-  // Create and fill in node.
-  std::shared_ptr<Node> node(new Node);
-
-  node->name = name;
-
-  node->parent = parent;
-
-  minitensor::Index const count = points_indices.size();
+  int const N = dimension_;
 
-  node->count       = count;
-  node->cell_points = points_indices;
+  int const node = left_.size();
 
-  switch (count) {
-    // Empty node
-    case 0:
-      break;
-
-      // Leaf node
-    case 1: {
-      minitensor::Vector<double> const& p = points[*points_indices.begin()];
-      node->lower_corner                  = p;
-      node->upper_corner                  = p;
-      node->weighted_centroid             = p;
-    } break;
-
-    default: {
-      std::tie(node->lower_corner, node->upper_corner, node->weighted_centroid) = bounds_and_sum_subset(points, points_indices);
+  left_.push_back(-1);
+  right_.push_back(-1);
+  parent_.push_back(parent);
+  first_.push_back(first);
+  count_.push_back(last - first);
 
-      std::set<minitensor::Index> indices_left;
+  depth_ = std::max(depth_, depth);
 
-      std::set<minitensor::Index> indices_right;
+  // Bounding box and sum of the points
+  lower_.resize((node + 1) * N, std::numeric_limits<double>::max());
+  upper_.resize((node + 1) * N, -std::numeric_limits<double>::max());
+  sum_.resize((node + 1) * N, 0.0);
 
-      std::tie(indices_left, indices_right) = split_box(points, points_indices);
+  for (int p = first; p < last; ++p) {
+    double const* const x = &points_[index_[p] * N];
 
-      std::string name_left = name + "0";
+    for (int i = 0; i < N; ++i) {
+      lower_[node * N + i] = std::min(lower_[node * N + i], x[i]);
+      upper_[node * N + i] = std::max(upper_[node * N + i], x[i]);
+      sum_[node * N + i] += x[i];
+    }
+  }
 
-      std::string name_right = name + "1";
+  if (last - first <= leaf_size_) return node;
 
-      node->left = createKDTreeNode(name_left, node, points, indices_left);
+  // Split along the largest dimension of the box at the median.
+  int axis = 0;
 
-      node->right = createKDTreeNode(name_right, node, points, indices_right);
-    } break;
+  for (int i = 1; i < N; ++i) {
+    if (upper_[node * N + i] - lower_[node * N + i] > upper_[node * N + axis] - lower_[node * N + axis]) {
+      axis = i;
+    }
   }
 
-  return node;
-}
+  // All points coincide, keep them in a leaf.
+  if (upper_[node * N + axis] == lower_[node * N + axis]) return node;
 
-// KdTree constructor with list of points.
-template <typename Node>
-KDTree<Node>::KDTree(std::vector<minitensor::Vector<double>> const& points, minitensor::Index const number_centers)
-{
-  root_ = buildKDTree<Node>(points);
+  int const middle = first + (last - first) / 2;
 
-  // Set candidate centers to all
-  std::set<minitensor::Index> candidate_centers;
+  std::nth_element(index_.begin() + first, index_.begin() + middle, index_.begin() + last, [&](int const a, int const b) {
+    return points_[a * N + axis] < points_[b * N + axis];
+  });
 
-  for (minitensor::Index i = 0; i < number_centers; ++i) {
-    candidate_centers.insert(i);
-  }
+  int const left  = buildNode(node, depth + 1, first, middle);
+  int const right = buildNode(node, depth + 1, middle, last);
 
-  root_->candidate_centers = candidate_centers;
+  left_[node]  = left;
+  right_[node] = right;
 
-  return;
+  return node;
 }
 
-// Visit Tree nodes recursively and
-// perform the action defined by the Visitor object.
-template <typename Node, typename Visitor>
+// Given a node and a list of candidate centers:
+// Determine the closest candidate to the midcell.
+// For the remaining candidates, define hyperplanes that are
+// equidistant to them and the closest candidate to the midcell.
+// Keep the candidates for which the box does not lie entirely on the
+// side of the hyperplane where the closest candidate to the midcell lies.
 void
-visitTreeNode(Node& node, Visitor const& visitor)
+KDTree::pruneCenters(int const node, std::vector<double> const& centers, std::vector<int> const& candidates, std::vector<int>& pruned) const
 {
-  if (visitor.pre_stop(node) == true) return;
+  ALBANY_EXPECT(candidates.size() > 0);
 
-  visitor(node);
+  int const N = dimension_;
 
-  if (visitor.post_stop(node) == true) return;
+  double const* const lower = &lower_[node * N];
+  double const* const upper = &upper_[node * N];
 
-  visitTreeNode(node->left, visitor);
-  visitTreeNode(node->right, visitor);
+  double midcell[3];
 
-  return;
-}
-
-// Traverse a Tree and perform the action defined by the Visitor object.
-template <typename Tree, typename Visitor>
-void
-traverseTree(Tree& tree, Visitor const& visitor)
-{
-  visitTreeNode(tree.get_root(), visitor);
-  return;
-}
+  for (int i = 0; i < N; ++i) {
+    midcell[i] = 0.5 * (lower[i] + upper[i]);
+  }
 
-// Output visitor for KDTree node.
-template <typename Node>
-void
-OutputVisitor<Node>::operator()(Node const& node) const
-{
-  std::cout << "Node        : " << node->name << '\n';
-  std::cout << "Count       : " << node->count << '\n';
-  std::cout << "Lower corner: " << node->lower_corner << '\n';
-  std::cout << "Upper corner: " << node->upper_corner << '\n';
+  int index_closest = candidates[0];
 
-  minitensor::Vector<double> centroid = node->weighted_centroid / node->count;
+  double minimum = std::numeric_limits<double>::max();
 
-  std::cout << "Centroid    : " << centroid << '\n';
+  for (auto&& c : candidates) {
+    double s = 0.0;
 
-  return;
-}
-
-// Pre-visit stopping criterion for traversing the tree.
-template <typename Node>
-bool
-OutputVisitor<Node>::pre_stop(Node const& node) const
-{
-  return node.get() == nullptr;
-}
+    for (int i = 0; i < N; ++i) {
+      s += (midcell[i] - centers[c * N + i]) * (midcell[i] - centers[c * N + i]);
+    }
 
-// Post-visit stopping criterion for traversing the tree.
-template <typename Node>
-bool
-OutputVisitor<Node>::post_stop(Node const& node) const
-{
-  return false;
-}
+    if (s < minimum) {
+      index_closest = c;
+      minimum       = s;
+    }
+  }
 
-// Constructor for filtering visitor
-template <typename Node, typename Center>
-FilterVisitor<Node, Center>::FilterVisitor(std::vector<minitensor::Vector<double>>& p, std::vector<Center>& c) : points(p), centers(c)
-{
-}
+  double const* const z = &centers[index_closest * N];
 
-namespace {
+  pruned.clear();
 
-template <typename Center, typename Iterator>
-minitensor::Index
-closest_center_from_subset(minitensor::Vector<double> const& point, std::vector<Center> const& centers, Iterator begin, Iterator end)
-{
-  ALBANY_EXPECT(std::distance(begin, end) > 0);
+  for (auto&& c : candidates) {
+    if (c == index_closest) {
+      pruned.push_back(c);
+      continue;
+    }
 
-  minitensor::Index closest_index = *begin;
+    double const* const p = &centers[c * N];
 
-  double minimum_distance = norm_square(point - centers[closest_index].position);
+    // Vertex of the box furthest along p - z
+    double sp = 0.0;
+    double sz = 0.0;
 
-  for (Iterator it = ++begin; it != end; ++it) {
-    minitensor::Index const i = *it;
+    for (int i = 0; i < N; ++i) {
+      double const v = p[i] - z[i] >= 0.0 ? upper[i] : lower[i];
 
-    double const s = norm_square(point - centers[i].position);
+      sp += (p[i] - v) * (p[i] - v);
+      sz += (z[i] - v) * (z[i] - v);
+    }
 
-    if (s < minimum_distance) {
-      closest_index    = i;
-      minimum_distance = s;
+    if (sp < sz) {
+      pruned.push_back(c);
     }
   }
 
-  return closest_index;
+  return;
 }
 
-// Given the corners of a box, a vector of centers and
-// a subset of indices to the centers:
-// Determine the closest center among the subset to the midcell.
-// For the remaining centers, define hyperplanes that are
-// equidistant to them and the closest center to the midcell.
-// Determine whether the box lies entirely on the side of the hyperplane
-// where the closest center to the midcell lies as well.
-template <typename Center>
-std::pair<minitensor::Index, std::set<minitensor::Index>>
-box_proximity_to_centers(
-    minitensor::Vector<double> const&  lower_corner,
-    minitensor::Vector<double> const&  upper_corner,
-    std::vector<Center> const&         centers,
-    std::set<minitensor::Index> const& index_subset)
+// Filtering of a node with the candidate centers candidates[depth].
+// Candidates for the children are stored in candidates[depth + 1].
+void
+KDTree::filterNode(
+    int const                      node,
+    int const                      depth,
+    std::vector<double> const&     centers,
+    std::vector<std::vector<int>>& candidates,
+    double*                        sums,
+    minitensor::Index*             counts) const
 {
-  ALBANY_EXPECT(centers.size() > 0);
-  ALBANY_EXPECT(index_subset.size() > 0);
+  int const N = dimension_;
 
-  minitensor::Vector<double> const midcell = 0.5 * (lower_corner + upper_corner);
+  std::vector<int> const& node_candidates = candidates[depth];
 
-  // Determine the closest point to box center only among those
-  // listed in the index subset.
-  minitensor::Index index_closest = *index_subset.begin();
+  // Leaf: find the closest candidate to each point.
+  if (left_[node] < 0) {
+    for (int p = first_[node]; p < first_[node] + count_[node]; ++p) {
+      double const* const x = &points_[index_[p] * N];
 
-  double minimum = norm_square(midcell - centers[index_closest].position);
+      int index_closest = node_candidates[0];
 
-  for (auto&& i : index_subset) {
-    double const s = norm_square(midcell - centers[i].position);
+      double minimum = std::numeric_limits<double>::max();
 
-    if (s < minimum) {
-      index_closest = i;
-      minimum       = s;
-    }
-  }
+      for (auto&& c : node_candidates) {
+        double s = 0.0;
 
-  minitensor::Vector<double> const& closest_to_midcell = centers[index_closest].position;
+        for (int i = 0; i < N; ++i) {
+          s += (x[i] - centers[c * N + i]) * (x[i] - centers[c * N + i]);
+        }
 
-  std::set<minitensor::Index> indices_candidates;
+        if (s < minimum) {
+          index_closest = c;
+          minimum       = s;
+        }
+      }
 
-  // Determine where the box lies
-  for (auto&& i : index_subset) {
-    if (i == index_closest) {
-      indices_candidates.insert(i);
-      continue;
+      for (int i = 0; i < N; ++i) {
+        sums[index_closest * N + i] += x[i];
+      }
+
+      ++counts[index_closest];
     }
 
-    minitensor::Vector<double> const& p = centers[i].position;
+    return;
+  }
 
-    minitensor::Vector<double> const u = p - closest_to_midcell;
+  std::vector<int>& children_candidates = candidates[depth + 1];
 
-    minitensor::Index const N = u.get_dimension();
+  pruneCenters(node, centers, node_candidates, children_candidates);
 
-    minitensor::Vector<double> v(N);
+  // A single candidate left: all points of the node are closest to it.
+  if (children_candidates.size() == 1) {
+    int const c = children_candidates[0];
 
-    for (minitensor::Index j = 0; j < N; ++j) {
-      v(j) = u(j) >= 0.0 ? upper_corner(j) : lower_corner(j);
+    for (int i = 0; i < N; ++i) {
+      sums[c * N + i] += sum_[node * N + i];
     }
 
-    if (norm_square(p - v) < norm_square(closest_to_midcell - v)) {
-      indices_candidates.insert(i);
-    }
+    counts[c] += count_[node];
+
+    return;
   }
 
-  return std::make_pair(index_closest, indices_candidates);
-}
+  filterNode(left_[node], depth + 1, centers, candidates, sums, counts);
+  filterNode(right_[node], depth + 1, centers, candidates, sums, counts);
 
-}  // anonymous namespace
+  return;
+}
 
-// Filtering visitor for KDTree node
-template <typename Node, typename Center>
+// Filtering step of K-means. The subtrees are filtered in parallel,
+// each starting with the candidates obtained by pruning along the
+// path from the root, into their own partial sums.
 void
-FilterVisitor<Node, Center>::operator()(Node const& node) const
+KDTree::filter(std::vector<double> const& centers, std::vector<double>& sums, std::vector<minitensor::Index>& counts) const
 {
-  bool const node_is_empty = node->count == 0;
-
-  if (node_is_empty == true) {
-    return;
-  }
-
-  bool const node_is_leaf = node->count == 1;
+  int const N = dimension_;
 
-  if (node_is_leaf == true) {
-    // Get point
-    minitensor::Index const point_index = *(node->cell_points.begin());
+  int const number_centers = centers.size() / N;
 
-    minitensor::Vector<double> const& point = points[point_index];
+  int const number_subtrees = subtrees_.size();
 
-    // Find closest center to it
-    minitensor::Index index_closest = closest_center_from_subset(point, centers, node->candidate_centers.begin(), node->candidate_centers.end());
+  std::vector<double> partial_sums(number_subtrees * number_centers * N, 0.0);
 
-    // Update closest center
-    Center& closest_center = centers[index_closest];
+  std::vector<minitensor::Index> partial_counts(number_subtrees * number_centers, 0);
 
-    closest_center.weighted_centroid += point;
-    ++closest_center.count;
+  Kokkos::parallel_for(
+      "LCM::KDTree::filter", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_subtrees), [&](int const s) {
+        int const subtree = subtrees_[s];
 
-    node->closest_center_to_midcell = index_closest;
+        // Candidate centers for each level of the tree
+        std::vector<std::vector<int>> candidates(depth_ + 2);
 
-  } else {  // node_is_leaf == false
+        candidates[0].resize(number_centers);
 
-    // Get midpoint of cell
-    minitensor::Index index_closest_midcell = 0;
+        for (int c = 0; c < number_centers; ++c) {
+          candidates[0][c] = c;
+        }
 
-    std::set<minitensor::Index> candidate_indices;
+        std::vector<int> path;
 
-    std::tie(index_closest_midcell, candidate_indices) = box_proximity_to_centers(node->lower_corner, node->upper_corner, centers, node->candidate_centers);
+        for (int node = parent_[subtree]; node >= 0; node = parent_[node]) {
+          path.push_back(node);
+        }
 
-    node->candidate_centers = candidate_indices;
+        int depth = 0;
 
-    if (candidate_indices.size() == 1) {
-      Center& center = centers[index_closest_midcell];
+        for (auto it = path.rbegin(); it != path.rend(); ++it, ++depth) {
+          pruneCenters(*it, centers, candidates[depth], candidates[depth + 1]);
+        }
 
-      center.weighted_centroid += node->weighted_centroid;
-      center.count += node->count;
-    } else {
-      // Update children
-      node->left->candidate_centers  = candidate_indices;
-      node->right->candidate_centers = candidate_indices;
-    }
+        filterNode(
+            subtree, depth, centers, candidates, partial_sums.data() + s * number_centers * N, partial_counts.data() + s * number_centers);
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
 
-    node->closest_center_to_midcell = index_closest_midcell;
-  }
+  reduce_partial_sums(number_subtrees, number_centers, N, partial_sums, partial_counts, sums, counts);
 
   return;
 }
 
-// Pre-visit stopping criterion for traversing the tree.
-template <typename Node, typename Center>
-bool
-FilterVisitor<Node, Center>::pre_stop(Node const& node) const
-{
-  bool const has_no_centers = node->candidate_centers.size() == 0;
-
-  return has_no_centers == true;
-}
-
-// Post-visit stopping criterion for traversing the tree.
-template <typename Node, typename Center>
-bool
-FilterVisitor<Node, Center>::post_stop(Node const& node) const
-{
-  bool const node_is_leaf = node->count <= 1;
-
-  bool const has_single_center = node->candidate_centers.size() == 1;
-
-  bool const stop_traversal = node_is_leaf || has_single_center;
-
-  return stop_traversal == true;
-}
-
 // Default constructor for Connectivity Array
 ConnectivityArray::ConnectivityArray()
     : type_(minitensor::ELEMENT::UNKNOWN),
@@ -1601,6 +1508,10 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
 
   centroids_ofs << "X,Y,Z" << '\n';
 
+  std::vector<int> elements;
+
+  std::vector<minitensor::Vector<double>> element_centroids;
+
   for (auto&& element_conn : connectivity_) {
     int const& element = element_conn.first;
 
@@ -1620,9 +1531,25 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
 
     centroids_ofs << element_centroid << '\n';
 
-    minitensor::Index const partition = closest_point(element_centroid, centers);
+    elements.push_back(element);
+    element_centroids.push_back(element_centroid);
+  }
+
+  // Find the closest center to each element centroid
+  int const number_elements = elements.size();
+
+  std::vector<minitensor::Index> closest(number_elements);
+
+  Kokkos::parallel_for(
+      "LCM::partitionByCenters", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_elements), [&](int const i) {
+        closest[i] = closest_point(element_centroids[i], centers);
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
 
-    partitions[element] = partition;
+  for (int i = 0; i < number_elements; ++i) {
+    minitensor::Index const partition = closest[i];
+
+    partitions[elements[i]] = partition;
 
     std::set<minitensor::Index>::const_iterator it = unassigned_partitions.find(partition);
 
@@ -1908,37 +1835,37 @@ ConnectivityArray::partitionKMeans(double const length_scale)
 
   minitensor::Index const number_points = domain_points_.size();
 
-  while (step_norm >= tolerance && number_iterations < max_iterations) {
-    // Assign points to closest generators
-    std::vector<minitensor::Index> point_to_generator(number_points);
+  minitensor::Index const dimension = lower_corner.get_dimension();
 
-    for (minitensor::Index i = 0; i < domain_points_.size(); ++i) {
-      point_to_generator[i] = closest_point(domain_points_[i], centers);
-    }
+  std::vector<int> point_to_generator(number_points);
 
-    // Determine cluster of points for each generator
-    std::vector<std::vector<minitensor::Vector<double>>> clusters;
+  std::vector<double> sums;
 
-    clusters.resize(number_partitions);
+  std::vector<minitensor::Index> counts;
 
-    for (minitensor::Index p = 0; p < point_to_generator.size(); ++p) {
-      minitensor::Index const c = point_to_generator[p];
+  while (step_norm >= tolerance && number_iterations < max_iterations) {
+    // Assign points to closest generators
+    Kokkos::parallel_for(
+        "LCM::partitionKMeans", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_points), [&](int const i) {
+          point_to_generator[i] = closest_point(domain_points_[i], centers);
+        });
+    Kokkos::DefaultHostExecutionSpace().fence();
 
-      clusters[c].push_back(domain_points_[p]);
-    }
+    // Sum and number of the points of the cluster of each generator
+    cluster_sums(domain_points_, point_to_generator, number_partitions, sums, counts);
 
     // Compute centroids of each cluster and set generators to
     // these centroids.
-    for (minitensor::Index i = 0; i < clusters.size(); ++i) {
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
       // If center is empty then generator does not move.
-      if (clusters[i].size() == 0) {
+      if (counts[i] == 0) {
         steps[i] = 0.0;
         std::cout << "Iteration: " << number_iterations;
         std::cout << ", center " << i << " has zero points." << '\n';
         continue;
       }
 
-      minitensor::Vector<double> const cluster_centroid = centroid(clusters[i]);
+      minitensor::Vector<double> const cluster_centroid = minitensor::Vector<double>(dimension, &sums[i * dimension]) / counts[i];
 
       // Update the generator
       minitensor::Vector<double> const old_generator = centers[i];
@@ -1986,16 +1913,8 @@ ConnectivityArray::partitionKDTree(double const length_scale)
 
   minitensor::Index const number_partitions = center_positions.size();
 
-  // Initialize centers
   std::cout << "Main K-means Iteration." << '\n';
 
-  std::vector<ClusterCenter> centers(number_partitions);
-
-  for (minitensor::Index i = 0; i < number_partitions; ++i) {
-    centers[i].position          = center_positions[i];
-    centers[i].weighted_centroid = 0.0 * center_positions[i];
-  }
-
   minitensor::Vector<double> lower_corner;
 
   minitensor::Vector<double> upper_corner;
@@ -2008,9 +1927,22 @@ ConnectivityArray::partitionKDTree(double const length_scale)
   createGrid();
 
   // Create KDTree
-  KDTree<KDTreeNode> kdtree(domain_points_, number_partitions);
+  KDTree kdtree(domain_points_);
+
+  // Initialize centers, dimension values per center
+  minitensor::Index const dimension = lower_corner.get_dimension();
 
-  FilterVisitor<std::shared_ptr<KDTreeNode>, ClusterCenter> filter_visitor(domain_points_, centers);
+  std::vector<double> centers(number_partitions * dimension);
+
+  for (minitensor::Index i = 0; i < number_partitions; ++i) {
+    for (minitensor::Index j = 0; j < dimension; ++j) {
+      centers[i * dimension + j] = center_positions[i](j);
+    }
+  }
+
+  std::vector<double> sums;
+
+  std::vector<minitensor::Index> counts;
 
   // K-means iteration
   minitensor::Index const max_iterations = getMaximumIterations();
@@ -2030,33 +1962,27 @@ ConnectivityArray::partitionKDTree(double const length_scale)
   }
 
   while (step_norm >= tolerance && number_iterations < max_iterations) {
-    // Initialize centers
-    for (minitensor::Index i = 0; i < number_partitions; ++i) {
-      ClusterCenter& center = centers[i];
-
-      center.weighted_centroid.clear();
-      center.count = 0;
-    }
-
-    traverseTree(kdtree, filter_visitor);
+    kdtree.filter(centers, sums, counts);
 
     // Update centers
-    for (minitensor::Index i = 0; i < centers.size(); ++i) {
-      ClusterCenter& center = centers[i];
-
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
       // If cluster is empty then center does not move.
-      if (center.count == 0) {
+      if (counts[i] == 0) {
         steps[i] = 0.0;
         std::cout << "Iteration: " << number_iterations;
         std::cout << ", center " << i << " has zero points." << '\n';
         continue;
       }
 
-      minitensor::Vector<double> const new_position = center.weighted_centroid / center.count;
+      minitensor::Vector<double> const old_position(dimension, &centers[i * dimension]);
 
-      steps[i] = norm(new_position - center.position);
+      minitensor::Vector<double> const new_position = minitensor::Vector<double>(dimension, &sums[i * dimension]) / counts[i];
 
-      center.position = new_position;
+      steps[i] = norm(new_position - old_position);
+
+      for (minitensor::Index j = 0; j < dimension; ++j) {
+        centers[i * dimension + j] = new_position(j);
+      }
     }
 
     step_norm = norm(minitensor::Vector<double>(number_partitions, &steps[0]));
@@ -2069,7 +1995,7 @@ ConnectivityArray::partitionKDTree(double const length_scale)
   }
 
   for (minitensor::Index i = 0; i < number_partitions; i++) {
-    center_positions[i] = centers[i].position;
+    center_positions[i] = minitensor::Vector<double>(dimension, &centers[i * dimension]);
   }
 
   // Partition map.
@@ -16,7 +16,6 @@
 #include <iostream>
 #include <iterator>
 #include <map>
-#include <memory>
 #include <set>
 #include <vector>
 
@@ -65,58 +64,6 @@ enum class Scheme
 class ConnectivityArray;
 class DualGraph;
 class ZoltanHyperGraph;
-struct KDTreeNode;
-
-///
-/// Cluster center for K-means filtering algorithm. See
-/// An Efficient K-means Clustering Algorithm: Analysis and Implementation
-/// T. Kanungo et al.
-/// IEEE Transactions on Pattern Analysis and Machine Intelligence
-/// 24(7) July 2002
-///
-struct ClusterCenter
-{
-  minitensor::Vector<double> position;
-
-  minitensor::Vector<double> weighted_centroid;
-
-  minitensor::Index count;
-};
-
-///
-/// Binary tree node for K-means filtering algorithm. See
-/// An Efficient K-means Clustering Algorithm: Analysis and Implementation
-/// T. Kanungo et al.
-/// IEEE Transactions on Pattern Analysis and Machine Intelligence
-/// 24(7) July 2002
-///
-struct KDTreeNode
-{
-  std::string name;
-
-  std::shared_ptr<KDTreeNode> parent;
-
-  // Children
-  std::shared_ptr<KDTreeNode> left;
-
-  std::shared_ptr<KDTreeNode> right;
-
-  // Bounding box of cell
-  minitensor::Vector<double> lower_corner;
-
-  minitensor::Vector<double> upper_corner;
-
-  // Weighted centroid and count
-  minitensor::Vector<double> weighted_centroid;
-
-  minitensor::Index count;
-
-  std::set<minitensor::Index> cell_points;
-
-  std::set<minitensor::Index> candidate_centers;
-
-  minitensor::Index closest_center_to_midcell;
-};
 
 ///
 /// Binary tree for K-means filtering algorithm. See
@@ -125,95 +72,82 @@ struct KDTreeNode
 /// IEEE Transactions on Pattern Analysis and Machine Intelligence
 /// 24(7) July 2002
 ///
-template <typename Node>
+/// Built in one pass over the points. The nodes are stored in flat
+/// arrays, with children after their parent, and each node owns a
+/// contiguous range of the reordered point indices. Leaves hold a few
+/// points. The filtering step splits the tree into subtrees that are
+/// processed in parallel.
+///
 class KDTree
 {
  public:
-  KDTree(std::vector<minitensor::Vector<double>> const& points, minitensor::Index const number_centers);
+  ///
+  /// Build tree of list of points.
+  ///
+  KDTree(std::vector<minitensor::Vector<double>> const& points);
 
-  std::shared_ptr<Node>&
-  get_root()
+  ///
+  /// Filtering step of K-means: find the closest center to every point
+  /// and accumulate the sum of these points and their number for each center.
+  /// \param centers Center coordinates, dimension values per center
+  /// \param sums Sum of the points closest to each center
+  /// \param counts Number of points closest to each center
+  ///
+  void
+  filter(std::vector<double> const& centers, std::vector<double>& sums, std::vector<minitensor::Index>& counts) const;
+
+  ///
+  /// \return Number of nodes in the tree
+  ///
+  minitensor::Index
+  getNumberNodes() const
   {
-    return root_;
+    return left_.size();
   }
 
  private:
-  std::shared_ptr<Node> root_;
-};
-
-///
-/// Build KD tree of list of points.
-/// \param point list
-/// \return Boost shared pointer to root node of tree.
-///
-template <typename Node>
-std::shared_ptr<Node>
-buildKDTree(std::vector<minitensor::Vector<double>> const& points);
-
-///
-/// Create KD tree node.
-/// \param point list
-/// \return Boost shared pointer to node of tree if created, 0 otherwise.
-///
-template <typename Node>
-std::shared_ptr<Node>
-createKDTreeNode(
-    std::string const&                             name,
-    std::shared_ptr<Node>                          parent,
-    std::vector<minitensor::Vector<double>> const& points,
-    std::set<minitensor::Index> const&             points_indices);
-
-///
-/// Visit Tree nodes recursively and
-/// perform the action defined by the Visitor object.
-///
-template <typename Node, typename Visitor>
-void
-visitTreeNode(Node& node, Visitor const& visitor);
+  int
+  buildNode(int const parent, int const depth, int const first, int const last);
 
-///
-/// Traverse a Tree and perform the action defined by the Visitor object.
-///
-template <typename Tree, typename Visitor>
-void
-traverseTree(Tree& tree, Visitor const& visitor);
+  void
+  pruneCenters(int const node, std::vector<double> const& centers, std::vector<int> const& candidates, std::vector<int>& pruned) const;
 
-///
-/// Output visitor for KDTree node.
-///
-template <typename Node>
-struct OutputVisitor
-{
   void
-  operator()(Node const& node) const;
+  filterNode(
+      int const                      node,
+      int const                      depth,
+      std::vector<double> const&     centers,
+      std::vector<std::vector<int>>& candidates,
+      double*                        sums,
+      minitensor::Index*             counts) const;
 
-  bool
-  pre_stop(Node const& node) const;
+  // Maximum number of points in a leaf
+  static int const leaf_size_ = 8;
 
-  bool
-  post_stop(Node const& node) const;
-};
+  minitensor::Index dimension_{0};
 
-///
-/// Filtering visitor for K-means algorithm.
-///
-template <typename Node, typename Center>
-struct FilterVisitor
-{
-  FilterVisitor(std::vector<minitensor::Vector<double>>& p, std::vector<Center>& c);
+  // Point coordinates, dimension_ values per point
+  std::vector<double> points_;
 
-  void
-  operator()(Node const& node) const;
+  // Point indices, ordered so that every node owns a range of them
+  std::vector<int> index_;
 
-  bool
-  pre_stop(Node const& node) const;
+  // Children (-1 for a leaf), parent and range of index_ of each node
+  std::vector<int> left_;
+  std::vector<int> right_;
+  std::vector<int> parent_;
+  std::vector<int> first_;
+  std::vector<int> count_;
 
-  bool
-  post_stop(Node const& node) const;
+  // Bounding box and sum of the points of each node, dimension_ values per node
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  std::vector<double> sum_;
 
-  std::vector<minitensor::Vector<double>>& points;
+  // Roots of the subtrees filtered in parallel
+  std::vector<int> subtrees_;
 
-  std::vector<Center>& centers;
+  int depth_{0};
 };
 
 ///
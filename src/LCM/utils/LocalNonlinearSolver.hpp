@@ -5,9 +5,11 @@
 #if !defined(LCM_LocalNonlinearSolver_hpp)
 #define LCM_LocalNonlinearSolver_hpp
 
+#include <Kokkos_Core.hpp>
 #include <Sacado.hpp>
 #include <Teuchos_LAPACK.hpp>
 
+#include "Albany_Macros.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 
 namespace LCM {
@@ -66,6 +68,63 @@ class LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits> : public LocalN
   computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
 };
 
+///
+/// Dense LU factorization with partial pivoting of a small column-major
+/// system of compile-time maximum size N, for use in place of LAPACK GESV
+/// on local systems. Only the leading n x n block is used.
+///
+template <int N>
+struct FixedLU
+{
+  KOKKOS_INLINE_FUNCTION
+  static void
+  factor(int n, RealType* A, int* piv);
+
+  KOKKOS_INLINE_FUNCTION
+  static void
+  solve(int n, RealType const* LU, int const* piv, RealType* b);
+};
+
+///
+/// Local Nonlinear Solver with the residual, Jacobian and LU factors on the
+/// stack. Same interface as LocalNonlinearSolver; the containers can be
+/// std::array or std::vector of size n <= N.
+///
+template <typename EvalT, typename Traits, int N>
+class FixedLocalNonlinearSolver;
+
+// -----------------------------------------------------------------------------
+// Residual
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+class FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>
+{
+ public:
+  typedef typename PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+  template <typename AT, typename XT, typename BT>
+  void
+  solve(AT& A, XT& X, BT& B);
+  template <typename AT, typename XT, typename BT>
+  void
+  computeFadInfo(AT& A, XT& X, BT& B);
+};
+
+// -----------------------------------------------------------------------------
+// Jacobian
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+class FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>
+{
+ public:
+  typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+  template <typename AT, typename XT, typename BT>
+  void
+  solve(AT& A, XT& X, BT& B);
+  template <typename AT, typename XT, typename BT>
+  void
+  computeFadInfo(AT& A, XT& X, BT& B);
+};
+
 }  // namespace LCM
 
 #include "LocalNonlinearSolver_Def.hpp"
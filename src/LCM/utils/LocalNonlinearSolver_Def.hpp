@@ -124,4 +124,154 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::computeFadInfo(std::
   }
 }
 
+// -----------------------------------------------------------------------------
+// Fixed-size LU
+// -----------------------------------------------------------------------------
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+FixedLU<N>::factor(int n, RealType* A, int* piv)
+{
+  for (int k(0); k < n; ++k) {
+    // partial pivoting
+    int      p(k);
+    RealType max_abs = std::abs(A[k + N * k]);
+    for (int i(k + 1); i < n; ++i) {
+      if (std::abs(A[i + N * k]) > max_abs) {
+        max_abs = std::abs(A[i + N * k]);
+        p       = i;
+      }
+    }
+    piv[k] = p;
+    if (p != k) {
+      for (int j(0); j < n; ++j) {
+        RealType const t = A[k + N * j];
+        A[k + N * j]     = A[p + N * j];
+        A[p + N * j]     = t;
+      }
+    }
+
+    // eliminate below the pivot, as GESV does a zero pivot is not an error
+    // here and propagates into the solution
+    RealType const inv_pivot = 1.0 / A[k + N * k];
+    for (int i(k + 1); i < n; ++i) {
+      A[i + N * k] *= inv_pivot;
+      RealType const l = A[i + N * k];
+      for (int j(k + 1); j < n; ++j) A[i + N * j] -= l * A[k + N * j];
+    }
+  }
+}
+
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+FixedLU<N>::solve(int n, RealType const* LU, int const* piv, RealType* b)
+{
+  for (int k(0); k < n; ++k) {
+    if (piv[k] != k) {
+      RealType const t = b[k];
+      b[k]             = b[piv[k]];
+      b[piv[k]]        = t;
+    }
+  }
+  // forward substitution, unit lower triangle
+  for (int i(1); i < n; ++i)
+    for (int j(0); j < i; ++j) b[i] -= LU[i + N * j] * b[j];
+  // backward substitution
+  for (int i(n - 1); i >= 0; --i) {
+    for (int j(i + 1); j < n; ++j) b[i] -= LU[i + N * j] * b[j];
+    b[i] /= LU[i + N * i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Fixed-size Residual
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+template <typename AT, typename XT, typename BT>
+void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::solve(AT& A, XT& X, BT& B)
+{
+  int const n = B.size();
+  ALBANY_ASSERT(n <= N, "FixedLocalNonlinearSolver: system size " << n << " exceeds the maximum " << N);
+
+  RealType LU[N * N];
+  RealType F[N];
+  int      piv[N];
+  for (int i(0); i < n; ++i) {
+    F[i] = B[i];
+    for (int j(0); j < n; ++j) LU[i + N * j] = A[i + n * j];
+  }
+
+  FixedLU<N>::factor(n, LU, piv);
+  FixedLU<N>::solve(n, LU, piv, F);
+
+  // increment the solution
+  for (int i(0); i < n; ++i) X[i] -= F[i];
+}
+
+template <typename Traits, int N>
+template <typename AT, typename XT, typename BT>
+void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::computeFadInfo(AT& A, XT& X, BT& B)
+{
+  // no-op
+}
+
+// -----------------------------------------------------------------------------
+// Fixed-size Jacobian
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+template <typename AT, typename XT, typename BT>
+void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::solve(AT& A, XT& X, BT& B)
+{
+  int const n = B.size();
+  ALBANY_ASSERT(n <= N, "FixedLocalNonlinearSolver: system size " << n << " exceeds the maximum " << N);
+
+  RealType LU[N * N];
+  RealType F[N];
+  int      piv[N];
+  for (int i(0); i < n; ++i) {
+    F[i] = B[i].val();
+    for (int j(0); j < n; ++j) LU[i + N * j] = A[i + n * j].val();
+  }
+
+  FixedLU<N>::factor(n, LU, piv);
+  FixedLU<N>::solve(n, LU, piv, F);
+
+  // increment the solution
+  for (int i(0); i < n; ++i) X[i].val() -= F[i];
+}
+
+template <typename Traits, int N>
+template <typename AT, typename XT, typename BT>
+void
+FixedLocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::computeFadInfo(AT& A, XT& X, BT& B)
+{
+  // local system size
+  int const n             = B.size();
+  int const numGlobalVars = B[0].size();
+  ALBANY_ASSERT(n <= N, "FixedLocalNonlinearSolver: system size " << n << " exceeds the maximum " << N);
+  ALBANY_PANIC(
+      numGlobalVars == 0,
+      "In FixedLocalNonlinearSolver<Jacobian> the numGLobalVars is zero where "
+      "it should be positive\n");
+
+  // factor the local jacobian once
+  RealType LU[N * N];
+  int      piv[N];
+  for (int i(0); i < n; ++i)
+    for (int j(0); j < n; ++j) LU[i + N * j] = A[i + n * j].val();
+  FixedLU<N>::factor(n, LU, piv);
+
+  for (int i(0); i < n; ++i) X[i].resize(numGlobalVars);
+
+  // solve for dXdP one global variable at a time
+  RealType dBdP[N];
+  for (int j(0); j < numGlobalVars; ++j) {
+    for (int i(0); i < n; ++i) dBdP[i] = B[i].dx(j);
+    FixedLU<N>::solve(n, LU, piv, dBdP);
+    for (int i(0); i < n; ++i) X[i].fastAccessDx(j) = -dBdP[i];
+  }
+}
+
 }  // namespace LCM
@@ -9,6 +9,7 @@
 #include "NOX_Abstract_PrePostOperator.H"
 #include "NOX_Abstract_Vector.H"
 #include "NOX_StatusTest_ModelEvaluatorFlag.hpp"
+#include "Teuchos_ParameterList.hpp"
 
 namespace LCM {
 
@@ -58,6 +59,16 @@ class SolutionSniffer : public NOX::Abstract::PrePostOperator
   ST                                                norm_diff_{0.0};
 };
 
+///
+/// Combine the NOX "Status Tests" of the solver parameters with status_test
+/// by OR, and reset it at the beginning of every nonlinear solve with a
+/// SolutionSniffer, so that the model evaluators can fail a step (for
+/// example, to trigger a global load step reduction). Returns false, and
+/// does nothing, without NOX "Solver Options" and "Status Tests".
+///
+bool
+addModelEvaluatorFlagStatusTest(Teuchos::ParameterList& params, Teuchos::RCP<NOX::StatusTest::Generic> const& status_test);
+
 }  // namespace LCM
 
 #endif  // LCM_SolutionSniffer_hpp
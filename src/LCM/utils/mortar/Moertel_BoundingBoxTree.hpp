@@ -0,0 +1,197 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef MOERTEL_BOUNDINGBOXTREE_HPP
+#define MOERTEL_BOUNDINGBOXTREE_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace MoertelT {
+
+/*!
+\brief Axis-aligned bounding box in 3D
+*/
+struct BoundingBox
+{
+  double min[3]{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  double max[3]{-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+
+  //! Grow the box to contain the point x
+  void
+  Add(double const* x)
+  {
+    for (int i = 0; i < 3; ++i) {
+      min[i] = std::min(min[i], x[i]);
+      max[i] = std::max(max[i], x[i]);
+    }
+  }
+
+  //! Grow the box to contain the box b
+  void
+  Add(BoundingBox const& b)
+  {
+    for (int i = 0; i < 3; ++i) {
+      min[i] = std::min(min[i], b.min[i]);
+      max[i] = std::max(max[i], b.max[i]);
+    }
+  }
+
+  //! Grow the box by d in every direction
+  void
+  Inflate(double const d)
+  {
+    for (int i = 0; i < 3; ++i) {
+      min[i] -= d;
+      max[i] += d;
+    }
+  }
+
+  bool
+  Overlaps(BoundingBox const& b) const
+  {
+    for (int i = 0; i < 3; ++i)
+      if (max[i] < b.min[i] || b.max[i] < min[i]) return false;
+    return true;
+  }
+};
+
+/*!
+\class BoundingBoxTree
+
+\brief <b> Bounding volume hierarchy over a set of boxes </b>
+
+Used as the broad phase of the 3D mortar integration: the tree is built
+over the boxes of the master segments, and each slave segment only
+queries the tree instead of visiting every master segment.
+
+The topology of the tree is fixed by \ref Build(). As the contact
+surfaces move between Newton iterations the boxes are updated with
+\ref Refit(), which recomputes the boxes of the tree nodes bottom up
+without changing the topology. The tree stays correct after a refit,
+it just becomes less tight if the surfaces move a lot.
+
+\ref Query() is const and may be called concurrently.
+*/
+class BoundingBoxTree
+{
+ public:
+  //! Build the tree over boxes
+  void
+  Build(std::vector<BoundingBox> const& boxes)
+  {
+    nodes_.clear();
+    boxes_ = boxes;
+    index_.resize(boxes.size());
+    for (int i = 0; i < static_cast<int>(boxes.size()); ++i) index_[i] = i;
+    if (boxes.empty()) return;
+    nodes_.reserve(2 * boxes.size() / LeafSize + 1);
+    BuildNode(boxes, 0, boxes.size());
+  }
+
+  //! Update the boxes, keeping the topology of the tree
+  void
+  Refit(std::vector<BoundingBox> const& boxes)
+  {
+    boxes_ = boxes;
+    // children are always stored after their parent
+    for (int n = static_cast<int>(nodes_.size()) - 1; n >= 0; --n) {
+      TreeNode& node = nodes_[n];
+      node.box       = BoundingBox();
+      if (node.left < 0) {
+        for (int i = node.first; i < node.first + node.count; ++i) node.box.Add(boxes_[index_[i]]);
+      } else {
+        node.box.Add(nodes_[node.left].box);
+        node.box.Add(nodes_[node.right].box);
+      }
+    }
+  }
+
+  //! Append to result the indices of the boxes that overlap box
+  void
+  Query(BoundingBox const& box, std::vector<int>& result) const
+  {
+    if (nodes_.empty()) return;
+    int stack[64];
+    int top      = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+      TreeNode const& node = nodes_[stack[--top]];
+      if (node.box.Overlaps(box) == false) continue;
+      if (node.left < 0) {
+        for (int i = node.first; i < node.first + node.count; ++i)
+          if (boxes_[index_[i]].Overlaps(box)) result.push_back(index_[i]);
+      } else {
+        stack[top++] = node.left;
+        stack[top++] = node.right;
+      }
+    }
+  }
+
+  //! Number of boxes in the tree
+  int
+  Nbox() const
+  {
+    return index_.size();
+  }
+
+ private:
+  static int const LeafSize = 4;
+
+  struct TreeNode
+  {
+    BoundingBox box;
+    int         left{-1};  // children, -1 for a leaf
+    int         right{-1};
+    int         first{0};  // range of index_ held by a leaf
+    int         count{0};
+  };
+
+  // Split [first, last) at the median of the box centers along the longest
+  // extent of the centers. The depth is at most log2(n / LeafSize) + 1.
+  int
+  BuildNode(std::vector<BoundingBox> const& boxes, int const first, int const last)
+  {
+    int const n = nodes_.size();
+    nodes_.push_back(TreeNode());
+
+    BoundingBox centers;
+    for (int i = first; i < last; ++i) {
+      BoundingBox const& b = boxes[index_[i]];
+      nodes_[n].box.Add(b);
+      double const c[3] = {0.5 * (b.min[0] + b.max[0]), 0.5 * (b.min[1] + b.max[1]), 0.5 * (b.min[2] + b.max[2])};
+      centers.Add(c);
+    }
+
+    if (last - first <= LeafSize) {
+      nodes_[n].first = first;
+      nodes_[n].count = last - first;
+      return n;
+    }
+
+    int axis = 0;
+    for (int i = 1; i < 3; ++i)
+      if (centers.max[i] - centers.min[i] > centers.max[axis] - centers.min[axis]) axis = i;
+
+    int const mid = first + (last - first) / 2;
+    std::nth_element(index_.begin() + first, index_.begin() + mid, index_.begin() + last, [&](int const a, int const b) {
+      return boxes[a].min[axis] + boxes[a].max[axis] < boxes[b].min[axis] + boxes[b].max[axis];
+    });
+
+    int const left  = BuildNode(boxes, first, mid);
+    int const right = BuildNode(boxes, mid, last);
+    nodes_[n].left  = left;
+    nodes_[n].right = right;
+    return n;
+  }
+
+  std::vector<BoundingBox> boxes_;
+  std::vector<TreeNode>    nodes_;
+  std::vector<int>         index_;
+};
+
+}  // namespace MoertelT
+
+#endif  // MOERTEL_BOUNDINGBOXTREE_HPP
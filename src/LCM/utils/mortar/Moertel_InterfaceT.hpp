@@ -15,6 +15,7 @@
 #include "Tpetra_CrsMatrix.hpp"
 
 // mrtr includes
+#include "Moertel_BoundingBoxTree.hpp"
 #include "Moertel_NodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
 #include "Moertel_SegmentT.hpp"
@@ -971,6 +972,13 @@ class InterfaceT
   bool
   Integrate_3D();
 
+  // candidate master segments for each owned slave segment (3D broad phase)
+  void
+  Integrate_3D_Candidates(
+      std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*> const& ssegs,
+      std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*> const& msegs,
+      std::vector<std::vector<int>>&                                  candidates);
+
   // integrate the overlap of 2 segments in 3D (master/slave contribution)
   bool Integrate_3D_Section(MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT) & sseg, MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT) & mseg);
 
@@ -1004,6 +1012,19 @@ class InterfaceT
 
   MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::FunctionType primal_;  // the type of functions to be set as trace space function
   MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::FunctionType dual_;    // the type of functions to be set as LM space function
+
+  MoertelT::BoundingBoxTree mtree_;     // broad phase tree over the master segments
+  std::vector<int>          mtreeids_;  // ids of the master segments mtree_ was built for
+
+  // sparse exchange of the non-local rows of D and M in Assemble_3D, reused
+  // while the layout of the rows does not change
+  bool                            exchange_valid_{false};
+  std::vector<int>                exchange_sendprocs_;  // processes I send rows to
+  std::vector<int>                exchange_recvprocs_;  // processes I receive rows from
+  std::map<int, std::vector<int>> exchange_colD_s_;     // layout of the D rows sent, by process
+  std::map<int, std::vector<int>> exchange_colM_s_;     // layout of the M rows sent, by process
+  std::map<int, std::vector<int>> exchange_colD_r_;     // layout of the D rows received, by process
+  std::map<int, std::vector<int>> exchange_colM_r_;     // layout of the M rows received, by process
 };
 
 // Now, the explicit template function declarations (templated on dimension)
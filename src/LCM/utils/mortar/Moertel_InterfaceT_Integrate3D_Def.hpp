@@ -2,6 +2,11 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <Kokkos_Core.hpp>
+#include <Teuchos_CommHelpers.hpp>
+
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <vector>
 
@@ -11,6 +16,7 @@
 #include "Moertel_PnodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
 #include "Moertel_SegmentT.hpp"
+#include "Moertel_Tolerances.hpp"
 #include "Moertel_UtilsT.hpp"
 
 double const CONSTRAINT_MATRIX_ZERO = 1.0e-11;
@@ -125,56 +131,118 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D()
   int mside = MortarSide();
   int sside = OtherSide(mside);
 
-  // loop over all segments of slave side
+  // the slave segments that have at least one node I own
+  std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*>                          ssegs;
   std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
 
   for (scurr = rseg_[sside].begin(); scurr != rseg_[sside].end(); ++scurr) {
-    // the segment to be integrated
-    Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actsseg = scurr->second;
-
-#if 0
-    std::cout << "\n\nActive sseg id " << actsseg->Id() << "\n";
-#endif
-
-    // check whether I own at least one of the nodes on this slave segment
-    int const nnode                                 = actsseg->Nnode();
-    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = actsseg->Nodes();
-    bool foundone                                   = false;
+    int const nnode                                 = scurr->second->Nnode();
+    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = scurr->second->Nodes();
 
     for (int i = 0; i < nnode; ++i)
       if (NodePID(nodes[i]->Id()) == lcomm_->getRank()) {
-        foundone = true;
+        ssegs.push_back(scurr->second.get());
         break;
       }
+  }
 
-    // if none of the nodes belongs to me, do nothing on this segment
-    if (!foundone) continue;
+  // all segments on the master side
+  std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*>                          msegs;
+  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator mcurr;
 
-    // time this process
-    // Teuchos::Time time(*lComm());
-    // time.ResetStartTime();
+  for (mcurr = rseg_[mside].begin(); mcurr != rseg_[mside].end(); ++mcurr) msegs.push_back(mcurr->second.get());
 
-    // loop over all segments on the master side
-    std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator mcurr;
+  // broad phase: the master segments that may overlap each slave segment
+  std::vector<std::vector<int>> candidates;
+  Integrate_3D_Candidates(ssegs, msegs, candidates);
 
-    for (mcurr = rseg_[mside].begin(); mcurr != rseg_[mside].end(); ++mcurr) {
-      Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actmseg = mcurr->second;
-#if 0
-      std::cout << "Active mseg id " << actmseg->Id() << std::endl;
-#endif
+  if (OutLevel() > 5) {
+    std::size_t npairs = 0;
+    for (std::size_t s = 0; s < ssegs.size(); ++s) npairs += candidates[s].size();
+    std::cout << "MoertelT::Interface " << Id() << ": " << npairs << " candidate segment pairs out of " << ssegs.size() * msegs.size() << " on proc "
+              << gcomm_->getRank() << "\n";
+  }
 
-      // if there is an overlap, integrate the pair
-      // (whether there is an overlap or not will be checked inside)
-      Integrate_3D_Section(*actsseg, *actmseg);
+  // if there is an overlap, integrate the pair
+  // (whether there is an overlap or not will be checked inside).
+  // The candidates are sorted, so the pairs are assembled in the same order
+  // as when looping over all master segments.
+  for (std::size_t s = 0; s < ssegs.size(); ++s)
+    for (std::size_t c = 0; c < candidates[s].size(); ++c) Integrate_3D_Section(*ssegs[s], *msegs[candidates[s][c]]);
 
-    }  // for (mcurr=rseg_[mside].begin(); mcurr!=rseg_[mside].end(); ++mcurr)
+  return true;
+}
 
-    // std::cout << "time for this slave segment: " << time.ElapsedTime() <<
-    // std::endl;
+/*----------------------------------------------------------------------*
+  | find the candidate master segments of each slave segment (3D)        |
+  | with a bounding box tree over the master side                        |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+void
+MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D_Candidates(
+    std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*> const& ssegs,
+    std::vector<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*> const& msegs,
+    std::vector<std::vector<int>>&                                  candidates)
+{
+  int const nsseg = ssegs.size();
+  int const nmseg = msegs.size();
 
-  }  // for (scurr=rseg_[sside].begin(); scurr!=rseg_[sside].end(); ++scurr)
+  candidates.assign(nsseg, std::vector<int>());
 
-  return true;
+  // without the search every master segment is a candidate
+  bool const search = intparams_->get("bounding box search", true);
+  if (!search) {
+    for (int s = 0; s < nsseg; ++s)
+      for (int m = 0; m < nmseg; ++m) candidates[s].push_back(m);
+    return;
+  }
+
+  // Box of a segment, grown by Rough_Search_Radius times its diameter.
+  // OverlapT::QuickOverlapTest() rejects a pair if its closest nodes are
+  // further apart than Rough_Search_Radius times the sum of the diameters,
+  // so two segments whose boxes do not overlap could not pass it either.
+  auto const segment_box = [](MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT) & seg) {
+    int const                                 nnode = seg.Nnode();
+    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = seg.Nodes();
+    MoertelT::BoundingBox                     box;
+    double                                    diam2 = 0.0;
+    for (int i = 0; i < nnode; ++i) {
+      double const* xi = nodes[i]->XCoords();
+      box.Add(xi);
+      for (int j = 0; j < i; ++j) {
+        double const* xj = nodes[j]->XCoords();
+        double const  d2 = (xi[0] - xj[0]) * (xi[0] - xj[0]) + (xi[1] - xj[1]) * (xi[1] - xj[1]) + (xi[2] - xj[2]) * (xi[2] - xj[2]);
+        diam2            = std::max(diam2, d2);
+      }
+    }
+    box.Inflate(MOERTEL::Rough_Search_Radius * std::sqrt(diam2));
+    return box;
+  };
+
+  using HostRange = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  std::vector<MoertelT::BoundingBox> mboxes(nmseg);
+  std::vector<int>                   mids(nmseg);
+
+  Kokkos::parallel_for("Moertel master boxes", HostRange(0, nmseg), [&](int const m) { mboxes[m] = segment_box(*msegs[m]); });
+  Kokkos::DefaultHostExecutionSpace().fence();
+
+  for (int m = 0; m < nmseg; ++m) mids[m] = msegs[m]->Id();
+
+  // the segments only move between calls, so keep the topology of the tree
+  // unless the master side itself changed
+  if (mids == mtreeids_) {
+    mtree_.Refit(mboxes);
+  } else {
+    mtree_.Build(mboxes);
+    mtreeids_ = mids;
+  }
+
+  Kokkos::parallel_for("Moertel broad phase", HostRange(0, nsseg), [&](int const s) {
+    mtree_.Query(segment_box(*ssegs[s]), candidates[s]);
+    std::sort(candidates[s].begin(), candidates[s].end());
+  });
+  Kokkos::DefaultHostExecutionSpace().fence();
 }
 
 /*----------------------------------------------------------------------*
@@ -451,21 +519,36 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Assemble_3D(Tpetra::CrsMatrix<ST,
   // here. Boundary terms of D and M, Mmod are assembled non-local (that is to
   // close inner-interface nodes). If these inner-interface nodes belong
   // to a different proc values were not assembled.
-  // Loop snodes again an check and communicate these entries
+  // Loop snodes again, send these entries to the owner of the node and
+  // receive the entries of my own nodes. Only processes whose part of the
+  // slave side is close to each other exchange data.
+  // Untested: no test runs Assemble_3D in parallel. It is reached through
+  // ManagerT::Mortar_Integrate, which the Albany contact code does not call,
+  // and this directory is not part of the Albany build.
   if (lcomm_->getSize() != 1) {
     // note that we miss the communication of Mmod yet
+    int const myrank = lcomm_->getRank();
+    int const nproc  = lcomm_->getSize();
 
-    // allocate a sendbuffer for D and M
-    int                 countD = 0;
-    int                 countM = 0;
-    std::vector<int>    colD_s(countD);
-    std::vector<double> valD_s(countD);
-    std::vector<int>    colM_s(countM);
-    std::vector<double> valM_s(countM);
+    // sendbuffers for D and M, by owner of the node. Each row is stored as
+    // node id, row size, followed by the row
+    std::map<int, std::vector<int>>    colD_s;
+    std::map<int, std::vector<double>> valD_s;
+    std::map<int, std::vector<int>>    colM_s;
+    std::map<int, std::vector<double>> valM_s;
+
+    // boxes of the slave nodes I own and of the nodes I send rows for
+    MoertelT::BoundingBox ownbox;
+    MoertelT::BoundingBox sendbox;
 
     for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
+      int const owner = NodePID(curr->second->Id());
+
       // we've done all my own nodes already
-      if (NodePID(curr->second->Id()) == lcomm_->getRank()) continue;
+      if (owner == myrank) {
+        ownbox.Add(curr->second->XCoords());
+        continue;
+      }
 
       // check whether we have M or D values here
       // get maps D and M from node
@@ -475,284 +558,381 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Assemble_3D(Tpetra::CrsMatrix<ST,
       // if there's no D/M there's nothing to do
       if (Drow == Teuchos::null && Mrow == Teuchos::null) continue;
 
-      // std::cout << "lProc " << lComm()->MyPID() << " Node " <<
-      // curr->second->Id() << " unassembled\n";
+      sendbox.Add(curr->second->XCoords());
+
+      std::map<int, double>::iterator rowcurr;
 
       // fill the D sendbuffer
       if (Drow != Teuchos::null) {
-        // resize the sendbuffers
-        colD_s.resize(colD_s.size() + Drow->size() + 2);
-        valD_s.resize(valD_s.size() + Drow->size() + 2);
+        std::vector<int>&    colD = colD_s[owner];
+        std::vector<double>& valD = valD_s[owner];
         // Add node Id and size
-        colD_s[countD]     = curr->second->Id();
-        valD_s[countD]     = 0.0;
-        colD_s[countD + 1] = (int)Drow->size();
-        valD_s[countD + 1] = 0.0;
-        countD += 2;
-        // loop D
-        std::map<int, double>::iterator rowcurr;
+        colD.push_back(curr->second->Id());
+        valD.push_back(0.0);
+        colD.push_back((int)Drow->size());
+        valD.push_back(0.0);
 
         for (rowcurr = Drow->begin(); rowcurr != Drow->end(); ++rowcurr) {
-          colD_s[countD] = rowcurr->first;
-          valD_s[countD] = rowcurr->second;
-          ++countD;
+          colD.push_back(rowcurr->first);
+          valD.push_back(rowcurr->second);
         }
       }
 
-      // std::cout << "lProc " << lComm()->MyPID() << " Node " <<
-      // curr->second->Id() << " countD " << countD << std::endl;
-
       // fill the M sendbuffer
       if (Mrow != Teuchos::null) {
-        // resize the sendbuffers
-        colM_s.resize(colM_s.size() + Mrow->size() + 2);
-        valM_s.resize(valM_s.size() + Mrow->size() + 2);
+        std::vector<int>&    colM = colM_s[owner];
+        std::vector<double>& valM = valM_s[owner];
         // Add node id and size
-        colM_s[countM]     = curr->second->Id();
-        valM_s[countM]     = 0.0;
-        colM_s[countM + 1] = Mrow->size();
-        valM_s[countM + 1] = 0.0;
-        countM += 2;
-        // loop M
-        std::map<int, double>::iterator rowcurr;
+        colM.push_back(curr->second->Id());
+        valM.push_back(0.0);
+        colM.push_back((int)Mrow->size());
+        valM.push_back(0.0);
 
         for (rowcurr = Mrow->begin(); rowcurr != Mrow->end(); ++rowcurr) {
-          colM_s[countM] = rowcurr->first;
-          valM_s[countM] = rowcurr->second;
-          ++countM;
+          colM.push_back(rowcurr->first);
+          valM.push_back(rowcurr->second);
         }
       }
-
-      // std::cout << "lProc " << lComm()->MyPID() << " Node " <<
-      // curr->second->Id() << " countM " << countM << std::endl;
     }  // for (curr=rnode_[sside].begin(); curr!=rnode_[sside].end(); ++curr)
 
-    // loop all processes in lComm and communicate and assemble
-    for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
-      // send sizes
-      int countDr = countD;
-      int countMr = countM;
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countDr);
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countMr);
-      // allocate receive buffers
-      std::vector<int>    colD_r(countDr);
-      std::vector<double> valD_r(countDr);
-      std::vector<int>    colM_r(countMr);
-      std::vector<double> valM_r(countMr);
-
-      // send data
-      if (proc == lcomm_->getRank()) {
-        for (int i = 0; i < countDr; ++i) {
-          colD_r[i] = colD_s[i];
-          valD_r[i] = valD_s[i];
+    // The layout of the rows (node ids and columns) only changes when the
+    // contact set changes. While it is the same on all processes, the
+    // neighbors and the received columns of the last call are reused and
+    // only the values are communicated.
+    int same = exchange_valid_ && colD_s == exchange_colD_s_ && colM_s == exchange_colM_s_;
+    int allsame;
+    Teuchos::reduceAll<LO, int>(*lcomm_, Teuchos::REDUCE_MIN, 1, &same, &allsame);
+
+    if (allsame == 0) {
+      // find the neighbors from the boxes of all processes. I send to the
+      // processes whose own nodes are close to the nodes I send for, and
+      // receive from the processes that send for nodes close to mine.
+      double mybox[12];
+      for (int i = 0; i < 3; ++i) {
+        mybox[i]     = ownbox.min[i];
+        mybox[3 + i] = ownbox.max[i];
+        mybox[6 + i] = sendbox.min[i];
+        mybox[9 + i] = sendbox.max[i];
+      }
+      std::vector<double> boxes(12 * nproc);
+      Teuchos::gatherAll<LO, double>(*lcomm_, 12, mybox, 12 * nproc, &boxes[0]);
+
+      std::vector<int> sendprocs;
+      std::vector<int> recvprocs;
+
+      for (int proc = 0; proc < nproc; ++proc) {
+        if (proc == myrank) continue;
+        MoertelT::BoundingBox procown;
+        MoertelT::BoundingBox procsend;
+        for (int i = 0; i < 3; ++i) {
+          procown.min[i]  = boxes[12 * proc + i];
+          procown.max[i]  = boxes[12 * proc + 3 + i];
+          procsend.min[i] = boxes[12 * proc + 6 + i];
+          procsend.max[i] = boxes[12 * proc + 9 + i];
         }
+        if (sendbox.Overlaps(procown)) sendprocs.push_back(proc);
+        if (procsend.Overlaps(ownbox)) recvprocs.push_back(proc);
+      }
 
-        for (int i = 0; i < countMr; ++i) {
-          colM_r[i] = colM_s[i];
-          valM_r[i] = valM_s[i];
+      // every owner I have rows for is within the boxes
+      std::map<int, std::vector<int>>::iterator scurr;
+      for (scurr = colD_s.begin(); scurr != colD_s.end(); ++scurr) {
+        if (std::find(sendprocs.begin(), sendprocs.end(), scurr->first) == sendprocs.end()) {
+          std::stringstream oss;
+          oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+              << "***ERR*** Owner " << scurr->first << " of D rows is not a neighbor\n"
+              << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+          throw MoertelT::ReportError(oss);
         }
       }
-      if (countDr > 0) {
-        Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colD_r[0]);
-        Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valD_r[0]);
+      for (scurr = colM_s.begin(); scurr != colM_s.end(); ++scurr) {
+        if (std::find(sendprocs.begin(), sendprocs.end(), scurr->first) == sendprocs.end()) {
+          std::stringstream oss;
+          oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+              << "***ERR*** Owner " << scurr->first << " of M rows is not a neighbor\n"
+              << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+          throw MoertelT::ReportError(oss);
+        }
       }
 
-      if (countMr > 0) {
-        Teuchos::broadcast<LO, int>(*lcomm_, proc, countMr, &colM_r[0]);
-        Teuchos::broadcast<LO, double>(*lcomm_, proc, countMr, &valM_r[0]);
+      // rows I have for proc, without adding an entry to the sendbuffers
+      std::vector<int> const none;
+      auto const             rows = [&none](std::map<int, std::vector<int>> const& col, int const proc) -> std::vector<int> const& {
+        std::map<int, std::vector<int>>::const_iterator it = col.find(proc);
+        return it == col.end() ? none : it->second;
+      };
+
+      // exchange sizes with all neighbors
+      std::vector<Teuchos::RCP<Teuchos::CommRequest<LO>>> requests;
+      std::vector<Teuchos::ArrayRCP<int>>                 sizes_r(recvprocs.size());
+      std::vector<Teuchos::ArrayRCP<int>>                 sizes_s(sendprocs.size());
+
+      for (std::size_t p = 0; p < recvprocs.size(); ++p) {
+        sizes_r[p] = Teuchos::arcp<int>(2);
+        requests.push_back(Teuchos::ireceive<LO, int>(*lcomm_, sizes_r[p], recvprocs[p]));
+      }
+      for (std::size_t p = 0; p < sendprocs.size(); ++p) {
+        sizes_s[p]    = Teuchos::arcp<int>(2);
+        sizes_s[p][0] = rows(colD_s, sendprocs[p]).size();
+        sizes_s[p][1] = rows(colM_s, sendprocs[p]).size();
+        requests.push_back(Teuchos::isend<LO, int>(*lcomm_, sizes_s[p].getConst(), sendprocs[p]));
+      }
+      Teuchos::waitAll(*lcomm_, Teuchos::arrayViewFromVector(requests));
+      requests.clear();
+
+      // keep only the neighbors that have data
+      exchange_sendprocs_.clear();
+      exchange_recvprocs_.clear();
+      exchange_colD_r_.clear();
+      exchange_colM_r_.clear();
+
+      for (std::size_t p = 0; p < sendprocs.size(); ++p)
+        if (sizes_s[p][0] + sizes_s[p][1] > 0) exchange_sendprocs_.push_back(sendprocs[p]);
+
+      for (std::size_t p = 0; p < recvprocs.size(); ++p) {
+        if (sizes_r[p][0] + sizes_r[p][1] == 0) continue;
+        exchange_recvprocs_.push_back(recvprocs[p]);
+        exchange_colD_r_[recvprocs[p]].resize(sizes_r[p][0]);
+        exchange_colM_r_[recvprocs[p]].resize(sizes_r[p][1]);
       }
 
-      // Assemble (remote procs only)
-      if (proc != lcomm_->getRank()) {
-        // --------------------------------------------------- Assemble D
-        for (int i = 0; i < countDr;) {
-          int nodeid = colD_r[i];
-          int size   = colD_r[i + 1];
-          i += 2;
+      // exchange the layout of the rows
+      for (std::size_t p = 0; p < exchange_recvprocs_.size(); ++p) {
+        int const         proc   = exchange_recvprocs_[p];
+        std::vector<int>& colD_r = exchange_colD_r_[proc];
+        std::vector<int>& colM_r = exchange_colM_r_[proc];
+        if (colD_r.size() > 0) requests.push_back(Teuchos::ireceive<LO, int>(*lcomm_, Teuchos::arcp(&colD_r[0], 0, colD_r.size(), false), proc));
+        if (colM_r.size() > 0) requests.push_back(Teuchos::ireceive<LO, int>(*lcomm_, Teuchos::arcp(&colM_r[0], 0, colM_r.size(), false), proc));
+      }
+      for (std::size_t p = 0; p < exchange_sendprocs_.size(); ++p) {
+        int const               proc   = exchange_sendprocs_[p];
+        std::vector<int> const& colD_x = rows(colD_s, proc);
+        std::vector<int> const& colM_x = rows(colM_s, proc);
+        if (colD_x.size() > 0) requests.push_back(Teuchos::isend<LO, int>(*lcomm_, Teuchos::arcp(&colD_x[0], 0, colD_x.size(), false), proc));
+        if (colM_x.size() > 0) requests.push_back(Teuchos::isend<LO, int>(*lcomm_, Teuchos::arcp(&colM_x[0], 0, colM_x.size(), false), proc));
+      }
+      Teuchos::waitAll(*lcomm_, Teuchos::arrayViewFromVector(requests));
+
+      exchange_colD_s_ = colD_s;
+      exchange_colM_s_ = colM_s;
+      exchange_valid_  = true;
+
+      if (OutLevel() > 5)
+        std::cout << "MoertelT: Interface " << Id_ << " proc " << myrank << ": rows of D and M go to " << exchange_sendprocs_.size() << " and come from "
+                  << exchange_recvprocs_.size() << " of " << nproc << " processes\n";
+    }  // if (allsame == 0)
+
+    // exchange the values
+    std::map<int, std::vector<double>>                  valD_recv;
+    std::map<int, std::vector<double>>                  valM_recv;
+    std::vector<Teuchos::RCP<Teuchos::CommRequest<LO>>> requests;
+
+    for (std::size_t p = 0; p < exchange_recvprocs_.size(); ++p) {
+      int const            proc = exchange_recvprocs_[p];
+      std::vector<double>& valD = valD_recv[proc];
+      std::vector<double>& valM = valM_recv[proc];
+      valD.resize(exchange_colD_r_[proc].size());
+      valM.resize(exchange_colM_r_[proc].size());
+      if (valD.size() > 0) requests.push_back(Teuchos::ireceive<LO, double>(*lcomm_, Teuchos::arcp(&valD[0], 0, valD.size(), false), proc));
+      if (valM.size() > 0) requests.push_back(Teuchos::ireceive<LO, double>(*lcomm_, Teuchos::arcp(&valM[0], 0, valM.size(), false), proc));
+    }
+    for (std::size_t p = 0; p < exchange_sendprocs_.size(); ++p) {
+      int const                  proc = exchange_sendprocs_[p];
+      std::vector<double> const& valD = valD_s[proc];
+      std::vector<double> const& valM = valM_s[proc];
+      if (valD.size() > 0) requests.push_back(Teuchos::isend<LO, double>(*lcomm_, Teuchos::arcp(&valD[0], 0, valD.size(), false), proc));
+      if (valM.size() > 0) requests.push_back(Teuchos::isend<LO, double>(*lcomm_, Teuchos::arcp(&valM[0], 0, valM.size(), false), proc));
+    }
+    Teuchos::waitAll(*lcomm_, Teuchos::arrayViewFromVector(requests));
+
+    // assemble the rows of my own nodes
+    for (std::size_t p = 0; p < exchange_recvprocs_.size(); ++p) {
+      int const                  proc    = exchange_recvprocs_[p];
+      std::vector<int> const&    colD_r  = exchange_colD_r_[proc];
+      std::vector<int> const&    colM_r  = exchange_colM_r_[proc];
+      std::vector<double> const& valD_r  = valD_recv[proc];
+      std::vector<double> const& valM_r  = valM_recv[proc];
+      int const                  countDr = colD_r.size();
+      int const                  countMr = colM_r.size();
+
+      // --------------------------------------------------- Assemble D
+      for (int i = 0; i < countDr;) {
+        int nodeid = colD_r[i];
+        int size   = colD_r[i + 1];
+        i += 2;
+
+        // find whether I am owner of this node
+        if (NodePID(nodeid) == lcomm_->getRank()) {
+          // get the node
+          Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = GetNodeView(nodeid);
+
+          if (snode == Teuchos::null) {
+            std::stringstream oss;
+            oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+                << "***ERR*** Cannot find view of node " << nodeid << std::endl
+                << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+            throw MoertelT::ReportError(oss);
+          }
 
-          // find whether I am owner of this node
-          if (NodePID(nodeid) == lcomm_->getRank()) {
-            // get the node
-            Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = GetNodeView(nodeid);
+          // get lagrange multipliers
+          int        nslmdof = snode->Nlmdof();
+          int const* slmdof  = snode->LMDof();
 
-            if (snode == Teuchos::null) {
+          // loop colD_r/valD_r and assemble
+          for (int j = 0; j < size; ++j) {
+            int    colsnode = colD_r[i + j];
+            double val      = valD_r[i + j];
+
+            if (abs(val) < CONSTRAINT_MATRIX_ZERO) continue;
+
+            // get view of column node and primal dofs
+            Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> colnode = GetNodeView(colsnode);
+
+            if (colnode == Teuchos::null) {
               std::stringstream oss;
               oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                  << "***ERR*** Cannot find view of node " << nodeid << std::endl
+                  << "***ERR*** Cannot find view of node " << colsnode << std::endl
                   << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
               throw MoertelT::ReportError(oss);
             }
 
-            // get lagrange multipliers
-            int        nslmdof = snode->Nlmdof();
-            int const* slmdof  = snode->LMDof();
+            int        nsdof = colnode->Ndof();
+            int const* sdof  = colnode->Dof();
 
-            // loop colD_r/valD_r and assemble
-            for (int j = 0; j < size; ++j) {
-              int    colsnode = colD_r[i + j];
-              double val      = valD_r[i + j];
+            if (nsdof != nslmdof) {
+              std::stringstream oss;
+              oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+                  << "***ERR*** Mismatch in # primal dofs and Lagrange "
+                     "multipliers\n"
+                  << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+              throw MoertelT::ReportError(oss);
+            }
 
-              if (abs(val) < CONSTRAINT_MATRIX_ZERO) continue;
+            for (int k = 0; k < nslmdof; ++k) {
+              int row = slmdof[k];
+              GO  col = sdof[k];
+              // std::cout << "Proc " << lComm()->MyPID() << " inserting D
+              // row/col:" << row << "/" << col << " val " << val <<
+              // std::endl;
+              int err = D.sumIntoGlobalValues(row, 1, &val, &col);
 
-              // get view of column node and primal dofs
-              Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> colnode = GetNodeView(colsnode);
+              if (err) D.insertGlobalValues(row, 1, &val, &col);
 
-              if (colnode == Teuchos::null) {
+              if (err < 0) {
                 std::stringstream oss;
                 oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                    << "***ERR*** Cannot find view of node " << colsnode << std::endl
+                    << "***ERR*** Serious error=" << err << " in assembly\n"
                     << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
                 throw MoertelT::ReportError(oss);
               }
 
-              int        nsdof = colnode->Ndof();
-              int const* sdof  = colnode->Dof();
-
-              if (nsdof != nslmdof) {
-                std::stringstream oss;
-                oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                    << "***ERR*** Mismatch in # primal dofs and Lagrange "
-                       "multipliers\n"
-                    << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                throw MoertelT::ReportError(oss);
+              if (err && OutLevel() > 0) {
+                std::cout << "MoertelT: ***WRN*** "
+                             "MoertelT::InterfaceT::Assemble_3D:\n"
+                          << "MoertelT: ***WRN*** interface " << Id() << ": Tpetra_CrsMatrix::InsertGlobalValues returned " << err << "\n"
+                          << "MoertelT: ***WRN*** indicating that initial guess "
+                             "for memory of D too small\n"
+                          << "MoertelT: ***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
               }
+            }  // for (int k=0; k<nslmdof; ++k)
+          }    // for (int j=0; j<size; ++j)
 
-              for (int k = 0; k < nslmdof; ++k) {
-                int row = slmdof[k];
-                GO  col = sdof[k];
-                // std::cout << "Proc " << lComm()->MyPID() << " inserting D
-                // row/col:" << row << "/" << col << " val " << val <<
-                // std::endl;
-                int err = D.sumIntoGlobalValues(row, 1, &val, &col);
-
-                if (err) D.insertGlobalValues(row, 1, &val, &col);
-
-                if (err < 0) {
-                  std::stringstream oss;
-                  oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                      << "***ERR*** Serious error=" << err << " in assembly\n"
-                      << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                  throw MoertelT::ReportError(oss);
-                }
-
-                if (err && OutLevel() > 0) {
-                  std::cout << "MoertelT: ***WRN*** "
-                               "MoertelT::InterfaceT::Assemble_3D:\n"
-                            << "MoertelT: ***WRN*** interface " << Id() << ": Tpetra_CrsMatrix::InsertGlobalValues returned " << err << "\n"
-                            << "MoertelT: ***WRN*** indicating that initial guess "
-                               "for memory of D too small\n"
-                            << "MoertelT: ***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                }
-              }  // for (int k=0; k<nslmdof; ++k)
-            }    // for (int j=0; j<size; ++j)
+          i += size;
+        }
 
-            i += size;
+        else  // I am not owner of this node, skip it
+          i += size;
+      }  // for (int i=0; i<countDr;)
+
+      // --------------------------------------------------- Assemble M
+      for (int i = 0; i < countMr;) {
+        int nodeid = colM_r[i];
+        int size   = colM_r[i + 1];
+        i += 2;
+
+        // find whether I am owner of this node
+        if (NodePID(nodeid) == lcomm_->getRank()) {
+          // get the node
+          Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = GetNodeView(nodeid);
+
+          if (snode == Teuchos::null) {
+            std::stringstream oss;
+            oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+                << "***ERR*** Cannot find view of node " << nodeid << std::endl
+                << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+            throw MoertelT::ReportError(oss);
           }
 
-          else  // I am not owner of this node, skip it
-            i += size;
-        }  // for (int i=0; i<countDr;)
+          // get the lagrange multipliers
+          int        nslmdof = snode->Nlmdof();
+          int const* slmdof  = snode->LMDof();
 
-        // --------------------------------------------------- Assemble M
-        for (int i = 0; i < countMr;) {
-          int nodeid = colM_r[i];
-          int size   = colM_r[i + 1];
-          i += 2;
+          // loop colM_r/valM_r and assemble
+          for (int j = 0; j < size; ++j) {
+            int    colmnode = colM_r[i + j];
+            double val      = valM_r[i + j];
 
-          // find whether I am owner of this node
-          if (NodePID(nodeid) == lcomm_->getRank()) {
-            // get the node
-            Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = GetNodeView(nodeid);
+            if (abs(val) < CONSTRAINT_MATRIX_ZERO) continue;
 
-            if (snode == Teuchos::null) {
+            // get view of column node and primal dofs
+            Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> colnode = GetNodeView(colmnode);
+
+            if (colnode == Teuchos::null) {
               std::stringstream oss;
               oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                  << "***ERR*** Cannot find view of node " << nodeid << std::endl
+                  << "***ERR*** Cannot find view of node " << colmnode << std::endl
                   << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
               throw MoertelT::ReportError(oss);
             }
 
-            // get the lagrange multipliers
-            int        nslmdof = snode->Nlmdof();
-            int const* slmdof  = snode->LMDof();
+            int        nmdof = colnode->Ndof();
+            int const* mdof  = colnode->Dof();
 
-            // loop colM_r/valM_r and assemble
-            for (int j = 0; j < size; ++j) {
-              int    colmnode = colM_r[i + j];
-              double val      = valM_r[i + j];
+            if (nmdof != nslmdof) {
+              std::stringstream oss;
+              oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
+                  << "***ERR*** Mismatch in # primal dofs and Lagrange "
+                     "multipliers\n"
+                  << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+              throw MoertelT::ReportError(oss);
+            }
 
-              if (abs(val) < CONSTRAINT_MATRIX_ZERO) continue;
+            for (int k = 0; k < nslmdof; ++k) {
+              int row = slmdof[k];
+              GO  col = mdof[k];
+              // std::cout << "Proc " << lComm()->MyPID() << " inserting M
+              // row/col:" << row << "/" << col << " val " << val <<
+              // std::endl;
+              int err = M.sumIntoGlobalValues(row, 1, &val, &col);
 
-              // get view of column node and primal dofs
-              Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> colnode = GetNodeView(colmnode);
+              if (err) M.insertGlobalValues(row, 1, &val, &col);
 
-              if (colnode == Teuchos::null) {
+              if (err < 0) {
                 std::stringstream oss;
                 oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                    << "***ERR*** Cannot find view of node " << colmnode << std::endl
+                    << "***ERR*** Serious error=" << err << " in assembly\n"
                     << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
                 throw MoertelT::ReportError(oss);
               }
 
-              int        nmdof = colnode->Ndof();
-              int const* mdof  = colnode->Dof();
-
-              if (nmdof != nslmdof) {
-                std::stringstream oss;
-                oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                    << "***ERR*** Mismatch in # primal dofs and Lagrange "
-                       "multipliers\n"
-                    << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                throw MoertelT::ReportError(oss);
+              if (err && OutLevel() > 0) {
+                std::cout << "MoertelT: ***WRN*** "
+                             "MoertelT::InterfaceT::Assemble_3D:\n"
+                          << "MoertelT: ***WRN*** interface " << Id() << ": Tpetra_CrsMatrix::InsertGlobalValues returned " << err << "\n"
+                          << "MoertelT: ***WRN*** indicating that initial guess "
+                             "for memory of M too small\n"
+                          << "MoertelT: ***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
               }
+            }  // for (int k=0; k<nslmdof; ++k)
+          }    // for (int j=0; j<size; ++j)
 
-              for (int k = 0; k < nslmdof; ++k) {
-                int row = slmdof[k];
-                GO  col = mdof[k];
-                // std::cout << "Proc " << lComm()->MyPID() << " inserting M
-                // row/col:" << row << "/" << col << " val " << val <<
-                // std::endl;
-                int err = M.sumIntoGlobalValues(row, 1, &val, &col);
-
-                if (err) M.insertGlobalValues(row, 1, &val, &col);
-
-                if (err < 0) {
-                  std::stringstream oss;
-                  oss << "***ERR*** MoertelT::InterfaceT::Assemble_3D:\n"
-                      << "***ERR*** Serious error=" << err << " in assembly\n"
-                      << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                  throw MoertelT::ReportError(oss);
-                }
-
-                if (err && OutLevel() > 0) {
-                  std::cout << "MoertelT: ***WRN*** "
-                               "MoertelT::InterfaceT::Assemble_3D:\n"
-                            << "MoertelT: ***WRN*** interface " << Id() << ": Tpetra_CrsMatrix::InsertGlobalValues returned " << err << "\n"
-                            << "MoertelT: ***WRN*** indicating that initial guess "
-                               "for memory of M too small\n"
-                            << "MoertelT: ***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
-                }
-              }  // for (int k=0; k<nslmdof; ++k)
-            }    // for (int j=0; j<size; ++j)
-
-            i += size;
-          }
-
-          else  // I am not owner of this node, skip it
-            i += size;
-        }  // for (int i=0; i<countMr;)
-      }    // if (proc!=lComm()->MyPID())
-
-      colD_r.clear();
-      valD_r.clear();
-      colM_r.clear();
-      valM_r.clear();
-    }  // for (int proc=0; proc<lComm()->NumProc(); ++proc)
+          i += size;
+        }
 
-    colD_s.clear();
-    valD_s.clear();
-    colM_s.clear();
-    valM_s.clear();
+        else  // I am not owner of this node, skip it
+          i += size;
+      }  // for (int i=0; i<countMr;)
+    }  // for (std::size_t p=0; p<exchange_recvprocs_.size(); ++p)
   }  // if (lComm()->NumProc()!=1)
 
   return true;
@@ -22,6 +22,7 @@
 #include "Thyra_DefaultProductVectorSpace.hpp"
 #include "Thyra_MultiVectorStdOps.hpp"
 #include "Thyra_VectorStdOps.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #if defined(ALBANY_CHECK_FPE) || defined(ALBANY_STRONG_FPE_CHECK) || defined(ALBANY_FLUSH_DENORMALS)
 #include <xmmintrin.h>
@@ -97,6 +98,14 @@ main(int argc, char* argv[])
 
     report_timings = slvrfctry.getParameters().get("Enable TimeMonitor Output", false);
 
+    // Attribute the memory allocated from here on to the subsystems. The
+    // parameters are only read, so that they are not added to the input.
+    Teuchos::ParameterList const& params = slvrfctry.getParameters();
+    if (params.isSublist("Debug Output") && params.sublist("Debug Output").isParameter("Track Memory") &&
+        params.sublist("Debug Output").get<bool>("Track Memory")) {
+      Albany::MemoryTracker::instance().enable();
+    }
+
     RCP<Albany::Application>                             app;
     const RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solver = slvrfctry.createAndGetAlbanyApp(app, comm, comm);
 
@@ -280,6 +289,9 @@ main(int argc, char* argv[])
         Albany::writeMatrixMarket(xfinal->space(), "xfinal_distributed_map");
       }
     }
+
+    // The coupled drivers create their own applications
+    if (app != Teuchos::null && app->getEvaluatorTimings() != Teuchos::null) app->getEvaluatorTimings()->summarize(std::cout);
   }
   TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
   if (!success) status += 10000;
@@ -290,6 +302,7 @@ main(int argc, char* argv[])
     options.output_fraction = true;
     options.output_minmax   = true;
     stackedTimer->report(std::cout, Teuchos::DefaultComm<int>::getComm(), options);
+    util::PerformanceContext::instance().counterMonitor().summarize(Teuchos::DefaultComm<int>::getComm().ptr(), std::cout);
   }
 
   Kokkos::finalize();
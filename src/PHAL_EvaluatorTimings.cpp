@@ -0,0 +1,213 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "PHAL_EvaluatorTimings.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "Albany_Macros.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "utility/DisplayTable.hpp"
+
+namespace PHAL {
+
+namespace {
+
+std::string
+jsonString(std::string const& str)
+{
+  std::string json = "\"";
+  for (char const c : str) {
+    if (c == '"' || c == '\\') json += '\\';
+    json += c;
+  }
+  return json + "\"";
+}
+
+std::string
+seconds(double const time)
+{
+  std::ostringstream oss;
+  oss << std::scientific << std::setprecision(3) << time;
+  return oss.str();
+}
+
+std::string
+ratio(double const value)
+{
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2) << value;
+  return oss.str();
+}
+
+}  // anonymous namespace
+
+EvaluatorTimings::EvaluatorTimings(Teuchos::RCP<Teuchos_Comm const> const& comm, std::string const& trace_file) : comm_(comm)
+{
+  if (comm_->getRank() == 0 && trace_file.empty() == false) {
+    trace_.open(trace_file.c_str());
+    ALBANY_PANIC(!trace_.is_open(), "Error in PHAL::EvaluatorTimings: unable to open the trace file " << trace_file << ".\n");
+    trace_ << "[";
+    for (int rank = 0; rank < comm_->getSize(); ++rank) {
+      writeTraceEvent(
+          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(rank) + ",\"args\":{\"name\":\"Process " + std::to_string(rank) + "\"}}");
+    }
+  }
+}
+
+EvaluatorTimings::~EvaluatorTimings()
+{
+  if (trace_.is_open()) trace_ << "\n]\n";
+}
+
+std::vector<double>
+EvaluatorTimings::localTimes() const
+{
+  std::vector<double> times(timers_.size());
+  for (std::size_t i = 0; i < timers_.size(); ++i) times[i] = timers_[i].node->executionTime().count();
+  return times;
+}
+
+std::vector<double>
+EvaluatorTimings::gatherTimes(std::vector<double> const& local) const
+{
+  checkTimers();
+  int const           num_timers = timers_.size();
+  std::vector<double> all(comm_->getRank() == 0 ? num_timers * comm_->getSize() : 1);
+  Teuchos::gather(local.data(), num_timers, all.data(), num_timers, 0, *comm_);
+  return all;
+}
+
+void
+EvaluatorTimings::checkTimers() const
+{
+  int const local_count = timers_.size();
+  int       min_count, max_count;
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MIN, 1, &local_count, &min_count);
+  Teuchos::reduceAll(*comm_, Teuchos::REDUCE_MAX, 1, &local_count, &max_count);
+  ALBANY_PANIC(
+      min_count != max_count,
+      "Error in PHAL::EvaluatorTimings: the processes time different numbers of evaluators (" << min_count << " to " << max_count << ").\n");
+}
+
+void
+EvaluatorTimings::writeTraceEvent(std::string const& event)
+{
+  trace_ << (first_event_ ? "\n" : ",\n") << event;
+  first_event_ = false;
+}
+
+void
+EvaluatorTimings::recordStep(double const time)
+{
+  std::vector<double> const local = localTimes();
+  std::vector<double>       elapsed(local.size());
+  for (std::size_t i = 0; i < local.size(); ++i) elapsed[i] = local[i] - last_times_[i];
+  last_times_ = local;
+
+  std::vector<double> const all       = gatherTimes(elapsed);
+  int const                 num_steps = step_++;
+
+  if (trace_.is_open() == false) return;
+
+  // Every process starts the step at the same time in the trace, and the
+  // evaluators of a track follow each other in evaluation order. The
+  // longest process sets the length of the step.
+  int const num_timers = timers_.size();
+  int const num_ranks  = comm_->getSize();
+
+  std::vector<int> tracks(num_timers);
+  for (int i = 0; i < num_timers; ++i) {
+    std::string const key = timers_[i].eval_type + " " + timers_[i].block;
+    auto              it  = trace_tracks_.find(key);
+    if (it == trace_tracks_.end()) {
+      int const track = trace_tracks_.size() + 1;
+      it              = trace_tracks_.insert(std::make_pair(key, track)).first;
+      for (int rank = 0; rank < num_ranks; ++rank) {
+        writeTraceEvent(
+            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + std::to_string(rank) + ",\"tid\":" + std::to_string(track) +
+            ",\"args\":{\"name\":" + jsonString(key) + "}}");
+      }
+    }
+    tracks[i] = it->second;
+  }
+
+  double step_length = 0.0;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    std::map<int, double> clocks;
+    double                rank_total = 0.0;
+    for (int i = 0; i < num_timers; ++i) {
+      double const duration = 1.0e+6 * all[rank * num_timers + i];
+      double&      clock    = clocks[tracks[i]];
+      if (duration > 0.0) {
+        writeTraceEvent(
+            "{\"name\":" + jsonString(timers_[i].name) + ",\"cat\":" + jsonString(timers_[i].eval_type) + ",\"ph\":\"X\",\"pid\":" + std::to_string(rank) +
+            ",\"tid\":" + std::to_string(tracks[i]) + ",\"ts\":" + std::to_string(trace_clock_ + clock) + ",\"dur\":" + std::to_string(duration) + "}");
+      }
+      clock += duration;
+      rank_total += duration;
+    }
+    writeTraceEvent(
+        "{\"name\":\"Step " + std::to_string(num_steps) + "\",\"ph\":\"X\",\"pid\":" + std::to_string(rank) + ",\"tid\":0,\"ts\":" +
+        std::to_string(trace_clock_) + ",\"dur\":" + std::to_string(rank_total) + ",\"args\":{\"time\":" + std::to_string(time) + "}}");
+    for (auto const& clock : clocks) step_length = std::max(step_length, clock.second);
+  }
+  trace_clock_ += step_length;
+  trace_.flush();
+}
+
+void
+EvaluatorTimings::summarize(std::ostream& out)
+{
+  std::vector<double> const local = localTimes();
+  std::vector<double>       total(local.size());
+  for (std::size_t i = 0; i < local.size(); ++i) total[i] = local[i] - start_times_[i];
+
+  std::vector<double> const all = gatherTimes(total);
+  if (comm_->getRank() != 0) return;
+
+  int const num_timers = timers_.size();
+  int const num_ranks  = comm_->getSize();
+
+  struct Row
+  {
+    int    timer;
+    double min;
+    double mean;
+    double max;
+    int    max_rank;
+  };
+  std::vector<Row> rows;
+  for (int i = 0; i < num_timers; ++i) {
+    Row row{i, 0.0, 0.0, 0.0, 0};
+    for (int rank = 0; rank < num_ranks; ++rank) {
+      double const time = all[rank * num_timers + i];
+      if (rank == 0 || time < row.min) row.min = time;
+      if (rank == 0 || time > row.max) {
+        row.max      = time;
+        row.max_rank = rank;
+      }
+      row.mean += time / num_ranks;
+    }
+    rows.push_back(row);
+  }
+
+  // The evaluators that limit the throughput first
+  std::sort(rows.begin(), rows.end(), [](Row const& a, Row const& b) { return a.max > b.max; });
+
+  util::DisplayTable table;
+  table.addRow("Evaluation", "Block", "Evaluator", "Min (s)", "Mean (s)", "Max (s)", "Max process", "Imbalance");
+  for (auto const& row : rows) {
+    Timer const&      timer     = timers_[row.timer];
+    std::string const imbalance = row.mean > 0.0 ? ratio(row.max / row.mean) : "-";
+    table.addRow(timer.eval_type, timer.block, timer.name, seconds(row.min), seconds(row.mean), seconds(row.max), row.max_rank, imbalance);
+  }
+
+  out << "\nEvaluator timings over " << num_ranks << " processes and " << step_ << " steps\n";
+  table.write(out);
+}
+
+}  // namespace PHAL
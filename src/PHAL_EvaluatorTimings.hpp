@@ -0,0 +1,115 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef PHAL_EVALUATOR_TIMINGS_HPP
+#define PHAL_EVALUATOR_TIMINGS_HPP
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Albany_CommTypes.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace PHAL {
+
+//! Times of the evaluators of the field managers of an application,
+//! compared across processes.
+//!
+//! Phalanx accumulates the time spent in evaluateFields by every evaluator
+//! of a field manager. The times of the field managers registered here are
+//! sampled at every time step (recordStep) and written to a timeline in the
+//! Chrome trace event format (chrome://tracing or ui.perfetto.dev), with a
+//! track per process, evaluation type and element block. At the end of the
+//! run, summarize writes a table of the total time of every evaluator with
+//! the minimum, mean and maximum over the processes, the process with the
+//! maximum, and the imbalance max / mean.
+//!
+//! The times are host times: Phalanx times the evaluateFields calls and
+//! does not fence, so with a device execution space the time of a kernel
+//! goes to the evaluator that waits for it, which need not be the one that
+//! launched it.
+class EvaluatorTimings
+{
+ public:
+  //! No trace is written if trace_file is empty
+  EvaluatorTimings(Teuchos::RCP<Teuchos_Comm const> const& comm, std::string const& trace_file);
+
+  ~EvaluatorTimings();
+
+  //! Time the evaluators of fm for EvalT. Call after postRegistrationSetup,
+  //! in the same order on all processes.
+  template <typename EvalT>
+  void
+  addFieldManager(PHX::FieldManager<AlbanyTraits> const& fm, std::string const& block);
+
+  //! Add the times since the previous step to the trace. Collective.
+  void
+  recordStep(double const time);
+
+  //! Write the table of the total times. Collective.
+  void
+  summarize(std::ostream& out);
+
+ private:
+  struct Timer
+  {
+    std::string                       eval_type;
+    std::string                       block;
+    std::string                       name;
+    PHX::DagNode<AlbanyTraits> const* node;
+  };
+
+  //! Times of all the timers on this process
+  std::vector<double>
+  localTimes() const;
+
+  //! Values of all the timers on all the processes, on process 0
+  std::vector<double>
+  gatherTimes(std::vector<double> const& local) const;
+
+  void
+  checkTimers() const;
+
+  void
+  writeTraceEvent(std::string const& event);
+
+  Teuchos::RCP<Teuchos_Comm const> comm_;
+
+  std::vector<Timer>  timers_;
+  std::vector<double> start_times_;  // when the timer was added, on this process
+  std::vector<double> last_times_;   // at the previous step, on this process
+
+  std::ofstream              trace_;
+  std::map<std::string, int> trace_tracks_;      // evaluation type and block -> track
+  double                     trace_clock_{0.0};  // start of the next step in the trace [us]
+  int                        step_{0};
+  bool                       first_event_{true};
+};
+
+template <typename EvalT>
+void
+EvaluatorTimings::addFieldManager(PHX::FieldManager<AlbanyTraits> const& fm, std::string const& block)
+{
+  std::string eval_type = PHX::print<EvalT>();
+  eval_type.erase(eval_type.begin());
+  eval_type.pop_back();
+
+  // Evaluation order, so that the trace reads like the evaluation
+  auto const& dag = fm.getDagManager<EvalT>();
+  for (int const index : dag.getEvaluatorInternalOrdering()) {
+    auto const& node = dag.getDagNodes()[index];
+    timers_.push_back({eval_type, block, node.get()->getName(), &node});
+    start_times_.push_back(node.executionTime().count());
+    last_times_.push_back(node.executionTime().count());
+  }
+}
+
+}  // namespace PHAL
+
+#endif  // PHAL_EVALUATOR_TIMINGS_HPP
@@ -8,6 +8,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "Albany_DiscretizationUtils.hpp"
 #include "Albany_SacadoTypes.hpp"
@@ -35,6 +36,28 @@ class Topology;
 
 namespace PHAL {
 
+//! Local DOFs fixed by Dirichlet conditions, recorded to avoid setting
+//! Schwarz conditions on them. A bitmap over the local DOFs.
+class FixedDofs
+{
+ public:
+  void
+  insert(int const dof)
+  {
+    if (dof >= static_cast<int>(fixed_.size())) fixed_.resize(dof + 1, false);
+    fixed_[dof] = true;
+  }
+
+  bool
+  contains(int const dof) const
+  {
+    return dof < static_cast<int>(fixed_.size()) && fixed_[dof];
+  }
+
+ private:
+  std::vector<bool> fixed_;
+};
+
 struct Workset
 {
   Workset() {}
@@ -105,6 +128,7 @@ struct Workset
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::WorksetConn                           wsElNodeEqID;
+  Albany::WorksetColoring                       wsElColoring;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>      wsElNodeID;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>> wsCoords;
   Teuchos::ArrayRCP<double>                     wsSphereVolume;
@@ -122,9 +146,13 @@ struct Workset
   Teuchos::ArrayRCP<double*>                           face_boundary_indicator;
   Teuchos::ArrayRCP<double*>                           edge_boundary_indicator;
   std::map<GO, double*>                                node_boundary_indicator;
-  std::set<int>                                        fixed_dofs_;
+  FixedDofs                                            fixed_dofs_;
   bool                                                 is_schwarz_bc_{false};
 
+  // Owned DOFs with strong Dirichlet conditions in a Jacobian fill, marked
+  // by the SDBC evaluators. See PHAL::applySDBCs.
+  Teuchos::RCP<Thyra_Vector> sdbc_dofs;
+
   // Needed for ACE erosion
   Teuchos::RCP<LCM::Topology> topology{Teuchos::null};
 
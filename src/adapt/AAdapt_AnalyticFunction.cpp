@@ -7,7 +7,6 @@
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
-#include <stk_expreval/Evaluator.hpp>
 
 #include "Albany_Macros.hpp"
 
@@ -647,23 +646,16 @@ AAdapt::AcousticWave::compute(double* x, double const* X)
   for (int i = 1; i < numDim; i++) x[i] = 0.0;
 }
 
-AAdapt::ExpressionParser::ExpressionParser(int neq_, int dim_, Teuchos::Array<std::string>& expr_) : dim(dim_), neq(neq_), expr(expr_)
+AAdapt::ExpressionParser::ExpressionParser(int neq_, int dim_, Teuchos::Array<std::string>& expr_) : dim(dim_), neq(neq_)
 {
-  ALBANY_ASSERT(expr.size() == neq, "Must have the same number of equations (" << neq << ") and expressions (" << expr.size() << ").");
+  ALBANY_ASSERT(expr_.size() == neq, "Must have the same number of equations (" << neq << ") and expressions (" << expr_.size() << ").");
+  for (auto const& expr_str : expr_) expr.emplace_back(expr_str);
 }
 
 void
 AAdapt::ExpressionParser::compute(double* unknowns, double const* coords)
 {
-  std::vector<std::string> coord_str{"x", "y", "z"};
-  double*                  X = const_cast<double*>(coords);
   for (auto eq = 0; eq < neq; ++eq) {
-    auto const&         expr_str = expr[eq];
-    stk::expreval::Eval expr_eval(expr_str);
-    expr_eval.parse();
-    for (auto i = 0; i < dim; ++i) {
-      expr_eval.bindVariable(coord_str[i], X[i]);
-    }
-    unknowns[eq] = expr_eval.evaluate();
+    unknowns[eq] = expr[eq].evaluate(coords, dim, 0.0);
   }
 }
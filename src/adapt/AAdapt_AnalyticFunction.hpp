@@ -15,6 +15,7 @@
 #include <boost/random/normal_distribution.hpp>
 #include <boost/random/variate_generator.hpp>
 
+#include "Albany_Expression.hpp"
 #include "Teuchos_Array.hpp"
 #if defined(ALBANY_PAMGEN)
 #include "RTC_FunctionRTC.hh"
@@ -358,9 +359,9 @@ class ExpressionParser : public AnalyticFunction
   compute(double* unknowns, double const* coords);
 
  private:
-  int                         dim;  // size of coordinate vector X
-  int                         neq;  // size of solution vector x
-  Teuchos::Array<std::string> expr;
+  int                             dim;  // size of coordinate vector X
+  int                             neq;  // size of solution vector x
+  std::vector<Albany::Expression> expr;
 };
 
 }  // namespace AAdapt
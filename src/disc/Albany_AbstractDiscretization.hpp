@@ -102,6 +102,10 @@ class AbstractDiscretization
   virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>>::type&
   getWsElNodeID() const = 0;
 
+  //! Get element coloring per workset (elements of one color share no nodes)
+  virtual const Coloring&
+  getWsElColoring() const = 0;
+
   //! Get IDArray for (Ws, Local Node, nComps) -> (local) NodeLID, works for
   //! both scalar and vector fields
   virtual std::vector<IDArray> const&
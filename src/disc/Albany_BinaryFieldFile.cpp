@@ -0,0 +1,162 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_BinaryFieldFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_Macros.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Teuchos_Comm.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+namespace Albany {
+
+namespace {
+
+char const magic[8] = {'A', 'L', 'B', 'F', 'I', 'E', 'L', 'D'};
+
+std::streamoff const header_size = sizeof(magic) + 3 * sizeof(std::int64_t);
+
+}  // anonymous namespace
+
+bool
+isBinaryFieldFile(std::string const& fname)
+{
+  std::ifstream ifile(fname.c_str(), std::ios::binary);
+  char          head[sizeof(magic)];
+  ifile.read(head, sizeof(magic));
+  return ifile.good() && std::memcmp(head, magic, sizeof(magic)) == 0;
+}
+
+void
+writeBinaryFieldFile(
+    std::string const&                  fname,
+    const Teuchos::ArrayView<const GO>& gids,
+    int const                           num_columns,
+    const Teuchos::ArrayView<const ST>& values,
+    std::vector<double> const&          layers_coords)
+{
+  ALBANY_PANIC(
+      values.size() != gids.size() * num_columns,
+      "Error in writeBinaryFieldFile: " << values.size() << " values given for " << gids.size() << " entities and " << num_columns << " columns.\n");
+
+  std::ofstream ofile(fname.c_str(), std::ios::binary);
+  ALBANY_PANIC(!ofile.is_open(), "Error in writeBinaryFieldFile: unable to open the file " << fname << ".\n");
+
+  std::int64_t const sizes[3] = {gids.size(), num_columns, static_cast<std::int64_t>(layers_coords.size())};
+  ofile.write(magic, sizeof(magic));
+  ofile.write(reinterpret_cast<char const*>(sizes), sizeof(sizes));
+  ofile.write(reinterpret_cast<char const*>(layers_coords.data()), layers_coords.size() * sizeof(double));
+  for (GO const gid : gids) {
+    std::int64_t const id = gid;
+    ofile.write(reinterpret_cast<char const*>(&id), sizeof(id));
+  }
+  ofile.write(reinterpret_cast<char const*>(values.getRawPtr()), values.size() * sizeof(ST));
+  ALBANY_PANIC(!ofile.good(), "Error in writeBinaryFieldFile: unable to write the file " << fname << ".\n");
+}
+
+BinaryFieldFileChunk
+readBinaryFieldFile(std::string const& fname, const Teuchos::RCP<Teuchos_Comm const>& comm)
+{
+  std::ifstream ifile(fname.c_str(), std::ios::binary);
+  ALBANY_PANIC(!ifile.is_open(), "Error in readBinaryFieldFile: unable to open the file " << fname << ".\n");
+
+  char         head[sizeof(magic)];
+  std::int64_t sizes[3];
+  ifile.read(head, sizeof(magic));
+  ifile.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+  ALBANY_PANIC(!ifile.good() || std::memcmp(head, magic, sizeof(magic)) != 0, "Error in readBinaryFieldFile: " << fname << " is not a binary field file.\n");
+
+  BinaryFieldFileChunk chunk;
+  chunk.num_entities  = sizes[0];
+  chunk.num_columns   = sizes[1];
+  GO const num_layers = sizes[2];
+  ALBANY_PANIC(
+      chunk.num_entities < 0 || chunk.num_columns <= 0 || num_layers < 0,
+      "Error in readBinaryFieldFile: invalid sizes in the header of " << fname << ".\n");
+
+  // Check the size of the file, so that a truncated file is not silently
+  // read as zeros by the processes reading its end
+  std::streamoff const gids_begin   = header_size + num_layers * sizeof(double);
+  std::streamoff const values_begin = gids_begin + chunk.num_entities * sizeof(std::int64_t);
+  std::streamoff const file_size    = values_begin + chunk.num_entities * chunk.num_columns * sizeof(ST);
+  ifile.seekg(0, std::ios::end);
+  ALBANY_PANIC(
+      ifile.tellg() != file_size,
+      "Error in readBinaryFieldFile: the size of " << fname << " (" << ifile.tellg() << " bytes) is different from the size expected from its header ("
+                                                   << file_size << " bytes).\n");
+
+  chunk.layers_coords.resize(num_layers);
+  ifile.seekg(header_size);
+  ifile.read(reinterpret_cast<char*>(chunk.layers_coords.data()), num_layers * sizeof(double));
+
+  GO const first = chunk.num_entities * comm->getRank() / comm->getSize();
+  GO const last  = chunk.num_entities * (comm->getRank() + 1) / comm->getSize();
+  GO const count = last - first;
+
+  std::vector<std::int64_t> ids(count);
+  ifile.seekg(gids_begin + first * sizeof(std::int64_t));
+  ifile.read(reinterpret_cast<char*>(ids.data()), count * sizeof(std::int64_t));
+  chunk.gids.assign(ids.begin(), ids.end());
+
+  chunk.values.resize(count * chunk.num_columns);
+  for (int col = 0; col < chunk.num_columns; ++col) {
+    ifile.seekg(values_begin + (col * chunk.num_entities + first) * sizeof(ST));
+    ifile.read(reinterpret_cast<char*>(chunk.values.getRawPtr() + col * count), count * sizeof(ST));
+  }
+  ALBANY_PANIC(!ifile.good(), "Error in readBinaryFieldFile: unable to read the file " << fname << ".\n");
+
+  return chunk;
+}
+
+Teuchos::RCP<Thyra_MultiVector>
+loadBinaryFieldFile(
+    std::string const&                           fname,
+    Teuchos::RCP<Thyra_VectorSpace const> const& vs,
+    const Teuchos::RCP<Teuchos_Comm const>&      comm,
+    std::vector<double>&                         layers_coords)
+{
+  BinaryFieldFileChunk chunk = readBinaryFieldFile(fname, comm);
+  layers_coords              = chunk.layers_coords;
+
+  auto     file_vs   = createVectorSpace(comm, chunk.gids());
+  auto     file_mvec = Thyra::createMembers(file_vs, chunk.num_columns);
+  auto     file_data = getNonconstLocalData(file_mvec);
+  LO const count     = chunk.gids.size();
+  for (int col = 0; col < chunk.num_columns; ++col) {
+    std::copy_n(chunk.values.begin() + col * count, count, file_data[col].begin());
+  }
+
+  // As for the ascii files, the file must hold as many entities as the
+  // mesh, and every entity of the mesh must get a value. Together, these
+  // make the file GIDs exactly the mesh GIDs, each once.
+  GO const num_mesh_entities = createOneToOneVectorSpace(vs)->dim();
+  ALBANY_PANIC(
+      chunk.num_entities != num_mesh_entities,
+      "Error in loadBinaryFieldFile: Number of entities in file " << fname << " (" << chunk.num_entities << ") "
+                                                                  << "is different from the number expected (" << num_mesh_entities << ").\n");
+
+  auto const cas_manager = createCombineAndScatterManager(file_vs, vs);
+  auto const read        = Thyra::createMember(file_vs);
+  auto const covered     = Thyra::createMember(vs);
+  read->assign(1.0);
+  covered->assign(0.0);
+  cas_manager->scatter(*read, *covered, CombineMode::INSERT);
+  auto const covered_data  = getLocalData(covered.getConst());
+  GO const   local_missing = std::count(covered_data.begin(), covered_data.end(), 0.0);
+  GO         missing       = 0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, local_missing, Teuchos::outArg(missing));
+  ALBANY_PANIC(missing != 0, "Error in loadBinaryFieldFile: " << missing << " entities of the mesh have no value in file " << fname << ".\n");
+
+  auto mvec = Thyra::createMembers(vs, chunk.num_columns);
+  cas_manager->scatter(*file_mvec, *mvec, CombineMode::INSERT);
+  return mvec;
+}
+
+}  // namespace Albany
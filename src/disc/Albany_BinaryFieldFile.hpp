@@ -0,0 +1,77 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_BINARY_FIELD_FILE_HPP
+#define ALBANY_BINARY_FIELD_FILE_HPP
+
+#include <string>
+#include <vector>
+
+#include "Albany_CommTypes.hpp"
+#include "Albany_ScalarOrdinalTypes.hpp"
+#include "Albany_ThyraTypes.hpp"
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+// Binary field files are an alternative to the ascii field files loaded by
+// GenericSTKMeshStruct that can be read in parallel, each process reading
+// a contiguous part of the entities. The file holds, in native byte order:
+//
+//   char    magic[8]                       "ALBFIELD"
+//   int64   number of entities n
+//   int64   number of columns c
+//   int64   number of layers l             (0 if the field is not layered)
+//   double  normalized layers coordinates  [l]
+//   int64   entity GIDs                    [n]  (STK identifier - 1)
+//   double  values, one column at a time   [c][n]
+//
+// The columns are ordered like the columns of the field multivector: the
+// components of a vector field, the layers of a layered scalar field and,
+// for a layered vector field, the layers of a component before the next
+// component. Unlike in the ascii files, entities are identified by GID and
+// may come in any order.
+
+//! True if the file starts with the binary field file magic
+bool
+isBinaryFieldFile(std::string const& fname);
+
+//! Write a binary field file. values holds the columns one after the other.
+void
+writeBinaryFieldFile(
+    std::string const&                  fname,
+    const Teuchos::ArrayView<const GO>& gids,
+    int const                           num_columns,
+    const Teuchos::ArrayView<const ST>& values,
+    std::vector<double> const&          layers_coords = {});
+
+//! The part of a binary field file read by one process
+struct BinaryFieldFileChunk
+{
+  GO                  num_entities{0};  // in the whole file
+  int                 num_columns{0};
+  std::vector<double> layers_coords;
+  Teuchos::Array<GO>  gids;    // entities read by this process
+  Teuchos::Array<ST>  values;  // num_columns columns of gids.size() values
+};
+
+//! Every process reads a contiguous range of the entities in the file
+BinaryFieldFileChunk
+readBinaryFieldFile(std::string const& fname, const Teuchos::RCP<Teuchos_Comm const>& comm);
+
+//! Read a binary field file into a multivector over vs, with a single
+//! redistribution from the entities read by each process. Returns the
+//! normalized layers coordinates in layers_coords. The file must hold
+//! each entity of vs exactly once.
+Teuchos::RCP<Thyra_MultiVector>
+loadBinaryFieldFile(
+    std::string const&                           fname,
+    Teuchos::RCP<Thyra_VectorSpace const> const& vs,
+    const Teuchos::RCP<Teuchos_Comm const>&      comm,
+    std::vector<double>&                         layers_coords);
+
+}  // namespace Albany
+
+#endif  // ALBANY_BINARY_FIELD_FILE_HPP
@@ -0,0 +1,49 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_DiscretizationUtils.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace Albany {
+
+WorksetColoring
+colorElements(Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>> const& elNodeID)
+{
+  int const num_elems = elNodeID.size();
+
+  std::unordered_map<GO, std::vector<int>> node_colors;
+  std::vector<int>                         elem_color(num_elems, 0);
+  std::vector<char>                        forbidden;
+
+  int num_colors = 0;
+  for (int e = 0; e < num_elems; ++e) {
+    int const num_nodes = elNodeID[e].size();
+    forbidden.assign(num_colors + 1, 0);
+    for (int node = 0; node < num_nodes; ++node) {
+      for (int c : node_colors[elNodeID[e][node]]) forbidden[c] = 1;
+    }
+    int color = 0;
+    while (forbidden[color] != 0) ++color;
+    elem_color[e] = color;
+    num_colors    = std::max(num_colors, color + 1);
+    for (int node = 0; node < num_nodes; ++node) node_colors[elNodeID[e][node]].push_back(color);
+  }
+
+  // Group the elements by color (counting sort)
+  WorksetColoring coloring;
+  coloring.offsets.assign(num_colors + 1, 0);
+  for (int e = 0; e < num_elems; ++e) ++coloring.offsets[elem_color[e] + 1];
+  for (int c = 0; c < num_colors; ++c) coloring.offsets[c + 1] += coloring.offsets[c];
+
+  coloring.elements = Kokkos::View<int*, PHX::Device>("wsElColoring", num_elems);
+  auto             elements_h = Kokkos::create_mirror_view(coloring.elements);
+  std::vector<int> next(coloring.offsets.begin(), coloring.offsets.end() - 1);
+  for (int e = 0; e < num_elems; ++e) elements_h(next[elem_color[e]]++) = e;
+  Kokkos::deep_copy(coloring.elements, elements_h);
+  return coloring;
+}
+
+}  // namespace Albany
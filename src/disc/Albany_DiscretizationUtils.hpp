@@ -21,10 +21,11 @@ class Manager;
 
 namespace Albany {
 
-using NodeSetList      = std::map<std::string, std::vector<std::vector<int>>>;
-using NodeSetGIDsList  = std::map<std::string, std::vector<GO>>;
-using NodeSetCoordList = std::map<std::string, std::vector<double*>>;
-using NodeGID2LIDMap   = std::map<GO, LO>;
+using NodeSetList            = std::map<std::string, std::vector<std::vector<int>>>;
+using NodeSetGIDsList        = std::map<std::string, std::vector<GO>>;
+using NodeSetCoordList       = std::map<std::string, std::vector<double*>>;
+using NodeSetActiveNodesList = std::map<std::string, std::vector<int>>;
+using NodeGID2LIDMap         = std::map<GO, LO>;
 
 class SideStruct
 {
@@ -61,6 +62,28 @@ struct WorksetArray
 using WorksetConn = Kokkos::View<LO***, Kokkos::LayoutRight, PHX::Device>;
 using Conn        = WorksetArray<WorksetConn>::type;
 
+// Element coloring of a workset: elements of the same color share no nodes,
+// so they can be scattered concurrently without atomics. The (workset local)
+// elements of color k are elements(offsets[k]), ..., elements(offsets[k+1]-1).
+struct WorksetColoring
+{
+  Kokkos::View<int*, PHX::Device> elements;
+  std::vector<int>                offsets;
+
+  int
+  numColors() const
+  {
+    return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+  }
+};
+using Coloring = WorksetArray<WorksetColoring>::type;
+
+// Greedy distance-1 coloring of the element-node graph of a workset, given
+// the node GIDs of its elements: each element gets the smallest color not
+// yet used by an element sharing one of its nodes.
+WorksetColoring
+colorElements(Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>> const& elNodeID);
+
 }  // namespace Albany
 
 #endif  // ALBANY_DISCRETIZATION_UTILS_HPP
@@ -14,6 +14,7 @@
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/MeshBuilder.hpp>
 
+#include "Albany_BinaryFieldFile.hpp"
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_Gather.hpp"
 #include "Albany_KokkosTypes.hpp"
@@ -1022,7 +1023,8 @@ GenericSTKMeshStruct::loadRequiredInputFields(const AbstractFieldContainer::Fiel
 
   // Check whether we need the serial map or not. The only scenario where we DO
   // need it is if we are loading a field from an ASCII file. So let's check the
-  // fields info to see if that's the case.
+  // fields info to see if that's the case. Binary field files are read in
+  // parallel and do not need it.
   Teuchos::ParameterList  dummyList;
   Teuchos::ParameterList* req_fields_info;
   if (params->isSublist("Required Fields Info")) {
@@ -1043,7 +1045,7 @@ GenericSTKMeshStruct::loadRequiredInputFields(const AbstractFieldContainer::Fiel
     ftype  = fparams.get<std::string>("Field Type", "INVALID");
     if (fusage == "Input" || fusage == "Input-Output") {
       forigin = fparams.get<std::string>("Field Origin", "INVALID");
-      if (forigin == "File" && fparams.isParameter("File Name")) {
+      if (forigin == "File" && fparams.isParameter("File Name") && !isBinaryFieldFile(fparams.get<std::string>("File Name"))) {
         if (ftype.find("Node") != std::string::npos) {
           node_field_ascii_loads = true;
         } else if (ftype.find("Elem") != std::string::npos) {
@@ -1320,7 +1322,13 @@ GenericSTKMeshStruct::loadField(
   out->getOStream()->flush();
   // Read the input file and stuff it in the Tpetra multivector
 
-  if (scalar) {
+  // Binary files are read by all processes straight into the parallel vector
+  bool const binary = isBinaryFieldFile(fname);
+  if (binary) {
+    std::vector<double> dummy;
+    auto&               norm_layers_coords = layered ? fieldContainer->getMeshVectorStates()[field_name + "_NLC"] : dummy;
+    readFieldFileBinary(fname, field_mv, vs, scalar, layered, norm_layers_coords, comm);
+  } else if (scalar) {
     if (layered) {
       temp_str                 = field_name + "_NLC";
       auto& norm_layers_coords = fieldContainer->getMeshVectorStates()[temp_str];
@@ -1347,16 +1355,19 @@ GenericSTKMeshStruct::loadField(
   }
   *out << "done!\n";
 
+  // The multivector holding the values read
+  auto read_mvec = binary ? field_mv : serial_req_mvec;
+
   if (field_params.isParameter("Scale Factor")) {
     Teuchos::Array<double> scale_factors;
     if (field_params.isType<Teuchos::Array<double>>("Scale Factor")) {
       scale_factors = field_params.get<Teuchos::Array<double>>("Scale Factor");
       ALBANY_PANIC(
-          scale_factors.size() != static_cast<int>(serial_req_mvec->domain()->dim()),
+          scale_factors.size() != static_cast<int>(read_mvec->domain()->dim()),
           "Error! The given scale factors vector size does not match the field "
           "dimension.\n");
     } else if (field_params.isType<double>("Scale Factor")) {
-      scale_factors.resize(serial_req_mvec->domain()->dim());
+      scale_factors.resize(read_mvec->domain()->dim());
       std::fill_n(scale_factors.begin(), scale_factors.size(), field_params.get<double>("Scale Factor"));
     } else {
       ALBANY_ABORT(
@@ -1371,13 +1382,15 @@ GenericSTKMeshStruct::loadField(
     *out << "]\n";
 
     for (int i = 0; i < scale_factors.size(); ++i) {
-      serial_req_mvec->col(i)->scale(scale_factors[i]);
+      read_mvec->col(i)->scale(scale_factors[i]);
     }
   }
 
   // Fill the (possibly) parallel vector
-  field_mv = Thyra::createMembers(vs, serial_req_mvec->domain()->dim());
-  cas_manager.scatter(*serial_req_mvec, *field_mv, CombineMode::INSERT);
+  if (!binary) {
+    field_mv = Thyra::createMembers(vs, serial_req_mvec->domain()->dim());
+    cas_manager.scatter(*serial_req_mvec, *field_mv, CombineMode::INSERT);
+  }
 }
 
 void
@@ -1686,6 +1699,41 @@ GenericSTKMeshStruct::readLayeredVectorFileSerial(
   }
 }
 
+void
+GenericSTKMeshStruct::readFieldFileBinary(
+    std::string const&                           fname,
+    Teuchos::RCP<Thyra_MultiVector>&             mvec,
+    Teuchos::RCP<Thyra_VectorSpace const> const& vs,
+    bool                                         scalar,
+    bool                                         layered,
+    std::vector<double>&                         normalizedLayersCoords,
+    const Teuchos::RCP<Teuchos_Comm const>&      comm) const
+{
+  // Each process reads a contiguous range of the entities in the file, which
+  // are then redistributed once to the entities of the mesh
+  std::vector<double> layersCoords;
+  mvec = loadBinaryFieldFile(fname, vs, comm, layersCoords);
+
+  int const numColumns = mvec->domain()->dim();
+  int const numLayers  = layersCoords.size();
+  if (!layered) {
+    ALBANY_PANIC(numLayers != 0, "Error in GenericSTKMeshStruct: file " << fname << " holds a layered field, but the field is not layered.\n");
+    ALBANY_PANIC(scalar && numColumns != 1, "Error in GenericSTKMeshStruct: file " << fname << " holds " << numColumns << " components for a scalar field.\n");
+  } else {
+    ALBANY_PANIC(numLayers == 0, "Error in GenericSTKMeshStruct: file " << fname << " holds a field that is not layered.\n");
+    ALBANY_PANIC(
+        numColumns % numLayers != 0 || (scalar && numColumns != numLayers),
+        "Error in GenericSTKMeshStruct: file " << fname << " holds " << numColumns << " columns, which does not match its " << numLayers << " layers.\n");
+    ALBANY_PANIC(
+        scalar && static_cast<size_t>(numLayers) != normalizedLayersCoords.size(),
+        "Error in GenericSTKMeshStruct: Number of layers in file " << fname << " (" << numLayers << ") "
+                                                                   << "is different from the number expected (" << normalizedLayersCoords.size() << ")."
+                                                                   << " To fix this, please specify the correct layered data "
+                                                                      "dimension when you register the state.\n");
+    normalizedLayersCoords = layersCoords;
+  }
+}
+
 void
 GenericSTKMeshStruct::checkFieldIsInMesh(std::string const& fname, std::string const& ftype) const
 {
@@ -1818,6 +1866,7 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
       "Integration rule sent to Intrepid2: GAUSS, GAUSS_RADAU_LEFT, "
       "GAUSS_RADAU_RIGHT, GAUSS_LOBATTO");
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
+  validPL->sublist("Workset Size Autotune", false, "Choose the Workset Size by timing the fills at candidate sizes");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
   validPL->set<bool>("Separate Evaluators by Element Block", false, "Flag for different evaluation trees for each Element Block");
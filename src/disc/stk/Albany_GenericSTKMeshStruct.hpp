@@ -199,6 +199,17 @@ class GenericSTKMeshStruct : public AbstractSTKMeshStruct
       std::vector<double>&                         normalizedLayersCoords,
       const Teuchos::RCP<Teuchos_Comm const>&      comm) const;
 
+  // Reads a binary field file in parallel, see Albany_BinaryFieldFile.hpp
+  void
+  readFieldFileBinary(
+      std::string const&                           fname,
+      Teuchos::RCP<Thyra_MultiVector>&             contentVec,
+      Teuchos::RCP<Thyra_VectorSpace const> const& vs,
+      bool                                         scalar,
+      bool                                         layered,
+      std::vector<double>&                         normalizedLayersCoords,
+      const Teuchos::RCP<Teuchos_Comm const>&      comm) const;
+
   void
   checkFieldIsInMesh(std::string const& fname, std::string const& ftype) const;
 
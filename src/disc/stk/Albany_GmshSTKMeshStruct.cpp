@@ -4,9 +4,17 @@
 
 #include "Albany_GmshSTKMeshStruct.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <Albany_STKNodeSharing.hpp>
 #include <Shards_BasicTopologies.hpp>
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <stk_io/IossBridge.hpp>
 #include <stk_mesh/base/Entity.hpp>
@@ -14,7 +22,11 @@
 #include <stk_mesh/base/GetBuckets.hpp>
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/Selector.hpp>
+#include <stk_util/parallel/CommSparse.hpp>
+#include <unordered_map>
 
+#include "Albany_CommUtils.hpp"
+#include "Albany_Gather.hpp"
 #include "Albany_Macros.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_CommHelpers.hpp"
@@ -23,32 +35,38 @@
 Albany::GmshSTKMeshStruct::GmshSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params, const Teuchos::RCP<Teuchos_Comm const>& commT)
     : GenericSTKMeshStruct(params, Teuchos::null)
 {
-  fname = params->get("Gmsh Input Mesh File Name", "mesh.msh");
+  fname       = params->get("Gmsh Input Mesh File Name", "mesh.msh");
+  distributed = params->get("Gmsh Distributed Read", false) && commT->getSize() > 1;
 
   // Init counters to 0, pointers to null
   init_counters_to_zero();
   init_pointers_to_null();
 
-  // Reading the mesh on proc 0
-  if (commT->getRank() == 0) {
-    bool legacy = false;
-    bool binary = false;
-    bool ascii  = false;
-
-    determine_file_type(legacy, binary, ascii);
-
-    if (legacy) {
-      loadLegacyMesh();
-    } else if (binary) {
-      loadBinaryMesh();
-    } else if (ascii) {
-      loadAsciiMesh();
-    } else {
-      ALBANY_ABORT("Error! Mesh format not recognized.\n");
+  if (distributed) {
+    // Every proc reads its own part of the mesh
+    loadDistributedMesh(commT);
+  } else {
+    // Reading the mesh on proc 0
+    if (commT->getRank() == 0) {
+      bool legacy = false;
+      bool binary = false;
+      bool ascii  = false;
+
+      determine_file_type(legacy, binary, ascii);
+
+      if (legacy) {
+        loadLegacyMesh();
+      } else if (binary) {
+        loadBinaryMesh();
+      } else if (ascii) {
+        loadAsciiMesh();
+      } else {
+        ALBANY_ABORT("Error! Mesh format not recognized.\n");
+      }
     }
+    // Broadcasting topological information about the mesh to all procs
+    broadcast_topology(commT);
   }
-  // Broadcasting topological information about the mesh to all procs
-  broadcast_topology(commT);
   // Redundant for proc 0 but needed for all others processes
   set_version_enum_from_float();
 
@@ -274,8 +292,10 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
 
   bulkData->modification_begin();  // Begin modifying the mesh
 
-  // Only proc 0 has loaded the file
-  if (commT->getRank() == 0) {
+  if (distributed) {
+    declareDistributedMesh(commT);
+  } else if (commT->getRank() == 0) {
+    // Only proc 0 has loaded the file
     stk::mesh::PartVector singlePartVec(1);
     unsigned int          ebNo   = 0;  // element block #???
     int                   sideID = 0;
@@ -352,9 +372,9 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
   bulkData->modification_end();
 
 #if defined(ALBANY_ZOLTAN)
-  // Gmsh is for sure using a serial mesh. We hard code it here, in case the
-  // user did not set it
-  params->set<bool>("Use Serial Mesh", true);
+  // Unless read in parallel, Gmsh is for sure using a serial mesh. We hard
+  // code it here, in case the user did not set it
+  if (!distributed) params->set<bool>("Use Serial Mesh", true);
 
   // Refine the mesh before starting the simulation if indicated
   uniformRefineMesh(commT);
@@ -385,6 +405,11 @@ Albany::GmshSTKMeshStruct::getValidDiscretizationParameters() const
       "mesh.msh",
       "Name of the file containing the 2D mesh, with list of coordinates, "
       "elements' connectivity and boundary edges' connectivity");
+  validPL->set<bool>(
+      "Gmsh Distributed Read",
+      false,
+      "Read the mesh file on all processes, each one reading a part of the nodes and elements, instead of reading it on process 0 and "
+      "rebalancing");
 
   return validPL;
 }
@@ -725,6 +750,14 @@ Albany::GmshSTKMeshStruct::set_specific_num_of_each_elements(std::ifstream& ifil
     }
   }
 
+  check_element_types();
+
+  return;
+}
+
+void
+Albany::GmshSTKMeshStruct::check_element_types()
+{
   bool is_first_order  = (nb_lines != 0);
   bool is_second_order = (nb_line3 != 0);
 
@@ -1322,10 +1355,19 @@ Albany::GmshSTKMeshStruct::set_boundaries(const Teuchos::RCP<Teuchos_Comm const>
   set_all_nodes_boundary(nsNames);
   set_all_sides_boundary(ssNames);
 
-  // Counting boundaries (only proc 0 has any stored, so far)
+  // Counting boundaries (only proc 0 has any stored, so far, unless the
+  // mesh was read in parallel)
   std::set<int> bdTags;
-  for (int i(0); i < NumSides; ++i) {
-    bdTags.insert(sides[NumSideNodes][i]);
+  if (distributed) {
+    std::set<int> const myTags(local_side_tags.begin(), local_side_tags.end());
+    Teuchos::Array<GO>  myTagsArray(myTags.begin(), myTags.end());
+    Teuchos::Array<GO>  allTags;
+    gatherAllV(commT, myTagsArray(), allTags);
+    bdTags.insert(allTags.begin(), allTags.end());
+  } else {
+    for (int i(0); i < NumSides; ++i) {
+      bdTags.insert(sides[NumSideNodes][i]);
+    }
   }
 
   // Broadcasting the tags
@@ -1660,3 +1702,847 @@ Albany::GmshSTKMeshStruct::get_physical_names(std::map<std::string, int>& physic
 
   return;
 }
+
+// ---------------------------- Distributed read --------------------------- //
+
+namespace {
+
+// Read-only memory map of the mesh file
+class MappedFile
+{
+ public:
+  explicit MappedFile(std::string const& name)
+  {
+    int const fd = ::open(name.c_str(), O_RDONLY);
+    ALBANY_PANIC(fd < 0, "Error! Cannot open mesh file '" << name << "'.\n");
+    struct stat st;
+    ALBANY_PANIC(::fstat(fd, &st) != 0, "Error! Cannot read mesh file '" << name << "'.\n");
+    size_ = st.st_size;
+    if (size_ > 0) {
+      void* const addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      ALBANY_PANIC(addr == MAP_FAILED, "Error! Cannot map mesh file '" << name << "'.\n");
+      data_ = static_cast<char const*>(addr);
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile()
+  {
+    if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+  }
+
+  MappedFile(MappedFile const&) = delete;
+  MappedFile&
+  operator=(MappedFile const&) = delete;
+
+  char const*
+  begin() const
+  {
+    return data_;
+  }
+
+  char const*
+  end() const
+  {
+    return data_ + size_;
+  }
+
+  std::size_t
+  size() const
+  {
+    return size_;
+  }
+
+ private:
+  char const* data_{nullptr};
+  std::size_t size_{0};
+};
+
+// Nodes read by this process
+struct NodeList
+{
+  std::vector<GO>     ids;
+  std::vector<double> coords;  // 3 per node
+};
+
+// Elements (cells, sides and points) read by this process
+struct ElementList
+{
+  std::vector<int> types;
+  std::vector<int> tags;
+  std::vector<GO>  nodes;  // gmsh_num_nodes(type) per element
+};
+
+// Number of nodes of the gmsh element types we support
+int
+gmsh_num_nodes(int const type)
+{
+  switch (type) {
+    case 1: return 2;
+    case 2: return 3;
+    case 3: return 4;
+    case 4: return 4;
+    case 5: return 8;
+    case 8: return 3;
+    case 9: return 6;
+    case 11: return 10;
+    case 15: return 1;
+    default: ALBANY_ABORT("Error! Element type (" << type << ") not supported.\n");
+  }
+  return 0;
+}
+
+int
+gmsh_dimension(int const type)
+{
+  switch (type) {
+    case 15: return 0;
+    case 1:
+    case 8: return 1;
+    case 2:
+    case 3:
+    case 9: return 2;
+    default: return 3;
+  }
+}
+
+// First index of the part of [0, n) read by process rank
+GO
+range_begin(GO const n, int const rank, int const nproc)
+{
+  return n * rank / nproc;
+}
+
+// Start of the line following the one containing p
+char const*
+next_line(char const* p, char const* end)
+{
+  auto const eol = static_cast<char const*>(std::memchr(p, '\n', end - p));
+  return eol == nullptr ? end : eol + 1;
+}
+
+char const*
+skip_lines(char const* p, char const* end, GO const n)
+{
+  for (GO i = 0; i < n && p < end; ++i) p = next_line(p, end);
+  return p;
+}
+
+// Parse a number and move p past it
+GO
+parse_int(char const*& p)
+{
+  char*    last;
+  GO const value = std::strtoll(p, &last, 10);
+  p              = last;
+  return value;
+}
+
+double
+parse_double(char const*& p)
+{
+  char*        last;
+  double const value = std::strtod(p, &last);
+  p                  = last;
+  return value;
+}
+
+// Whether the line starting at p is marker, ending with "\n" or "\r\n"
+bool
+is_line(char const* p, char const* end, std::string const& marker)
+{
+  if (static_cast<std::size_t>(end - p) <= marker.size() || std::memcmp(p, marker.data(), marker.size()) != 0) return false;
+  char const* q = p + marker.size();
+  if (*q == '\r') ++q;
+  return q < end && *q == '\n';
+}
+
+// First line equal to marker that starts in [p, last), or last if there is
+// none. p must be the start of a line.
+char const*
+search_line(char const* p, char const* last, char const* end, std::string const& marker)
+{
+  for (char const* q = p; q < last; q = next_line(q, end)) {
+    if (*q == marker[0] && is_line(q, end, marker)) return q;
+  }
+  return last;
+}
+
+// Start of the line after the first line equal to marker, searching from p
+char const*
+find_line(char const* p, char const* end, std::string const& marker)
+{
+  char const* const q = search_line(p, end, end, marker);
+  ALBANY_PANIC(q == end, "Error! " << marker << " section not found.\n");
+  return next_line(q, end);
+}
+
+// Offset of the line equal to marker in an ascii file, or the size of the
+// file if there is none. Each process searches its own part of the file.
+std::size_t
+find_section(MappedFile const& file, std::string const& marker, Teuchos_Comm const& comm)
+{
+  std::size_t const rank  = comm.getRank();
+  std::size_t const nproc = comm.getSize();
+  char const* const first = file.begin() + file.size() * rank / nproc;
+  char const* const last  = file.begin() + file.size() * (rank + 1) / nproc;
+
+  // The lines that start in this part
+  char const* const p     = first == file.begin() ? first : next_line(first - 1, file.end());
+  char const* const q     = search_line(p, last, file.end(), marker);
+  long long         found = q < last ? q - file.begin() : file.size();
+  long long         section;
+  Teuchos::reduceAll<LO, long long>(comm, Teuchos::REDUCE_MIN, found, Teuchos::outArg(section));
+  return section;
+}
+
+// Version 2.2 ascii: one node per line. Every process reads the lines that
+// start in its part of the bytes of the section. Returns the number of nodes.
+GO
+read_nodes_ascii_v22(char const* p, char const* last, int const rank, int const nproc, NodeList& nodes)
+{
+  GO const num_nodes = parse_int(p);
+  p                  = next_line(p, last);
+
+  char const*       begin = p + range_begin(last - p, rank, nproc);
+  char const* const end   = p + range_begin(last - p, rank + 1, nproc);
+  if (begin != p) begin = next_line(begin - 1, last);
+  for (char const* q = begin; q < end; q = next_line(q, last)) {
+    GO const     id = parse_int(q);
+    double const x  = parse_double(q);
+    double const y  = parse_double(q);
+    double const z  = parse_double(q);
+    nodes.ids.push_back(id);
+    nodes.coords.insert(nodes.coords.end(), {x, y, z});
+  }
+  return num_nodes;
+}
+
+// Version 2.2 ascii: one element per line, with its tags before its nodes.
+// Every process reads the lines that start in its part of the bytes of the
+// section. Returns the number of elements.
+GO
+read_elements_ascii_v22(char const* p, char const* last, int const rank, int const nproc, ElementList& elements)
+{
+  GO const num_elements = parse_int(p);
+  p                     = next_line(p, last);
+
+  char const*       begin = p + range_begin(last - p, rank, nproc);
+  char const* const end   = p + range_begin(last - p, rank + 1, nproc);
+  if (begin != p) begin = next_line(begin - 1, last);
+  for (char const* q = begin; q < end; q = next_line(q, last)) {
+    parse_int(q);  // element id
+    int const type   = parse_int(q);
+    int const n_tags = parse_int(q);
+    ALBANY_PANIC(n_tags <= 0, "Error! Number of tags must be positive.\n");
+    elements.types.push_back(type);
+    elements.tags.push_back(parse_int(q));
+    for (int j = 1; j < n_tags; ++j) parse_int(q);
+    int const n_nodes = gmsh_num_nodes(type);
+    for (int j = 0; j < n_nodes; ++j) elements.nodes.push_back(parse_int(q));
+  }
+  return num_elements;
+}
+
+// Sends send[p] to process p and returns the data received from each process.
+// Only the processes that have something to exchange communicate.
+template <typename T>
+std::map<int, std::vector<T>>
+exchange(MPI_Comm const comm, std::map<int, std::vector<T>> const& send)
+{
+  stk::CommSparse sparse(comm);
+  for (int phase = 0; phase < 2; ++phase) {
+    for (auto const& message : send) {
+      stk::CommBuffer& buffer = sparse.send_buffer(message.first);
+      buffer.pack<std::size_t>(message.second.size());
+      buffer.pack<T>(message.second.data(), message.second.size());
+    }
+    if (phase == 0) {
+      sparse.allocate_buffers();
+    } else {
+      sparse.communicate();
+    }
+  }
+
+  std::map<int, std::vector<T>> recv;
+  for (int p = 0; p < sparse.parallel_size(); ++p) {
+    stk::CommBuffer& buffer = sparse.recv_buffer(p);
+    if (buffer.remaining() == 0) continue;
+    std::size_t n = 0;
+    buffer.unpack<std::size_t>(n);
+    std::vector<T>& values = recv[p];
+    values.resize(n);
+    buffer.unpack<T>(values.data(), n);
+  }
+  return recv;
+}
+
+// Version 4.1 ascii: nodes come in blocks, the tags of the nodes of a block
+// followed by their coordinates, so where the lines of a node are depends on
+// all the blocks before it. Process 0 walks the section once and sends every
+// process the parts of the blocks in its range of the node indices, as the
+// offsets of their first tag and coordinates lines and their number of nodes,
+// after the number of nodes of the mesh. Returns the number of nodes.
+GO
+read_nodes_ascii_v41(char const* p, char const* last, MPI_Comm const comm, NodeList& nodes)
+{
+  int rank, nproc;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &nproc);
+
+  char const* const              section = p;
+  std::map<int, std::vector<GO>> parts;
+  if (rank == 0) {
+    GO const num_blocks = parse_int(p);
+    GO const num_nodes  = parse_int(p);
+    p                   = next_line(p, last);
+    for (int proc = 0; proc < nproc; ++proc) parts[proc].push_back(num_nodes);
+
+    GO  index = 0;
+    int proc  = 0;
+    for (GO block = 0; block < num_blocks; ++block) {
+      parse_int(p);  // entity dimension
+      parse_int(p);  // entity tag
+      parse_int(p);  // parametric
+      GO const n = parse_int(p);
+      p          = next_line(p, last);
+
+      char const* t = p;
+      char const* x = skip_lines(p, last, n);
+      for (GO i = index; i < index + n;) {
+        while (range_begin(num_nodes, proc + 1, nproc) <= i) ++proc;
+        GO const count = std::min(index + n, range_begin(num_nodes, proc + 1, nproc)) - i;
+        parts[proc].insert(parts[proc].end(), {static_cast<GO>(t - section), static_cast<GO>(x - section), count});
+        t = skip_lines(t, last, count);
+        x = skip_lines(x, last, count);
+        i += count;
+      }
+      p = x;
+      index += n;
+    }
+  }
+
+  std::vector<GO> const my_parts = exchange(comm, parts)[0];
+  for (std::size_t k = 1; k < my_parts.size(); k += 3) {
+    char const* t = section + my_parts[k];
+    char const* x = section + my_parts[k + 1];
+    for (GO i = 0; i < my_parts[k + 2]; ++i) {
+      nodes.ids.push_back(parse_int(t));
+      t = next_line(t, last);
+      for (int j = 0; j < 3; ++j) nodes.coords.push_back(parse_double(x));
+      x = next_line(x, last);
+    }
+  }
+  return my_parts[0];
+}
+
+// Version 4.1 ascii: elements come in blocks of elements of the same type,
+// one element per line. As for the nodes, process 0 walks the section once
+// and sends every process the parts of the blocks in its range of the element
+// indices, as the offset of their first line, their tag, type and number of
+// elements, after the number of elements of the mesh. Returns the number of
+// elements.
+GO
+read_elements_ascii_v41(char const* p, char const* last, MPI_Comm const comm, ElementList& elements)
+{
+  int rank, nproc;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &nproc);
+
+  char const* const              section = p;
+  std::map<int, std::vector<GO>> parts;
+  if (rank == 0) {
+    GO const num_blocks   = parse_int(p);
+    GO const num_elements = parse_int(p);
+    p                     = next_line(p, last);
+    for (int proc = 0; proc < nproc; ++proc) parts[proc].push_back(num_elements);
+
+    GO  index = 0;
+    int proc  = 0;
+    for (GO block = 0; block < num_blocks; ++block) {
+      parse_int(p);  // entity dimension
+      GO const tag  = parse_int(p);
+      GO const type = parse_int(p);
+      GO const n    = parse_int(p);
+      p             = next_line(p, last);
+
+      for (GO i = index; i < index + n;) {
+        while (range_begin(num_elements, proc + 1, nproc) <= i) ++proc;
+        GO const count = std::min(index + n, range_begin(num_elements, proc + 1, nproc)) - i;
+        parts[proc].insert(parts[proc].end(), {static_cast<GO>(p - section), tag, type, count});
+        p = skip_lines(p, last, count);
+        i += count;
+      }
+      index += n;
+    }
+  }
+
+  std::vector<GO> const my_parts = exchange(comm, parts)[0];
+  for (std::size_t k = 1; k < my_parts.size(); k += 4) {
+    char const* q       = section + my_parts[k];
+    int const   tag     = my_parts[k + 1];
+    int const   type    = my_parts[k + 2];
+    int const   n_nodes = gmsh_num_nodes(type);
+    for (GO i = 0; i < my_parts[k + 3]; ++i) {
+      parse_int(q);  // element id
+      elements.types.push_back(type);
+      elements.tags.push_back(tag);
+      for (int j = 0; j < n_nodes; ++j) elements.nodes.push_back(parse_int(q));
+      q = next_line(q, last);
+    }
+  }
+  return my_parts[0];
+}
+
+// Version 2.2 binary: fixed size records of an int id and three doubles.
+// Every process reads a range of the node indices.
+void
+read_nodes_binary_v22(char const* p, GO const num_nodes, int const rank, int const nproc, NodeList& nodes)
+{
+  std::size_t const record = sizeof(int) + 3 * sizeof(double);
+  for (GO i = range_begin(num_nodes, rank, nproc); i < range_begin(num_nodes, rank + 1, nproc); ++i) {
+    int    id;
+    double x[3];
+    std::memcpy(&id, p + i * record, sizeof(int));
+    std::memcpy(x, p + i * record + sizeof(int), 3 * sizeof(double));
+    nodes.ids.push_back(id);
+    nodes.coords.insert(nodes.coords.end(), x, x + 3);
+  }
+}
+
+// Version 2.2 binary: blocks of elements of the same type, each with a header
+// of three ints (type, number of elements, number of tags) followed by the
+// elements as ints (id, tags, nodes). Every process reads a range of the
+// element indices.
+void
+read_elements_binary_v22(char const* p, GO const num_elements, int const rank, int const nproc, ElementList& elements)
+{
+  GO const         lo    = range_begin(num_elements, rank, nproc);
+  GO const         hi    = range_begin(num_elements, rank + 1, nproc);
+  GO               index = 0;
+  std::vector<int> record;
+  while (index < hi) {
+    int header[3];
+    std::memcpy(header, p, 3 * sizeof(int));
+    p += 3 * sizeof(int);
+    ALBANY_PANIC(header[1] <= 0, "Error! Invalid number of elements of this type.\n");
+    ALBANY_PANIC(header[2] <= 0, "Error! Invalid number of tags.\n");
+
+    int const         type    = header[0];
+    GO const          n       = header[1];
+    int const         n_tags  = header[2];
+    int const         n_nodes = gmsh_num_nodes(type);
+    std::size_t const length  = 1 + n_tags + n_nodes;
+    if (index + n > lo) {
+      record.resize(length);
+      for (GO i = std::max(lo, index) - index; i < std::min(hi, index + n) - index; ++i) {
+        std::memcpy(record.data(), p + i * length * sizeof(int), length * sizeof(int));
+        elements.types.push_back(type);
+        elements.tags.push_back(record[1]);
+        elements.nodes.insert(elements.nodes.end(), record.begin() + 1 + n_tags, record.end());
+      }
+    }
+    p += n * length * sizeof(int);
+    index += n;
+  }
+}
+
+}  // anonymous namespace
+
+void
+Albany::GmshSTKMeshStruct::loadDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT)
+{
+  int const                        rank     = commT->getRank();
+  int const                        nproc    = commT->getSize();
+  Teuchos::RCP<Teuchos_Comm const> comm     = commT;
+  MPI_Comm const                   mpi_comm = getMpiCommFromTeuchosComm(comm);
+
+  // Nodes and elements read by this process
+  NodeList    nodes;
+  ElementList elements;
+  {
+    MappedFile        file(fname);
+    char const* const end = file.end();
+
+    ALBANY_PANIC(
+        !is_line(file.begin(), end, "$MeshFormat"),
+        "Error! Mesh file '" << fname << "' has no $MeshFormat header. Legacy msh files cannot be read in parallel.\n");
+
+    // Version, file type and data size
+    char const* p        = next_line(file.begin(), end);
+    version_in           = parse_double(p);
+    bool const binary    = parse_int(p) != 0;
+    int const  data_size = parse_int(p);
+    p                    = next_line(p, end);
+    ALBANY_PANIC(!set_version_enum_from_float(), "Error! Cannot read version " << version_in << " of gmsh *.msh file!\n");
+
+    GO num_nodes = 0;
+    if (binary) {
+      ALBANY_PANIC(version != GmshVersion::V2_2, "Error! Only version 2.2 binary msh files can be read in parallel.\n");
+      int one = 0;
+      std::memcpy(&one, p, sizeof(int));
+      ALBANY_PANIC(one != 1 || data_size != static_cast<int>(sizeof(double)), "Error! Uncompatible binary format.\n");
+
+      // The sections are located from the size of the binary data, which
+      // could contain the section markers
+      p         = find_line(p + sizeof(int), end, "$Nodes");
+      num_nodes = parse_int(p);
+      p         = next_line(p, end);
+      read_nodes_binary_v22(p, num_nodes, rank, nproc, nodes);
+
+      p            = find_line(p + num_nodes * (sizeof(int) + 3 * sizeof(double)), end, "$Elements");
+      num_entities = parse_int(p);
+      p            = next_line(p, end);
+      read_elements_binary_v22(p, num_entities, rank, nproc, elements);
+    } else {
+      std::size_t const nodes_begin    = find_section(file, "$Nodes", *commT);
+      std::size_t const nodes_end      = find_section(file, "$EndNodes", *commT);
+      std::size_t const elements_begin = find_section(file, "$Elements", *commT);
+      std::size_t const elements_end   = find_section(file, "$EndElements", *commT);
+      ALBANY_PANIC(nodes_begin == file.size() || nodes_end == file.size(), "Error! Nodes section not found.\n");
+      ALBANY_PANIC(elements_begin == file.size() || elements_end == file.size(), "Error! Element section not found.\n");
+
+      char const* const nodes_first    = next_line(file.begin() + nodes_begin, end);
+      char const* const elements_first = next_line(file.begin() + elements_begin, end);
+      if (version == GmshVersion::V2_2) {
+        num_nodes    = read_nodes_ascii_v22(nodes_first, file.begin() + nodes_end, rank, nproc, nodes);
+        num_entities = read_elements_ascii_v22(elements_first, file.begin() + elements_end, rank, nproc, elements);
+      } else {
+        num_nodes    = read_nodes_ascii_v41(nodes_first, file.begin() + nodes_end, mpi_comm, nodes);
+        num_entities = read_elements_ascii_v41(elements_first, file.begin() + elements_end, mpi_comm, elements);
+      }
+    }
+    ALBANY_PANIC(num_nodes <= 0, "Error! Invalid number of nodes.\n");
+    ALBANY_PANIC(num_entities <= 0, "Error! Invalid number of mesh elements.\n");
+    NumNodes = num_nodes;
+  }
+
+  // The element types in the whole mesh determine which elements are cells
+  // and which are sides
+  for (int const type : elements.types) {
+    increment_element_type(type);
+  }
+  int counts[8] = {nb_lines, nb_line3, nb_trias, nb_tri6, nb_quads, nb_tetra, nb_tet10, nb_hexas};
+  int global_counts[8];
+  Teuchos::reduceAll<LO, int>(*commT, Teuchos::REDUCE_SUM, 8, counts, global_counts);
+  nb_lines = global_counts[0];
+  nb_line3 = global_counts[1];
+  nb_trias = global_counts[2];
+  nb_tri6  = global_counts[3];
+  nb_quads = global_counts[4];
+  nb_tetra = global_counts[5];
+  nb_tet10 = global_counts[6];
+  nb_hexas = global_counts[7];
+
+  check_element_types();
+  set_generic_mesh_info();
+
+  // Sides are stored as id, tag and nodes
+  std::size_t const side_length = 2 + NumSideNodes;
+  std::vector<GO>   read_sides;
+  std::size_t       offset = 0;
+  for (std::size_t i = 0; i < elements.types.size(); ++i) {
+    int const       type    = elements.types[i];
+    int const       n_nodes = gmsh_num_nodes(type);
+    GO const* const n       = elements.nodes.data() + offset;
+    offset += n_nodes;
+    if (gmsh_dimension(type) == numDim) {
+      local_elem_nodes.insert(local_elem_nodes.end(), n, n + n_nodes);
+      // The node ordering between gmsh and STK for tet10 is the same
+      // EXCEPT for the last two. I.e., nodes 8 and 9 are switched!
+      if (type == 11) std::swap(local_elem_nodes[local_elem_nodes.size() - 2], local_elem_nodes[local_elem_nodes.size() - 1]);
+    } else if (gmsh_dimension(type) == numDim - 1) {
+      read_sides.push_back(0);
+      read_sides.push_back(elements.tags[i]);
+      read_sides.insert(read_sides.end(), n, n + n_nodes);
+    }
+  }
+  elements = ElementList();
+
+  // Cells and sides are numbered in the order of the file
+  GO const my_counts[2] = {static_cast<GO>(local_elem_nodes.size() / NumElemNodes), static_cast<GO>(read_sides.size() / side_length)};
+  GO       scan_counts[2];
+  Teuchos::scan<LO, GO>(*commT, Teuchos::REDUCE_SUM, 2, my_counts, scan_counts);
+  for (GO i = 0; i < my_counts[0]; ++i) {
+    local_elem_ids.push_back(scan_counts[0] - my_counts[0] + i + 1);
+  }
+  for (GO i = 0; i < my_counts[1]; ++i) {
+    read_sides[i * side_length] = scan_counts[1] - my_counts[1] + i + 1;
+  }
+
+  // Node coordinates are exchanged through a directory: the nodes are split
+  // among the processes by id, the readers of a node send it to its directory
+  // process and the processes with cells containing the node request it. The
+  // directory process also knows which processes share the node and sends each
+  // side to the processes that have its smallest node.
+  GO my_max_id = 0;
+  for (GO const id : nodes.ids) {
+    my_max_id = std::max(my_max_id, id);
+  }
+  GO max_id = 0;
+  Teuchos::reduceAll<LO, GO>(*commT, Teuchos::REDUCE_MAX, my_max_id, Teuchos::outArg(max_id));
+  auto const directory_of = [&](GO const id) {
+    ALBANY_PANIC(id < 1 || id > max_id, "Error! Node " << id << " not found in the mesh.\n");
+    return static_cast<int>((id - 1) * nproc / max_id);
+  };
+  auto const smallest_node = [&](GO const* side) { return *std::min_element(side + 2, side + side_length); };
+
+  std::map<int, std::vector<GO>> to_directory;
+  {
+    std::map<int, std::vector<GO>> read_ids, requests, sides;
+    for (std::size_t i = 0; i < nodes.ids.size(); ++i) {
+      read_ids[directory_of(nodes.ids[i])].push_back(nodes.ids[i]);
+    }
+    std::vector<GO> needed(local_elem_nodes);
+    std::sort(needed.begin(), needed.end());
+    needed.erase(std::unique(needed.begin(), needed.end()), needed.end());
+    for (GO const id : needed) {
+      requests[directory_of(id)].push_back(id);
+    }
+    for (std::size_t k = 0; k < read_sides.size(); k += side_length) {
+      std::vector<GO>& s = sides[directory_of(smallest_node(&read_sides[k]))];
+      s.insert(s.end(), read_sides.begin() + k, read_sides.begin() + k + side_length);
+    }
+
+    // Message to each directory process: read node ids, requested node ids
+    // (each preceded by their number) and sides
+    for (int p = 0; p < nproc; ++p) {
+      auto const ids = read_ids.find(p);
+      auto const req = requests.find(p);
+      auto const sd  = sides.find(p);
+      if (ids == read_ids.end() && req == requests.end() && sd == sides.end()) continue;
+      std::vector<GO>& m = to_directory[p];
+      m.push_back(ids == read_ids.end() ? 0 : ids->second.size());
+      if (ids != read_ids.end()) m.insert(m.end(), ids->second.begin(), ids->second.end());
+      m.push_back(req == requests.end() ? 0 : req->second.size());
+      if (req != requests.end()) m.insert(m.end(), req->second.begin(), req->second.end());
+      if (sd != sides.end()) m.insert(m.end(), sd->second.begin(), sd->second.end());
+    }
+  }
+  std::map<int, std::vector<double>> coords_to_directory;
+  for (std::size_t i = 0; i < nodes.ids.size(); ++i) {
+    std::vector<double>& x = coords_to_directory[directory_of(nodes.ids[i])];
+    x.insert(x.end(), nodes.coords.begin() + 3 * i, nodes.coords.begin() + 3 * i + 3);
+  }
+  nodes = NodeList();
+
+  std::map<int, std::vector<GO>>     from_directory;
+  std::map<int, std::vector<double>> coords_from_directory;
+  {
+    struct DirectoryEntry
+    {
+      std::array<double, 3> x;
+      bool                  found{false};
+      std::vector<int>      procs;
+    };
+    std::unordered_map<GO, DirectoryEntry> directory;
+    std::vector<GO>                        directory_sides;
+
+    auto const ids    = exchange(mpi_comm, to_directory);
+    auto const coords = exchange(mpi_comm, coords_to_directory);
+    to_directory.clear();
+    coords_to_directory.clear();
+    for (auto const& message : ids) {
+      std::vector<GO> const& m      = message.second;
+      std::size_t            k      = 0;
+      GO const               n_read = m[k++];
+      for (GO i = 0; i < n_read; ++i) {
+        DirectoryEntry& entry = directory[m[k++]];
+        std::copy_n(coords.at(message.first).begin() + 3 * i, 3, entry.x.begin());
+        entry.found = true;
+      }
+      GO const n_requested = m[k++];
+      for (GO i = 0; i < n_requested; ++i) {
+        directory[m[k++]].procs.push_back(message.first);
+      }
+      directory_sides.insert(directory_sides.end(), m.begin() + k, m.end());
+    }
+
+    // Message to each process with cells: number of nodes, then for each node
+    // its id and the other processes that have it, then sides
+    std::map<int, std::vector<GO>>     to_procs;
+    std::map<int, std::vector<double>> coords_to_procs;
+    for (auto const& node : directory) {
+      DirectoryEntry const& entry = node.second;
+      ALBANY_PANIC(!entry.procs.empty() && !entry.found, "Error! Node " << node.first << " not found in the mesh.\n");
+      for (int const p : entry.procs) {
+        std::vector<GO>& m = to_procs[p];
+        if (m.empty()) m.push_back(0);
+        ++m[0];
+        m.push_back(node.first);
+        m.push_back(entry.procs.size() - 1);
+        for (int const q : entry.procs) {
+          if (q != p) m.push_back(q);
+        }
+        std::vector<double>& x = coords_to_procs[p];
+        x.insert(x.end(), entry.x.begin(), entry.x.end());
+      }
+    }
+    for (std::size_t k = 0; k < directory_sides.size(); k += side_length) {
+      auto const it = directory.find(smallest_node(&directory_sides[k]));
+      if (it == directory.end()) continue;
+      for (int const p : it->second.procs) {
+        std::vector<GO>& m = to_procs[p];
+        m.insert(m.end(), directory_sides.begin() + k, directory_sides.begin() + k + side_length);
+      }
+    }
+    from_directory        = exchange(mpi_comm, to_procs);
+    coords_from_directory = exchange(mpi_comm, coords_to_procs);
+  }
+
+  std::vector<GO> candidate_sides;
+  for (auto const& message : from_directory) {
+    std::vector<GO> const&     m = message.second;
+    std::vector<double> const& x = coords_from_directory.at(message.first);
+    std::size_t                k = 0;
+    GO const                   n = m[k++];
+    for (GO i = 0; i < n; ++i) {
+      GO const id      = m[k++];
+      GO const n_procs = m[k++];
+      std::copy_n(x.begin() + 3 * i, 3, local_node_coords[id].begin());
+      if (n_procs > 0) local_node_sharing[id].assign(m.begin() + k, m.begin() + k + n_procs);
+      k += n_procs;
+    }
+    candidate_sides.insert(candidate_sides.end(), m.begin() + k, m.end());
+  }
+  from_directory.clear();
+  coords_from_directory.clear();
+
+  // A side may be contained in cells of more than one process (e.g. a
+  // surface inside the domain). Each process claims the candidate sides
+  // contained in one of its cells, and the directory gives each side to the
+  // lowest process that claimed it.
+  std::map<int, std::vector<GO>>                   claims;
+  std::unordered_map<GO, std::vector<std::size_t>> node_cells;
+  for (std::size_t c = 0; c < local_elem_ids.size(); ++c) {
+    for (int j = 0; j < NumElemNodes; ++j) {
+      node_cells[local_elem_nodes[c * NumElemNodes + j]].push_back(c);
+    }
+  }
+  auto const contains_side = [&](GO const* side) {
+    auto const it = node_cells.find(side[2]);
+    if (it == node_cells.end()) return false;
+    for (std::size_t const c : it->second) {
+      GO const* const cell  = &local_elem_nodes[c * NumElemNodes];
+      bool            found = true;
+      for (int j = 0; j < NumSideNodes && found; ++j) {
+        found = std::find(cell, cell + NumElemNodes, side[2 + j]) != cell + NumElemNodes;
+      }
+      if (found) return true;
+    }
+    return false;
+  };
+  for (std::size_t k = 0; k < candidate_sides.size(); k += side_length) {
+    if (contains_side(&candidate_sides[k])) {
+      claims[directory_of(smallest_node(&candidate_sides[k]))].push_back(candidate_sides[k]);
+    }
+  }
+
+  std::map<int, std::vector<GO>> winners;
+  {
+    // Messages are received in increasing process order, so the first claim
+    // of a side comes from the lowest process
+    std::unordered_map<GO, int> owner;
+    for (auto const& message : exchange(mpi_comm, claims)) {
+      for (GO const id : message.second) {
+        owner.emplace(id, message.first);
+      }
+    }
+    std::map<int, std::vector<GO>> won;
+    for (auto const& side : owner) {
+      won[side.second].push_back(side.first);
+    }
+    winners = exchange(mpi_comm, won);
+  }
+
+  std::set<GO> my_sides;
+  for (auto const& message : winners) {
+    my_sides.insert(message.second.begin(), message.second.end());
+  }
+  for (std::size_t k = 0; k < candidate_sides.size(); k += side_length) {
+    if (my_sides.count(candidate_sides[k]) == 0) continue;
+    local_side_ids.push_back(candidate_sides[k]);
+    local_side_tags.push_back(candidate_sides[k + 1]);
+    local_side_nodes.insert(local_side_nodes.end(), candidate_sides.begin() + k + 2, candidate_sides.begin() + k + side_length);
+  }
+
+  GO const my_num_sides = local_side_ids.size();
+  GO       num_sides    = 0;
+  Teuchos::reduceAll<LO, GO>(*commT, Teuchos::REDUCE_SUM, my_num_sides, Teuchos::outArg(num_sides));
+  ALBANY_PANIC(num_sides != NumSides, "Error! Cannot find element connected to " << NumSides - num_sides << " sides.\n");
+
+  return;
+}
+
+void
+Albany::GmshSTKMeshStruct::declareDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT)
+{
+  AbstractSTKFieldContainer::IntScalarFieldType* proc_rank_field   = fieldContainer->getProcRankField();
+  AbstractSTKFieldContainer::VectorFieldType*    coordinates_field = fieldContainer->getCoordinatesField();
+
+  stk::mesh::PartVector singlePartVec(1);
+  singlePartVec[0] = nsPartVec["Node"];
+  for (auto const& node : local_node_coords) {
+    stk::mesh::Entity entity = bulkData->declare_entity(stk::topology::NODE_RANK, node.first, singlePartVec);
+
+    double* coord = stk::mesh::field_data(*coordinates_field, entity);
+    for (int i = 0; i < numDim; ++i) {
+      coord[i] = node.second[i];
+    }
+  }
+  for (auto const& node : local_node_sharing) {
+    stk::mesh::Entity entity = bulkData->get_entity(stk::topology::NODE_RANK, node.first);
+    for (int const proc : node.second) {
+      bulkData->add_node_sharing(entity, proc);
+    }
+  }
+
+  singlePartVec[0] = partVec[0];
+  for (std::size_t i = 0; i < local_elem_ids.size(); ++i) {
+    stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, local_elem_ids[i], singlePartVec);
+
+    for (int j = 0; j < NumElemNodes; ++j) {
+      stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, local_elem_nodes[i * NumElemNodes + j]);
+      bulkData->declare_relation(elem, node, j);
+    }
+
+    int* p_rank = stk::mesh::field_data(*proc_rank_field, elem);
+    p_rank[0]   = commT->getRank();
+  }
+
+  // loadDistributedMesh kept only the sides contained in a local cell
+  stk::mesh::PartVector nsPartVec_i(1), ssPartVec_i(2);
+  ssPartVec_i[0] = ssPartVec["BoundarySide"];  // The whole boundary side
+  for (std::size_t i = 0; i < local_side_ids.size(); ++i) {
+    nsPartVec_i[0] = nsPartVec[bdTagToNodeSetName[local_side_tags[i]]];
+    ssPartVec_i[1] = ssPartVec[bdTagToSideSetName[local_side_tags[i]]];
+
+    std::map<stk::mesh::EntityId, int> elm_count;
+    stk::mesh::Entity                  side = bulkData->declare_entity(metaData->side_rank(), local_side_ids[i], ssPartVec_i);
+    for (int j = 0; j < NumSideNodes; ++j) {
+      stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK, local_side_nodes[i * NumSideNodes + j]);
+      bulkData->change_entity_parts(node_j, nsPartVec_i);  // Add node to the boundary nodeset
+      bulkData->declare_relation(side, node_j, j);
+
+      int                      num_e = bulkData->num_elements(node_j);
+      const stk::mesh::Entity* e     = bulkData->begin_elements(node_j);
+      for (int k(0); k < num_e; ++k) {
+        ++elm_count[bulkData->identifier(e[k])];
+      }
+    }
+
+    bool found = false;
+    for (auto e : elm_count)
+      if (e.second == NumSideNodes) {
+        stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEM_RANK, e.first);
+        found                  = true;
+        int num_sides          = bulkData->num_sides(elem);
+        bulkData->declare_relation(elem, side, num_sides);
+        break;
+      }
+
+    ALBANY_PANIC(found == false, "Error! Cannot find element connected to side " << local_side_ids[i] << ".\n");
+  }
+
+  return;
+}
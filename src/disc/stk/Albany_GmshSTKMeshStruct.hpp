@@ -5,6 +5,8 @@
 #ifndef ALBANY_GMSH_STK_MESH_STRUCT_HPP
 #define ALBANY_GMSH_STK_MESH_STRUCT_HPP
 
+#include <array>
+
 #include "Albany_GenericSTKMeshStruct.hpp"
 
 namespace Albany {
@@ -118,6 +120,10 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void
   set_specific_num_of_each_elements(std::ifstream& ifile);
 
+  // Checks that the element type counters describe a mesh we can handle
+  void
+  check_element_types();
+
   // Increments the element type counter based on the type number
   void
   increment_element_type(int e_type);
@@ -213,6 +219,17 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void
   loadBinaryMesh();
 
+  // Reads the mesh on all processes. Each process reads a contiguous range
+  // of the node and element sections of the (memory-mapped) file, keeps the
+  // cells it read and receives the coordinates of their nodes from the
+  // processes that read them. No process holds the global mesh.
+  void
+  loadDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT);
+
+  // Declares the part of the mesh read by this process in loadDistributedMesh
+  void
+  declareDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT);
+
   // Init the int counters below to zero.
   void
   init_counters_to_zero();
@@ -259,6 +276,18 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   // ones only!
   int** elems;
   int** sides;
+
+  // Mesh read by loadDistributedMesh: the cells read by this process, the
+  // sides that may belong to them and the nodes of the cells, with the other
+  // processes that have each node.
+  bool                                distributed;
+  std::vector<GO>                     local_elem_ids;
+  std::vector<GO>                     local_elem_nodes;  // NumElemNodes per cell
+  std::vector<GO>                     local_side_ids;
+  std::vector<GO>                     local_side_nodes;  // NumSideNodes per side
+  std::vector<int>                    local_side_tags;
+  std::map<GO, std::array<double, 3>> local_node_coords;
+  std::map<GO, std::vector<int>>      local_node_sharing;
 };
 
 }  // Namespace Albany
@@ -11,6 +11,7 @@
 #include "Albany_BucketArray.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_Memory.hpp"
 #include "Albany_NodalGraphUtils.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_Utils.hpp"
@@ -889,6 +890,8 @@ STKDiscretization::writeSolutionMVToMeshDatabase(const Thyra_MultiVector& soln,
 void
 STKDiscretization::writeSolutionToFile(Thyra_Vector const& soln, double const time, bool const overlapped)
 {
+  MemoryScope memory(MemoryTag::Output);
+
   if (stkMeshStruct->exoOutput && stkMeshStruct->transferSolutionToCoords) {
     Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
@@ -944,6 +947,8 @@ STKDiscretization::writeSolutionToFile(Thyra_Vector const& soln, double const ti
 void
 STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double const time, bool const overlapped)
 {
+  MemoryScope memory(MemoryTag::Output);
+
   if (stkMeshStruct->exoOutput && stkMeshStruct->transferSolutionToCoords) {
     Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
@@ -1453,6 +1458,7 @@ STKDiscretization::computeOverlapNodesAndUnknowns()
 void
 STKDiscretization::computeGraphs()
 {
+  MemoryScope memory(MemoryTag::JacobianGraph);
   computeGraphsUpToFillComplete();
   fillCompleteGraphs();
 }
@@ -2028,6 +2034,16 @@ STKDiscretization::computeWorksetInfo()
 
   // Set boundary indicator fields
   computeWorksetInfoBoundaryIndicators();
+
+  computeWorksetColoring();
+}
+
+void
+STKDiscretization::computeWorksetColoring()
+{
+  int const num_worksets = wsElNodeID.size();
+  wsElColoring.resize(num_worksets);
+  for (int ws = 0; ws < num_worksets; ++ws) wsElColoring[ws] = colorElements(wsElNodeID[ws]);
 }
 
 void
@@ -2246,6 +2262,35 @@ STKDiscretization::computeNodeSets()
     }
     ns++;
   }
+  computeNodeSetActiveNodes();
+}
+
+void
+STKDiscretization::computeNodeSetActiveNodes()
+{
+  // With a node boundary indicator, conditions apply to the nodes that are
+  // not interior (0) and, on erodible node sets, only to the erodible
+  // nodes (2). The indicator only changes with the mesh, by erosion, so
+  // the lists are valid until the next updateMesh.
+  auto const has_nbi = hasNodeBoundaryIndicator();
+  nodeSetActiveNodes.clear();
+  for (auto const& ns : nodeSetGIDs) {
+    auto const& ns_id       = ns.first;
+    auto const& ns_gids     = ns.second;
+    auto const  is_erodible = ns_id.find("erodible") != std::string::npos;
+    auto&       active      = nodeSetActiveNodes[ns_id];
+    active.reserve(ns_gids.size());
+    for (int ns_node = 0; ns_node < ns_gids.size(); ++ns_node) {
+      if (has_nbi == true) {
+        auto const it = node_boundary_indicator.find(ns_gids[ns_node] + 1);
+        if (it == node_boundary_indicator.end()) continue;
+        auto const nbi = *(it->second);
+        if (is_erodible == true && nbi != 2.0) continue;
+        if (nbi == 0.0) continue;
+      }
+      active.push_back(ns_node);
+    }
+  }
 }
 
 void
@@ -172,6 +172,13 @@ class STKDiscretization : public AbstractDiscretization
   {
     return node_GID_2_LID_map;
   }
+  //! Positions in each node set of the nodes where Dirichlet conditions
+  //! apply, according to the node boundary indicator. Rebuilt by updateMesh.
+  NodeSetActiveNodesList const&
+  getNodeSetActiveNodes() const
+  {
+    return nodeSetActiveNodes;
+  }
 
   NodeSetList&
   getNodeSets()
@@ -232,6 +239,13 @@ class STKDiscretization : public AbstractDiscretization
     return wsElNodeID;
   }
 
+  //! Get element coloring per workset
+  const Coloring&
+  getWsElColoring() const
+  {
+    return wsElColoring;
+  }
+
   //! Get IDArray for (Ws, Local Node, nComps) -> (local) NodeLID, works for
   //! both scalar and vector fields
   std::vector<IDArray> const&
@@ -616,9 +630,16 @@ class STKDiscretization : public AbstractDiscretization
   //! Process STK mesh for Workset/Bucket Info
   void
   computeWorksetInfo();
+  //! Color the elements of each workset so that no two elements of a color
+  //! share a node
+  void
+  computeWorksetColoring();
   //! Process STK mesh for NodeSets
   void
   computeNodeSets();
+  //! Filter the node sets by the node boundary indicator
+  void
+  computeNodeSetActiveNodes();
   //! Process STK mesh for SideSets
   void
   computeSideSets();
@@ -684,6 +705,8 @@ class STKDiscretization : public AbstractDiscretization
   NodeSetCoordList nodeSetCoords;
   NodeGID2LIDMap   node_GID_2_LID_map;
 
+  NodeSetActiveNodesList nodeSetActiveNodes;
+
   //! side sets stored as std::map(string ID, SideArray classes) per workset
   //! (std::vector across worksets)
   std::vector<SideSetList> sideSets;
@@ -694,6 +717,9 @@ class STKDiscretization : public AbstractDiscretization
   //! Connectivity array [workset, element, local-node] => GID
   WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>>::type wsElNodeID;
 
+  //! Element coloring [workset], used for atomic-free scatter
+  Coloring wsElColoring;
+
   mutable Teuchos::ArrayRCP<double>                                 coordinates;
   Teuchos::RCP<Thyra_MultiVector>                                   coordMV;
   WorksetArray<std::string>::type                                   wsEBNames;
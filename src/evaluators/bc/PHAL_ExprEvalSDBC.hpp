@@ -5,6 +5,7 @@
 #if !defined(PHAL_ExprEvalSDBC_hpp)
 #define PHAL_ExprEvalSDBC_hpp
 
+#include "Albany_Expression.hpp"
 #include "Albany_ThyraTypes.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
@@ -36,6 +37,7 @@ class ExprEvalSDBC<PHAL::AlbanyTraits::Residual, Traits> : public PHAL::Dirichle
 
   ExprEvalSDBC(Teuchos::ParameterList& p);
 
+  //! Evaluate the expression at the active nodes of the node set at once
   void
   preEvaluate(typename Traits::EvalData d);
 
@@ -43,7 +45,8 @@ class ExprEvalSDBC<PHAL::AlbanyTraits::Residual, Traits> : public PHAL::Dirichle
   evaluateFields(typename Traits::EvalData d);
 
  protected:
-  std::string expression{""};
+  Teuchos::RCP<Albany::Expression> expression;
+  std::vector<double>              values;  // at the active nodes
 };
 
 // Jacobian
@@ -55,15 +58,9 @@ class ExprEvalSDBC<PHAL::AlbanyTraits::Jacobian, Traits> : public PHAL::Dirichle
 
   ExprEvalSDBC(Teuchos::ParameterList& p);
 
+  //! The Jacobian is modified by PHAL::applySDBCs
   void
   evaluateFields(typename Traits::EvalData d);
-
-  void
-  set_row_and_col_is_dbc(typename Traits::EvalData d);
-
- protected:
-  Teuchos::RCP<Thyra_Vector> row_is_dbc_{Teuchos::null};
-  Teuchos::RCP<Thyra_Vector> col_is_dbc_{Teuchos::null};
 };
 
 }  // namespace PHAL
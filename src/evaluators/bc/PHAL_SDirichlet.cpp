@@ -2,7 +2,55 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include "Albany_CombineAndScatterManager.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_SDirichlet_Def.hpp"
 
 PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::SDirichlet)
+
+namespace PHAL {
+
+Teuchos::ArrayRCP<ST>
+getSDBCDofs(Workset& workset)
+{
+  if (workset.sdbc_dofs == Teuchos::null) {
+    workset.sdbc_dofs = Thyra::createMember(workset.Jac->range());
+    workset.sdbc_dofs->assign(0.0);
+  }
+  return Albany::getNonconstLocalData(workset.sdbc_dofs);
+}
+
+void
+applySDBCs(Workset& workset)
+{
+  if (workset.sdbc_dofs == Teuchos::null) return;
+
+  // The columns of the SDBC DOFs, from the owners
+  auto J          = workset.Jac;
+  auto col_vs     = Albany::getColumnSpace(J);
+  auto col_is_dbc = Thyra::createMember(col_vs);
+  col_is_dbc->assign(0.0);
+  auto cas_manager = Albany::createCombineAndScatterManager(J->range(), col_vs);
+  cas_manager->scatter(workset.sdbc_dofs, col_is_dbc, Albany::CombineMode::INSERT);
+
+  auto const row_is_dbc_data = Albany::getDeviceData(workset.sdbc_dofs.getConst());
+  auto const col_is_dbc_data = Albany::getDeviceData(col_is_dbc.getConst());
+  auto       jac             = Albany::getNonconstDeviceData(J);
+
+  using ExecutionSpace = PHX::Device::execution_space;
+  Kokkos::parallel_for(
+      "PHAL::applySDBCs", Kokkos::RangePolicy<ExecutionSpace>(0, jac.numRows()), KOKKOS_LAMBDA(LO const local_row) {
+        auto       row        = jac.row(local_row);
+        bool const row_is_dbc = row_is_dbc_data(local_row) > 0;
+        for (LO entry = 0; entry < row.length; ++entry) {
+          LO const local_col = row.colidx(entry);
+          if (local_col == local_row) continue;
+          if (row_is_dbc || col_is_dbc_data(local_col) > 0) row.value(entry) = 0.0;
+        }
+      });
+  cudaCheckError();
+
+  workset.sdbc_dofs = Teuchos::null;
+}
+
+}  // namespace PHAL
@@ -52,16 +52,22 @@ class SDirichlet<PHAL::AlbanyTraits::Jacobian, Traits> : public PHAL::DirichletB
 
   SDirichlet(Teuchos::ParameterList& p);
 
+  //! Sets the residual and the solution at the DOFs of the condition and
+  //! marks them in workset.sdbc_dofs. The Jacobian is modified by
+  //! applySDBCs, once for all the conditions.
   void
   evaluateFields(typename Traits::EvalData d);
+};
 
-  void
-  set_row_and_col_is_dbc(typename Traits::EvalData d);
+//! Local data of workset.sdbc_dofs, created on the first call of a fill
+Teuchos::ArrayRCP<ST>
+getSDBCDofs(Workset& workset);
 
- protected:
-  Teuchos::RCP<Thyra_Vector> row_is_dbc_;
-  Teuchos::RCP<Thyra_Vector> col_is_dbc_;
-};
+//! Zero the off-diagonal entries of the rows and columns of the Jacobian of
+//! all the DOFs marked in workset.sdbc_dofs, in a single pass over the
+//! local matrix. Call after the Dirichlet field manager.
+void
+applySDBCs(Workset& workset);
 
 }  // namespace PHAL
 
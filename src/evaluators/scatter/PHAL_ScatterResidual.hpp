@@ -53,6 +53,7 @@ class ScatterResidualBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PH
 
  protected:
   Albany::WorksetConn                                                          nodeID;
+  Kokkos::View<int*, PHX::Device>                                              elements;  // workset elements grouped by color
   Albany::DeviceView1d<ST>                                                     f_kokkos;
   Kokkos::vector<Kokkos::DynRankView<ScalarT const, PHX::Device>, PHX::Device> val_kokkos;
 };
@@ -122,18 +123,19 @@ class ScatterResidual<PHAL::AlbanyTraits::Residual, Traits> : public ScatterResi
 
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank0_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank0_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank1_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank1_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank2_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank2_Tag&, const int& index) const;
 
  private:
   int numDims;
 
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Residual, Traits> Base;
+  using Base::elements;
   using Base::f_kokkos;
   using Base::nodeID;
   using Base::val_kokkos;
@@ -192,39 +194,44 @@ class ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits> : public ScatterResi
 
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank0_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank0_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank0_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank0_Tag&, const int& index) const;
 
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank1_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank1_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank1_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank1_Tag&, const int& index) const;
 
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterResRank2_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterResRank2_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& index) const;
   KOKKOS_INLINE_FUNCTION
   void
-  operator()(const PHAL_ScatterJacRank2_Tag&, const int& cell) const;
+  operator()(const PHAL_ScatterJacRank2_Tag&, const int& index) const;
 
  private:
   int                           neq, nunk, numDims;
   Albany::DeviceLocalMatrix<ST> Jac_kokkos;
 
+  // Per-cell column LIDs and derivative values for whole-row sumIntoValues
+  Kokkos::View<LO**, Kokkos::LayoutRight, PHX::Device> colScratch;
+  Kokkos::View<ST**, Kokkos::LayoutRight, PHX::Device> valScratch;
+
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
+  using Base::elements;
   using Base::f_kokkos;
   using Base::nodeID;
   using Base::val_kokkos;
@@ -101,6 +101,18 @@ ScatterResidualBase<EvalT, Traits>::postRegistrationSetup(typename Traits::Setup
   }
   d.fill_field_dependencies(this->dependentFields(), this->evaluatedFields());
 }
+// **********************************************************************
+// Launch one kernel per element color. Elements of the same color share no
+// nodes, so the kernels write to the residual and Jacobian without atomics.
+template <typename Policy, typename Functor>
+void
+parallelForEachColor(Albany::WorksetColoring const& coloring, Functor const& functor)
+{
+  for (int color = 0; color < coloring.numColors(); ++color) {
+    Kokkos::parallel_for(Policy(coloring.offsets[color], coloring.offsets[color + 1]), functor);
+    cudaCheckError();
+  }
+}
 
 // **********************************************************************
 // Specialization: Residual
@@ -115,35 +127,38 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::ScatterResidual(Teuchos::
 // Kokkos kernels
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank0_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank0_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), val_kokkos[eq](cell, node));
+      f_kokkos(id) += val_kokkos[eq](cell, node);
     }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank1_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank1_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), this->valVec(cell, node, eq));
+      f_kokkos(id) += this->valVec(cell, node, eq);
     }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank2_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_ScatterResRank2_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
         const LO id = nodeID(cell, node, this->offset + i * numDims + j);
-        Kokkos::atomic_fetch_add(&f_kokkos(id), this->valTensor(cell, node, i, j));
+        f_kokkos(id) += this->valTensor(cell, node, i, j);
       }
 }
 
@@ -158,7 +173,9 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename T
   auto start = std::chrono::high_resolution_clock::now();
 #endif
   // Get map for local data structures
-  nodeID = workset.wsElNodeEqID;
+  nodeID   = workset.wsElNodeEqID;
+  elements = workset.wsElColoring.elements;
+  ALBANY_ASSERT(workset.numCells == 0 || workset.wsElColoring.numColors() > 0, "Error! ScatterResidual requires an element coloring of the workset.\n");
 
   // Get Tpetra vector view from a specific device
   f_kokkos = Albany::getNonconstDeviceData(f);
@@ -167,15 +184,12 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename T
     // Get MDField views from std::vector
     for (int i = 0; i < numFields; i++) val_kokkos[i] = this->val[i].get_view();
 
-    Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    parallelForEachColor<PHAL_ScatterResRank0_Policy>(workset.wsElColoring, *this);
   } else if (this->tensorRank == 1) {
-    Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    parallelForEachColor<PHAL_ScatterResRank1_Policy>(workset.wsElColoring, *this);
   } else if (this->tensorRank == 2) {
     numDims = this->valTensor.extent(2);
-    Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    parallelForEachColor<PHAL_ScatterResRank2_Policy>(workset.wsElColoring, *this);
   }
 
 #if defined(ALBANY_TIMER)
@@ -199,63 +213,54 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::ScatterResidual(Teuchos::
 
 // **********************************************************************
 // Kokkos kernels
+//
+// The element's column LIDs and a row of derivatives are staged in the
+// per-cell rows of colScratch/valScratch, which are sized to nunk, and each
+// Jacobian row is summed into with a single call.
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank0_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank0_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), (val_kokkos[eq](cell, node)).val());
+      f_kokkos(id) += (val_kokkos[eq](cell, node)).val();
     }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank0_Adjoint_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank0_Adjoint_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO col[500];
-  LO row;
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
+  int const nrow = this->numNodes * numFields;
 
-  for (int node_col = 0; node_col < this->numNodes; node_col++) {
-    for (int eq_col = 0; eq_col < neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell, node_col, eq_col);
+  // In the adjoint the element residual rows are the columns.
+  for (int node = 0; node < this->numNodes; ++node) {
+    for (int eq = 0; eq < numFields; eq++) {
+      col[numFields * node + eq] = nodeID(cell, node, this->offset + eq);
     }
   }
 
-  for (int node = 0; node < this->numNodes; ++node) {
-    for (int eq = 0; eq < numFields; eq++) {
-      row         = nodeID(cell, node, this->offset + eq);
-      auto valptr = val_kokkos[eq](cell, node);
-      for (int lunk = 0; lunk < nunk; lunk++) {
-        ST val = valptr.fastAccessDx(lunk);
-        Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
-      }
+  for (int lunk = 0; lunk < nunk; lunk++) {
+    const LO row = nodeID(cell, lunk / neq, lunk % neq);
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) vals[numFields * node + eq] = val_kokkos[eq](cell, node).fastAccessDx(lunk);
     }
+    Jac_kokkos.sumIntoValues(row, col, nrow, vals, false, false);
   }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank0_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank0_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO row;
-  LO col[500];
-  ST vals[500];
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
 
   for (int node_col = 0; node_col < this->numNodes; node_col++) {
     for (int eq_col = 0; eq_col < neq; eq_col++) {
@@ -265,73 +270,62 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      row         = nodeID(cell, node, this->offset + eq);
-      auto valptr = val_kokkos[eq](cell, node);
-      for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
-      Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+      const LO row    = nodeID(cell, node, this->offset + eq);
+      auto     valptr = val_kokkos[eq](cell, node);
+      for (int lunk = 0; lunk < nunk; ++lunk) vals[lunk] = valptr.fastAccessDx(lunk);
+      Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, false);
     }
   }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank1_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank1_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++) {
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valVec(cell, node, eq)).val());
+      f_kokkos(id) += (this->valVec(cell, node, eq)).val();
     }
   }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank1_Adjoint_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank1_Adjoint_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO col[500];
-  LO row;
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
+  int const nrow = this->numNodes * numFields;
 
-  for (int node_col = 0; node_col < this->numNodes; node_col++) {
-    for (int eq_col = 0; eq_col < neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell, node_col, eq_col);
+  // In the adjoint the element residual rows are the columns.
+  for (int node = 0; node < this->numNodes; ++node) {
+    for (int eq = 0; eq < numFields; eq++) {
+      col[numFields * node + eq] = nodeID(cell, node, this->offset + eq);
     }
   }
 
-  for (int node = 0; node < this->numNodes; ++node) {
-    for (int eq = 0; eq < numFields; eq++) {
-      row = nodeID(cell, node, this->offset + eq);
-      if (((this->valVec)(cell, node, eq)).hasFastAccess()) {
-        for (int lunk = 0; lunk < nunk; lunk++) {
-          ST val = ((this->valVec)(cell, node, eq)).fastAccessDx(lunk);
-          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
-        }
-      }  // has fast access
+  for (int lunk = 0; lunk < nunk; lunk++) {
+    const LO row = nodeID(cell, lunk / neq, lunk % neq);
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto const& valref          = (this->valVec)(cell, node, eq);
+        vals[numFields * node + eq] = valref.hasFastAccess() ? valref.fastAccessDx(lunk) : 0.0;
+      }
     }
+    Jac_kokkos.sumIntoValues(row, col, nrow, vals, false, false);
   }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank1_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank1_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO col[500];
-  LO row;
-  ST vals[500];
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
 
   for (int node_col = 0; node_col < this->numNodes; node_col++) {
     for (int eq_col = 0; eq_col < neq; eq_col++) {
@@ -341,10 +335,10 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      row = nodeID(cell, node, this->offset + eq);
+      const LO row = nodeID(cell, node, this->offset + eq);
       if (((this->valVec)(cell, node, eq)).hasFastAccess()) {
-        for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell, node, eq).fastAccessDx(i);
-        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+        for (int lunk = 0; lunk < nunk; ++lunk) vals[lunk] = (this->valVec)(cell, node, eq).fastAccessDx(lunk);
+        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, false);
       }
     }
   }
@@ -352,63 +346,52 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank2_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterResRank2_Tag&, int const& index) const
 {
+  int const cell = elements(index);
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
         const LO id = nodeID(cell, node, this->offset + i * numDims + j);
-        Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valTensor(cell, node, i, j)).val());
+        f_kokkos(id) += (this->valTensor(cell, node, i, j)).val();
       }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank2_Adjoint_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank2_Adjoint_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO col[500];
-  LO row;
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
+  int const nrow = this->numNodes * numFields;
 
-  for (int node_col = 0; node_col < this->numNodes; node_col++) {
-    for (int eq_col = 0; eq_col < neq; eq_col++) {
-      col[neq * node_col + eq_col] = nodeID(cell, node_col, eq_col);
+  // In the adjoint the element residual rows are the columns.
+  for (int node = 0; node < this->numNodes; ++node) {
+    for (int eq = 0; eq < numFields; eq++) {
+      col[numFields * node + eq] = nodeID(cell, node, this->offset + eq);
     }
   }
 
-  for (int node = 0; node < this->numNodes; ++node) {
-    for (int eq = 0; eq < numFields; eq++) {
-      row = nodeID(cell, node, this->offset + eq);
-      if (((this->valTensor)(cell, node, eq / numDims, eq % numDims)).hasFastAccess()) {
-        for (int lunk = 0; lunk < nunk; lunk++) {
-          ST val = ((this->valTensor)(cell, node, eq / numDims, eq % numDims)).fastAccessDx(lunk);
-          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
-        }
-      }  // has fast access
+  for (int lunk = 0; lunk < nunk; lunk++) {
+    const LO row = nodeID(cell, lunk / neq, lunk % neq);
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto const& valref          = (this->valTensor)(cell, node, eq / numDims, eq % numDims);
+        vals[numFields * node + eq] = valref.hasFastAccess() ? valref.fastAccessDx(lunk) : 0.0;
+      }
     }
+    Jac_kokkos.sumIntoValues(row, col, nrow, vals, false, false);
   }
 }
 
 template <typename Traits>
 KOKKOS_INLINE_FUNCTION void
-ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank2_Tag&, int const& cell) const
+ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_ScatterJacRank2_Tag&, int const& index) const
 {
-  // int const neq = nodeID.extent(2);
-  // int const nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO col[500];
-  LO row;
-  ST vals[500];
-
-  if (nunk > 500) {
-    Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-  }
+  int const cell = elements(index);
+  LO*       col  = &colScratch(cell, 0);
+  ST*       vals = &valScratch(cell, 0);
 
   for (int node_col = 0; node_col < this->numNodes; node_col++) {
     for (int eq_col = 0; eq_col < neq; eq_col++) {
@@ -418,10 +401,10 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      row = nodeID(cell, node, this->offset + eq);
+      const LO row = nodeID(cell, node, this->offset + eq);
       if (((this->valTensor)(cell, node, eq / numDims, eq % numDims)).hasFastAccess()) {
-        for (int i = 0; i < nunk; ++i) vals[i] = (this->valTensor)(cell, node, eq / numDims, eq % numDims).fastAccessDx(i);
-        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+        for (int lunk = 0; lunk < nunk; ++lunk) vals[lunk] = (this->valTensor)(cell, node, eq / numDims, eq % numDims).fastAccessDx(lunk);
+        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, false);
       }
     }
   }
@@ -436,12 +419,20 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
   auto start = std::chrono::high_resolution_clock::now();
 #endif
   // Get map for local data structures
-  nodeID = workset.wsElNodeEqID;
+  nodeID   = workset.wsElNodeEqID;
+  elements = workset.wsElColoring.elements;
+  ALBANY_ASSERT(workset.numCells == 0 || workset.wsElColoring.numColors() > 0, "Error! ScatterResidual requires an element coloring of the workset.\n");
 
   // Get dimensions
   neq  = nodeID.extent(2);
   nunk = neq * this->numNodes;
 
+  // Per-cell scratch rows, grown as needed (nunk >= numNodes * numFields)
+  if (colScratch.extent(0) < static_cast<std::size_t>(workset.numCells) || colScratch.extent(1) < static_cast<std::size_t>(nunk)) {
+    colScratch = Kokkos::View<LO**, Kokkos::LayoutRight, PHX::Device>("ScatterResidual colScratch", workset.numCells, nunk);
+    valScratch = Kokkos::View<ST**, Kokkos::LayoutRight, PHX::Device>("ScatterResidual valScratch", workset.numCells, nunk);
+  }
+
   // Get Kokkos vector view and local matrix
   bool const loadResid = Teuchos::nonnull(workset.f);
   if (loadResid) {
@@ -449,48 +440,41 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
   }
   Jac_kokkos = workset.Jac_kokkos;
 
+  auto const& coloring = workset.wsElColoring;
   if (this->tensorRank == 0) {
     // Get MDField views from std::vector
     for (int i = 0; i < numFields; i++) val_kokkos[i] = this->val[i].get_view();
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterResRank0_Policy>(coloring, *this);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Adjoint_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterJacRank0_Adjoint_Policy>(coloring, *this);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterJacRank0_Policy>(coloring, *this);
     }
   } else if (this->tensorRank == 1) {
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterResRank1_Policy>(coloring, *this);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Adjoint_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterJacRank1_Adjoint_Policy>(coloring, *this);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterJacRank1_Policy>(coloring, *this);
     }
   } else if (this->tensorRank == 2) {
     numDims = this->valTensor.extent(2);
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterResRank2_Policy>(coloring, *this);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Adjoint_Policy(0, workset.numCells), *this);
+      parallelForEachColor<PHAL_ScatterJacRank2_Adjoint_Policy>(coloring, *this);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      parallelForEachColor<PHAL_ScatterJacRank2_Policy>(coloring, *this);
     }
   }
 
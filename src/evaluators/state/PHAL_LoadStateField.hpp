@@ -30,6 +30,18 @@ class LoadStateFieldBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX
   void
   evaluateFields(typename Traits::EvalData d);
 
+  //! The field loaded, and the state it is loaded from
+  PHX::FieldTag const&
+  getFieldTag() const
+  {
+    return data.fieldTag();
+  }
+  std::string const&
+  getStateName() const
+  {
+    return stateName;
+  }
+
  private:
   PHX::MDField<ScalarType> data;
   std::string              fieldName;
@@ -48,6 +60,18 @@ class LoadStateField : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::Ev
   void
   evaluateFields(typename Traits::EvalData d);
 
+  //! The field loaded, and the state it is loaded from
+  PHX::FieldTag const&
+  getFieldTag() const
+  {
+    return data.fieldTag();
+  }
+  std::string const&
+  getStateName() const
+  {
+    return stateName;
+  }
+
  private:
   typedef typename EvalT::ParamScalarT ParamScalarT;
 
@@ -3,10 +3,12 @@
 // in the file license.txt in the top-level Albany directory.
 
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "Albany_Macros.hpp"
 #include "PHAL_LoadStateField.hpp"
+#include "PHAL_StateFieldBinder.hpp"
 #include "PHAL_Utilities.hpp"
 #include "Phalanx_DataLayout.hpp"
 
@@ -40,7 +42,13 @@ template <typename EvalT, typename Traits, typename ScalarType>
 void
 LoadStateFieldBase<EvalT, Traits, ScalarType>::evaluateFields(typename Traits::EvalData workset)
 {
-  const Albany::MDArray&            stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
+
+  // Nothing to copy if the field is bound to the state (StateFieldBinder)
+  bool const in_place = isBoundToState(data, stateToLoad);
+  if (std::is_same<EvalT, AlbanyTraits::Residual>::value == true) countStateField(in_place);
+  if (in_place == true) return;
+
   PHAL::MDFieldIterator<ScalarType> d(data);
   for (int i = 0; !d.done() && i < stateToLoad.size(); ++d, ++i) *d = stateToLoad[i];
   for (; !d.done(); ++d) *d = 0.;
@@ -77,7 +85,13 @@ LoadStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   // cout << "LoadStateField importing state " << stateName << " to field "
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray&              stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
+
+  // Nothing to copy if the field is bound to the state (StateFieldBinder)
+  bool const in_place = isBoundToState(data, stateToLoad);
+  if (std::is_same<EvalT, AlbanyTraits::Residual>::value == true) countStateField(in_place);
+  if (in_place == true) return;
+
   PHAL::MDFieldIterator<ParamScalarT> d(data);
   for (int i = 0; !d.done() && i < stateToLoad.size(); ++d, ++i) *d = stateToLoad[i];
   for (; !d.done(); ++d) *d = 0.;
@@ -47,6 +47,25 @@ class SaveStateField<PHAL::AlbanyTraits::Residual, Traits> : public PHX::Evaluat
   void
   evaluateFields(typename Traits::EvalData d);
 
+  //! The field saved, and the state it is saved to
+  PHX::FieldTag const&
+  getFieldTag() const
+  {
+    return field.fieldTag();
+  }
+  std::string const&
+  getStateName() const
+  {
+    return stateName;
+  }
+
+  //! True for a state of the cells of the workset (not nodal or per workset)
+  bool
+  isElemState() const
+  {
+    return nodalState == false && worksetState == false;
+  }
+
  private:
   void
   saveElemState(typename Traits::EvalData d);
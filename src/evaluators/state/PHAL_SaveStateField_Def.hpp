@@ -7,6 +7,7 @@
 #include "Albany_AbstractSTKMeshStruct.hpp"
 #include "Albany_Macros.hpp"
 #include "PHAL_SaveStateField.hpp"
+#include "PHAL_StateFieldBinder.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_DataLayout_MDALayout.hpp"
 
@@ -104,6 +105,11 @@ SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::saveElemState(typename Tra
 
   ALBANY_PANIC((it == workset.stateArrayPtr->end()), std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
+  // Nothing to copy if the field is bound to the state (StateFieldBinder)
+  bool const in_place = isBoundToState(field, it->second);
+  countStateField(in_place);
+  if (in_place == true) return;
+
   Albany::MDArray                         sta = it->second;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
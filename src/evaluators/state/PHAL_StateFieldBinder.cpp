@@ -0,0 +1,119 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "PHAL_StateFieldBinder.hpp"
+
+#include <algorithm>
+
+#include "Albany_Macros.hpp"
+#include "PHAL_LoadStateField.hpp"
+#include "PHAL_SaveStateField.hpp"
+#include "utility/PerformanceContext.hpp"
+
+namespace PHAL {
+
+namespace {
+
+using Residual = AlbanyTraits::Residual;
+using Layout   = typename PHX::DevLayout<RealType>::type;
+
+// The state arrays are host arrays in natural (row major) order
+constexpr bool binding_supported = Kokkos::SpaceAccessibility<Kokkos::HostSpace, PHX::Device::memory_space>::accessible &&
+                                   std::is_same<Layout, Kokkos::LayoutRight>::value;
+
+// Unmanaged view of data, of the static rank type that the field manager
+// allocates for a field of these dimensions (PHX::KokkosViewFactory)
+PHX::any
+stateView(double* data, std::vector<PHX::DataLayout::size_type> const& dims)
+{
+  switch (dims.size()) {
+    case 1: return PHX::any(Kokkos::View<RealType*, Layout, PHX::Device>(data, dims[0]));
+    case 2: return PHX::any(Kokkos::View<RealType**, Layout, PHX::Device>(data, dims[0], dims[1]));
+    case 3: return PHX::any(Kokkos::View<RealType***, Layout, PHX::Device>(data, dims[0], dims[1], dims[2]));
+    case 4: return PHX::any(Kokkos::View<RealType****, Layout, PHX::Device>(data, dims[0], dims[1], dims[2], dims[3]));
+    case 5: return PHX::any(Kokkos::View<RealType*****, Layout, PHX::Device>(data, dims[0], dims[1], dims[2], dims[3], dims[4]));
+    default: ALBANY_ABORT("Error in PHAL::StateFieldBinder: unexpected rank " << dims.size() << ".\n");
+  }
+  return PHX::any();
+}
+
+}  // anonymous namespace
+
+StateFieldBinder::StateFieldBinder(PHX::FieldManager<AlbanyTraits>& fm) : fm_(&fm)
+{
+  if (binding_supported == false) return;
+
+  // The evaluators that run, in evaluation order
+  auto const& dag = fm.getDagManager<Residual>();
+  for (int const index : dag.getEvaluatorInternalOrdering()) {
+    auto const* evaluator = dag.getDagNodes()[index].get().get();
+    if (auto const* save = dynamic_cast<SaveStateField<Residual, AlbanyTraits> const*>(evaluator)) {
+      if (save->isElemState() == true) addBinding(save->getFieldTag(), save->getStateName());
+    } else if (auto const* load = dynamic_cast<LoadStateField<Residual, AlbanyTraits> const*>(evaluator)) {
+      addBinding(load->getFieldTag(), load->getStateName());
+    } else if (auto const* load_base = dynamic_cast<LoadStateFieldRT<Residual, AlbanyTraits> const*>(evaluator)) {
+      addBinding(load_base->getFieldTag(), load_base->getStateName());
+    }
+  }
+}
+
+void
+StateFieldBinder::addBinding(PHX::FieldTag const& tag, std::string const& state)
+{
+  // A field saved to two states is bound to the first one only
+  bool const is_bound = std::any_of(
+      bindings_.begin(), bindings_.end(), [&tag](Binding const& binding) { return binding.own.fieldTag().identifier() == tag.identifier(); });
+  if (is_bound == true) return;
+
+  Binding binding{state, PHX::MDField<RealType>(tag.clone()), nullptr};
+  fm_->getFieldData<Residual>(binding.own);
+  bindings_.push_back(binding);
+}
+
+void
+StateFieldBinder::bind(Albany::StateArray& states)
+{
+  for (auto& binding : bindings_) {
+    auto it = states.find(binding.state);
+    ALBANY_PANIC(it == states.end(), "Error in PHAL::StateFieldBinder: cannot locate state " << binding.state << ".\n");
+
+    std::vector<PHX::DataLayout::size_type> field_dims, state_dims;
+    binding.own.fieldTag().dataLayout().dimensions(field_dims);
+    it->second.dimensions(state_dims);
+
+    double* const data = field_dims == state_dims ? it->second.contiguous_data() : nullptr;
+    if (data != binding.bound) bindTo(binding, data);
+  }
+}
+
+void
+StateFieldBinder::bindTo(Binding& binding, double* data)
+{
+  binding.bound = data;
+  if (data == nullptr) {
+    fm_->setUnmanagedField<Residual>(binding.own);
+    return;
+  }
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  binding.own.fieldTag().dataLayout().dimensions(dims);
+
+  // A copy of the field with the memory of the state. Phalanx binds the
+  // field to it in all the evaluators of the field manager.
+  PHX::MDField<RealType> field = binding.own;
+  field.setFieldData(stateView(data, dims));
+  fm_->setUnmanagedField<Residual>(field);
+}
+
+void
+countStateField(bool const in_place)
+{
+  auto& counters = util::PerformanceContext::instance().counterMonitor();
+  if (in_place == true)
+    counters["Albany State Fields: In Place"]->increment();
+  else
+    counters["Albany State Fields: Copied"]->increment();
+}
+
+}  // namespace PHAL
@@ -0,0 +1,90 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef PHAL_STATE_FIELD_BINDER_HPP
+#define PHAL_STATE_FIELD_BINDER_HPP
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Albany_StateInfoStruct.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Phalanx_MDField.hpp"
+
+namespace PHAL {
+
+//! Binds the Residual fields that a field manager saves to, or loads from,
+//! element states to the memory of the states of each workset.
+//!
+//! SaveStateField and LoadStateField copy between a field and the state
+//! arrays of the workset at every evaluation. Bound to the state array of
+//! the workset instead, a saved field is written in place by the evaluator
+//! of the field, a loaded field is read in place, and both SaveStateField
+//! and LoadStateField copy nothing. A field is only bound to a state array
+//! of its exact dimensions: in a workset with fewer cells than the workset
+//! size, the field keeps its own memory and is copied as before. Nothing is
+//! bound if the memory of PHX::Device is not host memory.
+//!
+//! The states of each workset are separate arrays, so a field is bound
+//! again when the workset changes, and only then: with one workset per
+//! element block the fields are bound once for the whole run. Binding a
+//! field sets one view in each evaluator of the field, whatever the number
+//! of cells, where the copy it replaces touches every entry of the field.
+class StateFieldBinder
+{
+ public:
+  //! Call after postRegistrationSetup of the Residual type of fm
+  explicit StateFieldBinder(PHX::FieldManager<AlbanyTraits>& fm);
+
+  //! Bind the fields to the states of a workset, before evaluating it. The
+  //! fields stay bound until the next call.
+  void
+  bind(Albany::StateArray& states);
+
+  int
+  size() const
+  {
+    return bindings_.size();
+  }
+
+ private:
+  struct Binding
+  {
+    std::string            state;
+    PHX::MDField<RealType> own;    // memory allocated for the field
+    double*                bound;  // state bound to, null for own
+  };
+
+  void
+  bindTo(Binding& binding, double* data);
+
+  void
+  addBinding(PHX::FieldTag const& tag, std::string const& state);
+
+  PHX::FieldManager<AlbanyTraits>* fm_;
+  std::vector<Binding>             bindings_;
+};
+
+//! True if field is bound to the memory of state, in which case there is
+//! nothing to copy between the two
+template <typename Field>
+bool
+isBoundToState(Field const& field, Albany::MDArray const& state)
+{
+  using DataT = typename std::remove_const<typename Field::value_type>::type;
+  if (std::is_same<DataT, RealType>::value == false || state.size() == 0) return false;
+  return static_cast<void const*>(field.get_view().data()) == static_cast<void const*>(state.contiguous_data());
+}
+
+//! Count a Residual evaluation of a state field that was bound to the state
+//! (counter "Albany State Fields: In Place") or copied to or from it
+//! ("Albany State Fields: Copied")
+void
+countStateField(bool const in_place);
+
+}  // namespace PHAL
+
+#endif  // PHAL_STATE_FIELD_BINDER_HPP
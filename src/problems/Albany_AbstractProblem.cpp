@@ -157,6 +157,31 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
       false,
       "Ignore residual calculations while computing the Jacobian (only "
       "generally appropriate for linear problems)");
+  validPL->set<bool>(
+      "Reuse Residual From Jacobian Fill",
+      false,
+      "Return the residual computed by the last Jacobian fill when a residual "
+      "is requested at the same solution, time and parameters");
+  validPL->set<bool>(
+      "Capture States From Residual",
+      false,
+      "Save the states in every residual fill, so that the last one of a "
+      "converged solve provides them, instead of a separate state evaluation "
+      "per step. Valid when the last residual of a step is at its solution");
+  validPL->set<bool>(
+      "Bind States In Place",
+      false,
+      "Evaluate the fields saved to or loaded from element states directly "
+      "in the memory of the states, instead of copying them");
+  validPL->set<bool>(
+      "Evaluator Timings",
+      false,
+      "Time every evaluator and report the minimum, mean and maximum over "
+      "processes at the end of the run. Host times, not fenced");
+  validPL->set<std::string>(
+      "Evaluator Timings Trace File",
+      "evaluator_timings.json",
+      "Chrome trace of the evaluator times at every step, empty for none");
   validPL->set<double>(
       "Perturb Dirichlet",
       0.0,
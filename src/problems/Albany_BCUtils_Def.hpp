@@ -1450,7 +1450,7 @@ Albany::DirichletTraits::getValidBCParameters(std::vector<std::string> const& no
       std::string sst = Albany::DirichletTraits::constructScaledSDBCName(nodeSetIDs[i], bcNames[j]);
       validPL->set<double>(ss, 0.0, "Value of BC corresponding to nodeSetID and dofName");
       validPL->set<double>(st, 0.0, "Value of SDBC corresponding to nodeSetID and dofName");
-      validPL->set<std::string>(ee, "0.0", "Expression of SDBC corresponding to nodeSetID and dofName");
+      validPL->set<std::string>(ee, "0.0", "Expression in x, y, z and t of SDBC corresponding to nodeSetID and dofName, see Albany::Expression. Unknown names are errors");
       Teuchos::Array<double> array(1);
       array[0] = 0.0;
       validPL->set<Teuchos::Array<double>>(sst, array, "Value of Scaled SDBC corresponding to nodeSetID and dofName");
@@ -1,8 +1,15 @@
 #include "Albany_CombineAndScatterManagerTpetra.hpp"
 
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "Albany_KokkosTypes.hpp"
 #include "Albany_Macros.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_TpetraThyraUtils.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 namespace {
 Tpetra::CombineMode
@@ -19,6 +26,11 @@ combineModeT(const Albany::CombineMode modeA)
   return modeT;
 }
 
+// Tags of the messages of the matrix combine
+int const matrix_sizes_tag   = 3401;
+int const matrix_entries_tag = 3402;
+int const matrix_values_tag  = 3403;
+
 }  // anonymous namespace
 
 namespace Albany {
@@ -98,6 +110,10 @@ CombineAndScatterManagerTpetra::combine(const Thyra_LinearOp& src, Thyra_LinearO
   auto srcT = Albany::getConstTpetraMatrix(src);
   auto dstT = Albany::getTpetraMatrix(dst);
 
+  if (CM == CombineMode::ADD && srcT->isStaticGraph() && dstT->isStaticGraph()) {
+    combineMatrix(*srcT, *dstT);
+    return;
+  }
   dstT->doExport(*srcT, *importer, cmT);
 }
 
@@ -162,11 +178,7 @@ CombineAndScatterManagerTpetra::combine(const Teuchos::RCP<const Thyra_MultiVect
 void
 CombineAndScatterManagerTpetra::combine(const Teuchos::RCP<const Thyra_LinearOp>& src, const Teuchos::RCP<Thyra_LinearOp>& dst, const CombineMode CM) const
 {
-  auto cmT  = combineModeT(CM);
-  auto srcT = Albany::getConstTpetraMatrix(src);
-  auto dstT = Albany::getTpetraMatrix(dst);
-
-  dstT->doExport(*srcT, *importer, cmT);
+  combine(*src, *dst, CM);
 }
 
 // Scatter methods
@@ -305,6 +317,253 @@ CombineAndScatterManagerTpetra::scatter(const Teuchos::RCP<const Thyra_LinearOp>
   dstT->doImport(*srcT, *importer, cmT);
 }
 
+// Positions in the values of the local matrices, as seen by the kernels
+struct CombineAndScatterManagerTpetra::MatrixCombinePlan
+{
+  using Offset     = Tpetra_CrsMatrix::local_matrix_device_type::size_type;
+  using OffsetView = Kokkos::View<Offset*, PHX::Device>;
+  using ValueView  = Kokkos::View<ST*, PHX::Device>;
+
+  // The plan holds for these graphs
+  Teuchos::RCP<const Tpetra_CrsGraph> src_graph;
+  Teuchos::RCP<const Tpetra_CrsGraph> dst_graph;
+
+  // Position in dst of every entry of src, or invalid for the entries of the
+  // rows owned by other processes. One index per entry of src, instead of a
+  // pair of indices per entry of the owned rows.
+  OffsetView              src_to_dst;
+  static constexpr Offset invalid = std::numeric_limits<Offset>::max();
+
+  // Entries of src in the rows owned by other processes, one process after
+  // the other, and positions in dst of the entries received from the other
+  // processes, one process after the other
+  OffsetView send_src;
+  OffsetView recv_dst;
+
+  Teuchos::Array<int> send_ranks;
+  Teuchos::Array<int> send_offsets;  // send_ranks.size() + 1
+  Teuchos::Array<int> recv_ranks;
+  Teuchos::Array<int> recv_offsets;  // recv_ranks.size() + 1
+
+  // Persistent buffers, on device, and their host mirrors for the messages.
+  // The mirrors are the device buffers themselves if the device is the host.
+  ValueView             send_values;
+  ValueView             recv_values;
+  ValueView::HostMirror send_buffer;
+  ValueView::HostMirror recv_buffer;
+};
+
+namespace {
+
+using Offset     = Tpetra_CrsMatrix::local_matrix_device_type::size_type;
+using OffsetView = Kokkos::View<Offset*, PHX::Device>;
+
+OffsetView
+toDevice(std::string const& name, std::vector<Offset> const& offsets)
+{
+  OffsetView view(name, offsets.size());
+  auto       host = Kokkos::create_mirror_view(view);
+  for (std::size_t i = 0; i < offsets.size(); ++i) host(i) = offsets[i];
+  Kokkos::deep_copy(view, host);
+  return view;
+}
+
+}  // anonymous namespace
+
+Teuchos::RCP<CombineAndScatterManagerTpetra::MatrixCombinePlan>
+CombineAndScatterManagerTpetra::createMatrixCombinePlan(const Tpetra_CrsMatrix& src, const Tpetra_CrsMatrix& dst) const
+{
+  auto plan       = Teuchos::rcp(new MatrixCombinePlan());
+  plan->src_graph = src.getCrsGraph();
+  plan->dst_graph = dst.getCrsGraph();
+
+  auto const& src_rows  = *src.getRowMap();
+  auto const& src_cols  = *src.getColMap();
+  auto const& dst_rows  = *dst.getRowMap();
+  auto const& dst_cols  = *dst.getColMap();
+  auto const  src_local = plan->src_graph->getLocalGraphHost();
+  auto const  dst_local = plan->dst_graph->getLocalGraphHost();
+  auto const  comm      = dst_rows.getComm();
+
+  ALBANY_PANIC(
+      src_rows.getLocalNumElements() != importer->getTargetMap()->getLocalNumElements(),
+      "Error in CombineAndScatterManagerTpetra::combine: the rows of the source matrix are not the overlapped vector space.\n");
+
+  // Position of the entry (row, col) in dst
+  auto position = [&](Tpetra_LO const row, Tpetra_GO const col) -> Offset {
+    Tpetra_LO const lcol = dst_cols.getLocalElement(col);
+    for (Offset k = dst_local.row_map(row); k < dst_local.row_map(row + 1); ++k) {
+      if (dst_local.entries(k) == lcol) return k;
+    }
+    ALBANY_ABORT(
+        "Error in CombineAndScatterManagerTpetra::combine: the entry (" << dst_rows.getGlobalElement(row) << ", " << col
+                                                                       << ") of the source matrix is not in the graph of the destination matrix.\n");
+    return 0;
+  };
+
+  std::vector<Offset>       src_to_dst(src_local.entries.extent(0), MatrixCombinePlan::invalid);
+  std::vector<Tpetra_LO>    remote_rows;
+  Teuchos::Array<Tpetra_GO> remote_gids;
+  for (Tpetra_LO row = 0; row < static_cast<Tpetra_LO>(src_rows.getLocalNumElements()); ++row) {
+    Tpetra_GO const gid     = src_rows.getGlobalElement(row);
+    Tpetra_LO const dst_row = dst_rows.getLocalElement(gid);
+    if (dst_row < 0) {
+      remote_rows.push_back(row);
+      remote_gids.push_back(gid);
+      continue;
+    }
+    for (Offset k = src_local.row_map(row); k < src_local.row_map(row + 1); ++k) {
+      src_to_dst[k] = position(dst_row, src_cols.getGlobalElement(src_local.entries(k)));
+    }
+  }
+  plan->src_to_dst = toDevice("src_to_dst", src_to_dst);
+
+  // The shared rows owned by other processes go to their owners, which are
+  // the processes this one imports from. This process receives from the
+  // processes it exports to.
+  Teuchos::Array<int>       owners(remote_gids.size());
+  Teuchos::Array<Tpetra_LO> owner_lids(remote_gids.size());
+  dst_rows.getRemoteIndexList(remote_gids(), owners(), owner_lids());
+
+  // Every owner gets a message, even if its rows have no entries here
+  std::map<int, std::vector<Offset>>       send_entries;
+  std::map<int, Teuchos::Array<Tpetra_GO>> send_gids;  // (row, col) pairs
+  for (std::size_t i = 0; i < remote_rows.size(); ++i) {
+    Tpetra_LO const row     = remote_rows[i];
+    auto&           entries = send_entries[owners[i]];
+    auto&           gids    = send_gids[owners[i]];
+    for (Offset k = src_local.row_map(row); k < src_local.row_map(row + 1); ++k) {
+      entries.push_back(k);
+      gids.push_back(remote_gids[i]);
+      gids.push_back(src_cols.getGlobalElement(src_local.entries(k)));
+    }
+  }
+
+  std::vector<Offset> send_src;
+  plan->send_offsets.push_back(0);
+  for (auto const& rank_entries : send_entries) {
+    plan->send_ranks.push_back(rank_entries.first);
+    send_src.insert(send_src.end(), rank_entries.second.begin(), rank_entries.second.end());
+    plan->send_offsets.push_back(send_src.size());
+  }
+  plan->send_src = toDevice("send_src", send_src);
+
+  auto const          export_pids = importer->getExportPIDs();
+  std::set<int> const sources(export_pids.begin(), export_pids.end());
+  plan->recv_ranks.assign(sources.begin(), sources.end());
+
+  int const num_sends = plan->send_ranks.size();
+  int const num_recvs = plan->recv_ranks.size();
+
+  // Number of entries, then (row, col) of the entries, from every sender
+  Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<int>>> requests;
+  Teuchos::ArrayRCP<int>                                  recv_sizes(num_recvs, 0);
+  Teuchos::ArrayRCP<int>                                  send_sizes(num_sends, 0);
+  for (int i = 0; i < num_recvs; ++i) {
+    requests.push_back(Teuchos::ireceive<int, int>(recv_sizes.persistingView(i, 1), plan->recv_ranks[i], matrix_sizes_tag, *comm));
+  }
+  for (int i = 0; i < num_sends; ++i) {
+    send_sizes[i] = plan->send_offsets[i + 1] - plan->send_offsets[i];
+    requests.push_back(Teuchos::isend<int, int>(send_sizes.persistingView(i, 1).getConst(), plan->send_ranks[i], matrix_sizes_tag, *comm));
+  }
+  Teuchos::waitAll(*comm, requests());
+  requests.clear();
+
+  plan->recv_offsets.push_back(0);
+  for (int i = 0; i < num_recvs; ++i) plan->recv_offsets.push_back(plan->recv_offsets[i] + recv_sizes[i]);
+
+  Teuchos::ArrayRCP<Tpetra_GO> recv_gids(2 * plan->recv_offsets.back());
+  for (int i = 0; i < num_recvs; ++i) {
+    if (recv_sizes[i] == 0) continue;
+    requests.push_back(Teuchos::ireceive<int, Tpetra_GO>(
+        recv_gids.persistingView(2 * plan->recv_offsets[i], 2 * recv_sizes[i]), plan->recv_ranks[i], matrix_entries_tag, *comm));
+  }
+  for (int i = 0; i < num_sends; ++i) {
+    auto& gids = send_gids[plan->send_ranks[i]];
+    if (gids.empty()) continue;
+    requests.push_back(Teuchos::isend<int, Tpetra_GO>(Teuchos::arcpFromArray(gids).getConst(), plan->send_ranks[i], matrix_entries_tag, *comm));
+  }
+  Teuchos::waitAll(*comm, requests());
+
+  std::vector<Offset> recv_dst(plan->recv_offsets.back());
+  for (std::size_t i = 0; i < recv_dst.size(); ++i) {
+    Tpetra_LO const row = dst_rows.getLocalElement(recv_gids[2 * i]);
+    ALBANY_PANIC(
+        row < 0, "Error in CombineAndScatterManagerTpetra::combine: received the row " << recv_gids[2 * i] << ", which is not owned by this process.\n");
+    recv_dst[i] = position(row, recv_gids[2 * i + 1]);
+  }
+  plan->recv_dst = toDevice("recv_dst", recv_dst);
+
+  plan->send_values = MatrixCombinePlan::ValueView("send_values", send_src.size());
+  plan->recv_values = MatrixCombinePlan::ValueView("recv_values", recv_dst.size());
+  plan->send_buffer = Kokkos::create_mirror_view(plan->send_values);
+  plan->recv_buffer = Kokkos::create_mirror_view(plan->recv_values);
+  return plan;
+}
+
+void
+CombineAndScatterManagerTpetra::combineMatrix(const Tpetra_CrsMatrix& src, Tpetra_CrsMatrix& dst) const
+{
+  // The graphs change on all processes at once, e.g. after adaptation, so
+  // the plan is created again on all processes at once
+  if (matrix_plan.is_null() || matrix_plan->src_graph.get() != src.getCrsGraph().get() || matrix_plan->dst_graph.get() != dst.getCrsGraph().get()) {
+    matrix_plan = createMatrixCombinePlan(src, dst);
+  }
+  auto&      plan = *matrix_plan;
+  auto const comm = dst.getRowMap()->getComm();
+
+  using ExecutionSpace = PHX::Device::execution_space;
+
+  auto const src_values  = src.getLocalMatrixDevice().values;
+  auto const dst_values  = dst.getLocalMatrixDevice().values;
+  auto const src_to_dst  = plan.src_to_dst;
+  auto const invalid     = MatrixCombinePlan::invalid;
+  auto const send_src    = plan.send_src;
+  auto const recv_dst    = plan.recv_dst;
+  auto const send_values = plan.send_values;
+  auto const recv_values = plan.recv_values;
+
+  // Pack the entries of the shared rows owned by other processes
+  Kokkos::parallel_for(
+      "Albany::combineMatrix::pack", Kokkos::RangePolicy<ExecutionSpace>(0, send_src.extent(0)),
+      KOKKOS_LAMBDA(int const i) { send_values(i) = src_values(send_src(i)); });
+  Kokkos::deep_copy(plan.send_buffer, send_values);
+
+  // Messages straight from and into the host buffers
+  auto const send_buffer = Teuchos::arcp(plan.send_buffer.data(), 0, plan.send_buffer.extent(0), false);
+  auto const recv_buffer = Teuchos::arcp(plan.recv_buffer.data(), 0, plan.recv_buffer.extent(0), false);
+
+  Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<int>>> requests;
+  for (int i = 0; i < plan.recv_ranks.size(); ++i) {
+    int const count = plan.recv_offsets[i + 1] - plan.recv_offsets[i];
+    if (count == 0) continue;
+    requests.push_back(
+        Teuchos::ireceive<int, ST>(recv_buffer.persistingView(plan.recv_offsets[i], count), plan.recv_ranks[i], matrix_values_tag, *comm));
+  }
+  for (int i = 0; i < plan.send_ranks.size(); ++i) {
+    int const count = plan.send_offsets[i + 1] - plan.send_offsets[i];
+    if (count == 0) continue;
+    requests.push_back(Teuchos::isend<int, ST>(
+        send_buffer.persistingView(plan.send_offsets[i], count).getConst(), plan.send_ranks[i], matrix_values_tag, *comm));
+  }
+
+  // Sum the owned rows while the messages are on their way. Every entry of
+  // dst is the image of at most one entry of the owned rows of src.
+  Kokkos::parallel_for(
+      "Albany::combineMatrix::local", Kokkos::RangePolicy<ExecutionSpace>(0, src_to_dst.extent(0)), KOKKOS_LAMBDA(int const k) {
+        if (src_to_dst(k) != invalid) dst_values(src_to_dst(k)) += src_values(k);
+      });
+
+  Teuchos::waitAll(*comm, requests());
+
+  // Entries from different processes may go to the same entry of dst
+  Kokkos::deep_copy(recv_values, plan.recv_buffer);
+  Kokkos::parallel_for(
+      "Albany::combineMatrix::unpack", Kokkos::RangePolicy<ExecutionSpace>(0, recv_dst.extent(0)),
+      KOKKOS_LAMBDA(int const i) { Kokkos::atomic_add(&dst_values(recv_dst(i)), recv_values(i)); });
+  Kokkos::fence();
+}
+
 void
 CombineAndScatterManagerTpetra::create_ghosted_aura_owners() const
 {
@@ -10,6 +10,14 @@ namespace Albany {
 // for the case where the thyra structures are wrappers of Tpetra structures.
 // An Tpetra_Import object is constructed at construction time, and then reused
 // at every combine/scatter call (in either forward or reverse mode).
+//
+// The combine of an overlapped matrix into an owned matrix with ADD, as done
+// for every Jacobian, does not go through a Tpetra export. The positions of
+// the overlapped entries in the owned matrix are computed once per pair of
+// graphs. The entries of the rows owned by this process are then summed in
+// place, and only the entries of the shared rows owned by other processes
+// are sent, through buffers kept from one combine to the next, like in
+// Tpetra::FECrsMatrix. The owned matrix may be fill active or not.
 class CombineAndScatterManagerTpetra : public CombineAndScatterManager
 {
  public:
@@ -52,6 +60,18 @@ class CombineAndScatterManagerTpetra : public CombineAndScatterManager
   create_owned_aura_users() const override;
 
   Teuchos::RCP<Tpetra_Import> importer;
+
+ private:
+  struct MatrixCombinePlan;
+
+  void
+  combineMatrix(const Tpetra_CrsMatrix& src, Tpetra_CrsMatrix& dst) const;
+
+  Teuchos::RCP<MatrixCombinePlan>
+  createMatrixCombinePlan(const Tpetra_CrsMatrix& src, const Tpetra_CrsMatrix& dst) const;
+
+  // Mutable, so we can lazy initialize it
+  mutable Teuchos::RCP<MatrixCombinePlan> matrix_plan;
 };
 
 }  // namespace Albany
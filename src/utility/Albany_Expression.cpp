@@ -0,0 +1,523 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_Expression.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "Kokkos_Core.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace Albany {
+
+namespace {
+
+using OpCode      = Expression::OpCode;
+using Instruction = Expression::Instruction;
+
+struct Function1
+{
+  char const* name;
+  double (*f)(double);
+};
+
+struct Function2
+{
+  char const* name;
+  double (*f)(double, double);
+};
+
+Function1 const functions1[] = {
+    {"sin", [](double a) { return std::sin(a); }},     {"cos", [](double a) { return std::cos(a); }},
+    {"tan", [](double a) { return std::tan(a); }},     {"asin", [](double a) { return std::asin(a); }},
+    {"acos", [](double a) { return std::acos(a); }},   {"atan", [](double a) { return std::atan(a); }},
+    {"sinh", [](double a) { return std::sinh(a); }},   {"cosh", [](double a) { return std::cosh(a); }},
+    {"tanh", [](double a) { return std::tanh(a); }},   {"exp", [](double a) { return std::exp(a); }},
+    {"log", [](double a) { return std::log(a); }},     {"ln", [](double a) { return std::log(a); }},
+    {"log10", [](double a) { return std::log10(a); }}, {"sqrt", [](double a) { return std::sqrt(a); }},
+    {"abs", [](double a) { return std::fabs(a); }},    {"fabs", [](double a) { return std::fabs(a); }},
+    {"floor", [](double a) { return std::floor(a); }}, {"ceil", [](double a) { return std::ceil(a); }}};
+
+Function2 const functions2[] = {
+    {"atan2", [](double a, double b) { return std::atan2(a, b); }},
+    {"pow", [](double a, double b) { return std::pow(a, b); }},
+    {"min", [](double a, double b) { return std::min(a, b); }},
+    {"max", [](double a, double b) { return std::max(a, b); }},
+    {"fmod", [](double a, double b) { return std::fmod(a, b); }}};
+
+// The coordinates and the time come first in the variables
+char const* const bound_variables[] = {"x", "y", "z", "t"};
+
+int const num_bound_variables = 4;
+
+double
+applyUnary(Instruction const& ins, double const a)
+{
+  switch (ins.op) {
+    case OpCode::Negate: return -a;
+    case OpCode::Not: return a == 0.0 ? 1.0 : 0.0;
+    default: return functions1[ins.arg].f(a);
+  }
+}
+
+double
+applyBinary(Instruction const& ins, double const a, double const b)
+{
+  switch (ins.op) {
+    case OpCode::Add: return a + b;
+    case OpCode::Subtract: return a - b;
+    case OpCode::Multiply: return a * b;
+    case OpCode::Divide: return a / b;
+    case OpCode::Modulo: return std::fmod(a, b);
+    case OpCode::Power: return std::pow(a, b);
+    case OpCode::Less: return a < b ? 1.0 : 0.0;
+    case OpCode::LessEqual: return a <= b ? 1.0 : 0.0;
+    case OpCode::Greater: return a > b ? 1.0 : 0.0;
+    case OpCode::GreaterEqual: return a >= b ? 1.0 : 0.0;
+    case OpCode::Equal: return a == b ? 1.0 : 0.0;
+    case OpCode::NotEqual: return a != b ? 1.0 : 0.0;
+    case OpCode::And: return a != 0.0 && b != 0.0 ? 1.0 : 0.0;
+    case OpCode::Or: return a != 0.0 || b != 0.0 ? 1.0 : 0.0;
+    default: return functions2[ins.arg].f(a, b);
+  }
+}
+
+// Recursive descent parser, lowest precedence first:
+//
+//   statement      := name '=' conditional | conditional
+//   conditional    := or ['?' conditional ':' conditional]
+//   or             := and {'||' and}
+//   and            := equality {'&&' equality}
+//   equality       := relational {('==' | '!=') relational}
+//   relational     := additive {('<' | '<=' | '>' | '>=') additive}
+//   additive       := multiplicative {('+' | '-') multiplicative}
+//   multiplicative := unary {('*' | '/' | '%') unary}
+//   unary          := ('-' | '+' | '!') unary | power
+//   power          := primary [('^' | '**') unary]
+//   primary        := number | name | name '(' arguments ')' | '(' conditional ')'
+class Parser
+{
+ public:
+  Parser(std::string const& expression, std::vector<Instruction>& instructions, std::vector<std::string>& variables)
+      : expression_(expression), instructions_(instructions), variables_(variables)
+  {
+  }
+
+  void
+  parse()
+  {
+    skipSpaces();
+    TEUCHOS_TEST_FOR_EXCEPTION(pos_ == expression_.size(), std::invalid_argument, error("empty expression"));
+    bool last_is_assignment = false;
+    while (pos_ < expression_.size()) {
+      last_is_assignment = statement();
+      if (accept(";") == false) break;
+      if (pos_ == expression_.size()) break;
+      // A statement that is not the last one leaves nothing on the stack
+      if (last_is_assignment == false) emit({OpCode::Pop, 0, 0.0});
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(pos_ != expression_.size(), std::invalid_argument, error("unexpected character"));
+    // The value of an assignment is the value assigned
+    if (last_is_assignment == true) emit({OpCode::Variable, stored_, 0.0});
+  }
+
+  int
+  maxDepth() const
+  {
+    return max_depth_;
+  }
+
+ private:
+  // True if the statement is an assignment. Its value is then stored.
+  bool
+  statement()
+  {
+    std::size_t const start = pos_;
+    std::string const name  = identifier();
+    if (name.empty() == false && peek("=") && peek("==") == false) {
+      accept("=");
+      conditional();
+      for (int i = 0; i < num_bound_variables; ++i) {
+        TEUCHOS_TEST_FOR_EXCEPTION(name == bound_variables[i], std::invalid_argument, error("cannot assign to " + name));
+      }
+      auto it = std::find(variables_.begin(), variables_.end(), name);
+      if (it == variables_.end()) it = variables_.insert(variables_.end(), name);
+      stored_ = it - variables_.begin();
+      emit({OpCode::Store, stored_, 0.0});
+      return true;
+    }
+    pos_ = start;
+    skipSpaces();
+    conditional();
+    return false;
+  }
+
+  void
+  conditional()
+  {
+    orExpression();
+    if (accept("?")) {
+      conditional();
+      expect(":");
+      conditional();
+      emit({OpCode::Select, 0, 0.0});
+    }
+  }
+
+  void
+  orExpression()
+  {
+    andExpression();
+    while (accept("||")) {
+      andExpression();
+      emit({OpCode::Or, 0, 0.0});
+    }
+  }
+
+  void
+  andExpression()
+  {
+    equality();
+    while (accept("&&")) {
+      equality();
+      emit({OpCode::And, 0, 0.0});
+    }
+  }
+
+  void
+  equality()
+  {
+    relational();
+    while (true) {
+      OpCode op;
+      if (accept("=="))
+        op = OpCode::Equal;
+      else if (accept("!="))
+        op = OpCode::NotEqual;
+      else
+        break;
+      relational();
+      emit({op, 0, 0.0});
+    }
+  }
+
+  void
+  relational()
+  {
+    additive();
+    while (true) {
+      OpCode op;
+      if (accept("<="))
+        op = OpCode::LessEqual;
+      else if (accept(">="))
+        op = OpCode::GreaterEqual;
+      else if (accept("<"))
+        op = OpCode::Less;
+      else if (accept(">"))
+        op = OpCode::Greater;
+      else
+        break;
+      additive();
+      emit({op, 0, 0.0});
+    }
+  }
+
+  void
+  additive()
+  {
+    multiplicative();
+    while (true) {
+      OpCode op;
+      if (accept("+"))
+        op = OpCode::Add;
+      else if (accept("-"))
+        op = OpCode::Subtract;
+      else
+        break;
+      multiplicative();
+      emit({op, 0, 0.0});
+    }
+  }
+
+  void
+  multiplicative()
+  {
+    unary();
+    while (true) {
+      OpCode op;
+      if (peek("**"))
+        break;
+      else if (accept("*"))
+        op = OpCode::Multiply;
+      else if (accept("/"))
+        op = OpCode::Divide;
+      else if (accept("%"))
+        op = OpCode::Modulo;
+      else
+        break;
+      unary();
+      emit({op, 0, 0.0});
+    }
+  }
+
+  void
+  unary()
+  {
+    if (accept("-")) {
+      unary();
+      emit({OpCode::Negate, 0, 0.0});
+    } else if (accept("+")) {
+      unary();
+    } else if (peek("!") && peek("!=") == false) {
+      accept("!");
+      unary();
+      emit({OpCode::Not, 0, 0.0});
+    } else {
+      power();
+    }
+  }
+
+  void
+  power()
+  {
+    primary();
+    if (accept("^") || accept("**")) {
+      unary();
+      emit({OpCode::Power, 0, 0.0});
+    }
+  }
+
+  void
+  primary()
+  {
+    if (accept("(")) {
+      conditional();
+      expect(")");
+      return;
+    }
+    if (pos_ < expression_.size() && (std::isdigit(static_cast<unsigned char>(expression_[pos_])) || expression_[pos_] == '.')) {
+      char const*  begin = expression_.c_str() + pos_;
+      char*        end   = nullptr;
+      double const value = std::strtod(begin, &end);
+      TEUCHOS_TEST_FOR_EXCEPTION(end == begin, std::invalid_argument, error("invalid number"));
+      pos_ += end - begin;
+      skipSpaces();
+      emit({OpCode::Constant, 0, value});
+      return;
+    }
+    std::string const name = identifier();
+    TEUCHOS_TEST_FOR_EXCEPTION(name.empty(), std::invalid_argument, error("expected a number, a name or '('"));
+    if (accept("(")) {
+      call(name);
+      return;
+    }
+    if (name == "pi") {
+      emit({OpCode::Constant, 0, std::acos(-1.0)});
+      return;
+    }
+    if (name == "e") {
+      emit({OpCode::Constant, 0, std::exp(1.0)});
+      return;
+    }
+    auto const it = std::find(variables_.begin(), variables_.end(), name);
+    TEUCHOS_TEST_FOR_EXCEPTION(it == variables_.end(), std::invalid_argument, error("unknown variable " + name));
+    emit({OpCode::Variable, static_cast<int>(it - variables_.begin()), 0.0});
+  }
+
+  // The opening parenthesis has been read
+  void
+  call(std::string const& name)
+  {
+    for (int f = 0; f < static_cast<int>(sizeof(functions1) / sizeof(functions1[0])); ++f) {
+      if (name != functions1[f].name) continue;
+      conditional();
+      expect(")");
+      emit({OpCode::Function1, f, 0.0});
+      return;
+    }
+    for (int f = 0; f < static_cast<int>(sizeof(functions2) / sizeof(functions2[0])); ++f) {
+      if (name != functions2[f].name) continue;
+      conditional();
+      expect(",");
+      conditional();
+      expect(")");
+      emit({OpCode::Function2, f, 0.0});
+      return;
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::invalid_argument, error("unknown function " + name));
+  }
+
+  // Append an instruction, folding it with its operands if they are all
+  // constants. An operand that ends with a constant is that constant.
+  void
+  emit(Instruction const& ins)
+  {
+    int const num_operands = operands(ins.op);
+    int const size         = instructions_.size();
+    bool      fold         = num_operands > 0 && size >= num_operands && ins.op != OpCode::Store && ins.op != OpCode::Pop;
+    for (int i = size - num_operands; fold == true && i < size; ++i) {
+      fold = instructions_[i].op == OpCode::Constant;
+    }
+    if (fold == true) {
+      Instruction const* a = &instructions_[size - num_operands];
+      double             value;
+      if (num_operands == 1)
+        value = applyUnary(ins, a[0].value);
+      else if (num_operands == 2)
+        value = applyBinary(ins, a[0].value, a[1].value);
+      else
+        value = a[0].value != 0.0 ? a[1].value : a[2].value;
+      instructions_.resize(size - num_operands);
+      instructions_.push_back({OpCode::Constant, 0, value});
+      depth_ -= num_operands - 1;
+      return;
+    }
+    instructions_.push_back(ins);
+    depth_ += 1 - num_operands;
+    if (ins.op == OpCode::Store || ins.op == OpCode::Pop) depth_ -= 1;
+    max_depth_ = std::max(max_depth_, depth_);
+  }
+
+  // Number of values an instruction pops from the stack to compute its
+  // result. Store and Pop pop one value and push none.
+  static int
+  operands(OpCode const op)
+  {
+    switch (op) {
+      case OpCode::Constant:
+      case OpCode::Variable: return 0;
+      case OpCode::Store:
+      case OpCode::Pop:
+      case OpCode::Negate:
+      case OpCode::Not:
+      case OpCode::Function1: return 1;
+      case OpCode::Select: return 3;
+      default: return 2;
+    }
+  }
+
+  std::string
+  identifier()
+  {
+    std::size_t const start = pos_;
+    if (pos_ < expression_.size() && (std::isalpha(static_cast<unsigned char>(expression_[pos_])) || expression_[pos_] == '_')) {
+      while (pos_ < expression_.size() && (std::isalnum(static_cast<unsigned char>(expression_[pos_])) || expression_[pos_] == '_')) ++pos_;
+    }
+    std::string const name = expression_.substr(start, pos_ - start);
+    skipSpaces();
+    return name;
+  }
+
+  bool
+  peek(std::string const& token) const
+  {
+    return expression_.compare(pos_, token.size(), token) == 0;
+  }
+
+  bool
+  accept(std::string const& token)
+  {
+    if (peek(token) == false) return false;
+    pos_ += token.size();
+    skipSpaces();
+    return true;
+  }
+
+  void
+  expect(std::string const& token)
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION(accept(token) == false, std::invalid_argument, error("expected '" + token + "'"));
+  }
+
+  void
+  skipSpaces()
+  {
+    while (pos_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[pos_]))) ++pos_;
+  }
+
+  std::string
+  error(std::string const& what) const
+  {
+    return "Error in Albany::Expression: " + what + " at position " + std::to_string(pos_) + " of \"" + expression_ + "\".\n";
+  }
+
+  std::string const&        expression_;
+  std::vector<Instruction>& instructions_;
+  std::vector<std::string>& variables_;
+  std::size_t               pos_{0};
+  int                       depth_{0};
+  int                       max_depth_{0};
+  int                       stored_{0};
+};
+
+}  // anonymous namespace
+
+Expression::Expression(std::string const& expression) : expression_(expression)
+{
+  std::vector<std::string> variables(bound_variables, bound_variables + num_bound_variables);
+  Parser                   parser(expression_, instructions_, variables);
+  parser.parse();
+  num_variables_ = variables.size();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      parser.maxDepth() > max_stack,
+      std::invalid_argument,
+      "Error in Albany::Expression: \"" << expression_ << "\" needs a stack of " << parser.maxDepth() << " values, more than " << max_stack << ".\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      num_variables_ > max_variables,
+      std::invalid_argument,
+      "Error in Albany::Expression: \"" << expression_ << "\" defines " << num_variables_ << " variables, more than " << max_variables << ".\n");
+}
+
+double
+Expression::run(double* variables) const
+{
+  double stack[max_stack];
+  int    top = 0;
+  for (auto const& ins : instructions_) {
+    switch (ins.op) {
+      case OpCode::Constant: stack[top++] = ins.value; break;
+      case OpCode::Variable: stack[top++] = variables[ins.arg]; break;
+      case OpCode::Store: variables[ins.arg] = stack[--top]; break;
+      case OpCode::Pop: --top; break;
+      case OpCode::Negate:
+      case OpCode::Not:
+      case OpCode::Function1: stack[top - 1] = applyUnary(ins, stack[top - 1]); break;
+      case OpCode::Select:
+        top -= 2;
+        stack[top - 1] = stack[top - 1] != 0.0 ? stack[top] : stack[top + 1];
+        break;
+      default:
+        --top;
+        stack[top - 1] = applyBinary(ins, stack[top - 1], stack[top]);
+        break;
+    }
+  }
+  return stack[top - 1];
+}
+
+double
+Expression::evaluate(double const* coords, int const dim, double const t) const
+{
+  double variables[max_variables];
+  for (int i = 0; i < num_variables_; ++i) variables[i] = 0.0;
+  for (int i = 0; i < dim && i < 3; ++i) variables[i] = coords[i];
+  variables[3] = t;
+  return run(variables);
+}
+
+void
+Expression::evaluate(std::vector<double*> const& coords, std::vector<int> const& points, int const dim, double const t, std::vector<double>& values) const
+{
+  int const num_points = points.size();
+  values.resize(num_points);
+  Kokkos::parallel_for(
+      "Albany::Expression::evaluate", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_points),
+      [&](int const i) { values[i] = evaluate(coords[points[i]], dim, t); });
+}
+
+}  // namespace Albany
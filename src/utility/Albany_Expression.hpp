@@ -0,0 +1,111 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_EXPRESSION_HPP
+#define ALBANY_EXPRESSION_HPP
+
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+//! A scalar function of the coordinates x, y, z and the time t, given as
+//! a string such as "250 * cosh(0.054 * x) * exp(2.25e-06 * t)".
+//!
+//! The string is parsed once, at construction, into a list of stack
+//! machine instructions with the constant subexpressions folded, so that
+//! the evaluation at a point does not parse, allocate or look up names.
+//! The syntax is the common part of the one of stk::expreval:
+//!
+//!   numbers, the variables x, y, z and t, the constants pi and e
+//!   + - * / % ^ (or **), unary - + !
+//!   < <= > >= == != && || and c ? a : b
+//!   sin cos tan asin acos atan sinh cosh tanh exp log ln log10 sqrt
+//!   abs fabs floor ceil, and atan2 pow min max fmod of two arguments
+//!   statements separated by ';', where "a = ..." defines a variable a
+//!   for the following statements; the value is the one of the last one
+//!
+//! Errors in the expression throw std::invalid_argument at construction.
+//! Unlike stk::expreval, which treats an unknown name as a variable of
+//! value 0, a name that is not x, y, z, t, pi, e or a variable defined by
+//! an earlier statement is an error.
+class Expression
+{
+ public:
+  explicit Expression(std::string const& expression);
+
+  //! Value at the point of coordinates coords[0, dim) at time t. The
+  //! coordinates past dim are 0.
+  double
+  evaluate(double const* coords, int const dim, double const t) const;
+
+  //! values[i] = value at coords[points[i]] at time t, for all i, in
+  //! parallel over the points with the Kokkos host execution space.
+  void
+  evaluate(std::vector<double*> const& coords, std::vector<int> const& points, int const dim, double const t, std::vector<double>& values) const;
+
+  std::string const&
+  string() const
+  {
+    return expression_;
+  }
+
+  //! Maximum depth of the evaluation stack, and number of variables
+  //! including the ones defined by the expression
+  static constexpr int max_stack     = 64;
+  static constexpr int max_variables = 32;
+
+  enum class OpCode
+  {
+    Constant,
+    Variable,
+    Store,
+    Pop,
+    Negate,
+    Not,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Modulo,
+    Power,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    And,
+    Or,
+    Select,
+    Function1,
+    Function2
+  };
+
+  struct Instruction
+  {
+    OpCode op;
+    int    arg;    // variable or function
+    double value;  // constant
+  };
+
+  //! The stack machine instructions, after constant folding
+  std::vector<Instruction> const&
+  instructions() const
+  {
+    return instructions_;
+  }
+
+ private:
+  double
+  run(double* variables) const;
+
+  std::string              expression_;
+  std::vector<Instruction> instructions_;
+  int                      num_variables_{0};
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_EXPRESSION_HPP
@@ -0,0 +1,42 @@
+# Run the explicit dynamics driver and Tempus on the same model, and compare
+# the displacements at the final time.
+
+# 1. Write the Tempus input of the model
+
+file(READ ${MODEL}-model.yaml INPUT)
+string(REPLACE "${MODEL}.e" "${MODEL}-tempus.e" INPUT "${INPUT}")
+file(WRITE ${MODEL}-tempus.yaml "${INPUT}")
+
+# 2. Run both
+
+foreach(INPUT_FILE ${MODEL}.yaml ${MODEL}-tempus.yaml)
+  message("Running the command:")
+  message("${TEST_PROG} " " ${INPUT_FILE}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT_FILE}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run: test failed")
+  endif()
+endforeach()
+
+# 3. Find and run exodiff
+
+if (NOT SEACAS_EXODIFF)
+  message(FATAL_ERROR "Cannot find exodiff")
+endif()
+
+SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${MODEL}.exodiff_commands -steps -1 ${MODEL}.e ${MODEL}-tempus.e)
+
+message("Running the command:")
+message("${EXODIFF_TEST}")
+
+EXECUTE_PROCESS(
+    COMMAND ${EXODIFF_TEST}
+    OUTPUT_FILE exodiff_${MODEL}.out
+    RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Test failed")
+endif()
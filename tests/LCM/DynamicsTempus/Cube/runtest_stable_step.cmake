@@ -0,0 +1,37 @@
+# Run the explicit dynamics driver without a Time Step, and check the time
+# step and number of substeps that it chose from the stable time steps.
+#
+#   -DMIN_TIME_STEP=a -DMAX_TIME_STEP=b  bounds of the time step
+#   -DSUBSTEPS=n                         number of substeps of the time step
+
+# 1. Run the program
+
+message("Running the command:")
+message("${TEST_PROG} " " ${INPUT_FILE}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT_FILE}
+                OUTPUT_VARIABLE ALBANY_OUTPUT
+                ERROR_VARIABLE ALBANY_OUTPUT
+                RESULT_VARIABLE HAD_ERROR)
+
+file(WRITE ${TEST_NAME}.out "${ALBANY_OUTPUT}")
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Albany didn't run: test failed")
+endif()
+
+# 2. Check the time step
+
+if(NOT ALBANY_OUTPUT MATCHES "Explicit Dynamics time step ([0-9.eE+-]+) in ([0-9]+) substeps")
+  message(FATAL_ERROR "No time step in the output of Albany")
+endif()
+set(STEP ${CMAKE_MATCH_1})
+set(NUM_SUBSTEPS ${CMAKE_MATCH_2})
+
+message("Time step: ${STEP} in ${NUM_SUBSTEPS} substeps")
+if(STEP LESS MIN_TIME_STEP OR STEP GREATER MAX_TIME_STEP)
+  message(FATAL_ERROR "Test failed: time step ${STEP} not in [${MIN_TIME_STEP}, ${MAX_TIME_STEP}]")
+endif()
+if(NOT NUM_SUBSTEPS EQUAL SUBSTEPS)
+  message(FATAL_ERROR "Test failed: ${NUM_SUBSTEPS} substeps, not ${SUBSTEPS}")
+endif()
@@ -0,0 +1,47 @@
+# Run the input of MODEL with the standard mechanics evaluators and with the
+# fused mechanics kernel, and compare the two outputs.
+
+# 1. Write the input with the fused kernel
+
+file(READ input_${MODEL}.yaml INPUT)
+string(REPLACE "materials_${MODEL}.yaml" "materials_${MODEL}_fused.yaml" INPUT "${INPUT}")
+string(REPLACE "${MODEL}.e" "${MODEL}_fused.e" INPUT "${INPUT}")
+file(WRITE input_${MODEL}_fused.yaml "${INPUT}")
+
+file(READ materials_${MODEL}.yaml MATERIALS)
+string(REPLACE "    Block0:\n" "    Block0:\n      Use Fused Mechanics Kernel: true\n" MATERIALS "${MATERIALS}")
+file(WRITE materials_${MODEL}_fused.yaml "${MATERIALS}")
+
+# 2. Run both
+
+foreach(INPUT_FILE input_${MODEL}.yaml input_${MODEL}_fused.yaml)
+  message("Running the command:")
+  message("${TEST_PROG} " " ${INPUT_FILE}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT_FILE}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run: test failed")
+  endif()
+endforeach()
+
+# 3. Find and run exodiff
+
+if (NOT SEACAS_EXODIFF)
+  message(FATAL_ERROR "Cannot find exodiff")
+endif()
+
+SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -relative -t 1.e-6 -F 1.e-12 ${MODEL}_fused.e ${MODEL}.e)
+
+message("Running the command:")
+message("${EXODIFF_TEST}")
+
+EXECUTE_PROCESS(
+    COMMAND ${EXODIFF_TEST}
+    OUTPUT_FILE exodiff_${MODEL}.out
+    RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Test failed")
+endif()
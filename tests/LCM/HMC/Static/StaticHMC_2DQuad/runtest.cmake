@@ -1,3 +1,17 @@
+# 0. With REF_ARGS, run the program for the reference output first
+
+if(DEFINED REF_ARGS)
+  message("Running the command:")
+  message("${TEST_PROG} " " ${REF_ARGS}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${REF_ARGS}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run the reference: test failed")
+  endif()
+endif()
+
 # 1. Run the program and generate the exodus output
 
 message("Running the command:")
@@ -35,14 +49,26 @@ endif()
 
 # 2. Find and run exodiff
 
+# The output is compared with ${REF_NAME}.ref.exo, by default that of the
+# test, or with the output ${REF_NAME}.exo of the reference run
+if(NOT DEFINED REF_NAME)
+  SET(REF_NAME ${TEST_NAME})
+endif()
+
+if(DEFINED REF_ARGS)
+  SET(REF_FILE ${REF_NAME}.exo)
+else()
+  SET(REF_FILE ${DATA_DIR}/${REF_NAME}.ref.exo)
+endif()
+
 if (NOT SEACAS_EXODIFF)
   message(FATAL_ERROR "Cannot find exodiff")
 endif()
 
 if(DEFINED MPIMNP AND ${MPIMNP} GREATER 1)
-  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -m -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${TEST_NAME}.exo ${DATA_DIR}/${TEST_NAME}.ref.exo)
+  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -m -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${TEST_NAME}.exo ${REF_FILE})
 ELSE()
-  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${TEST_NAME}.exo ${DATA_DIR}/${TEST_NAME}.ref.exo)
+  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${TEST_NAME}.exo ${REF_FILE})
 ENDIF()
 
 message("Running the command:")
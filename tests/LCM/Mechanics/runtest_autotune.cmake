@@ -0,0 +1,72 @@
+# Tune the workset size over runs of Albany, and check the size of every run.
+#
+# CANDIDATES are the Candidate Workset Sizes of the input file, separated by
+# '|', and CACHE_FILE its Cache File. Every run times the next candidate, the
+# last one chooses a size, and the next run reads it from the cache file. A
+# stale cache file is then tuned again.
+
+string(REPLACE "|" ";" CANDIDATES "${CANDIDATES}")
+
+# Run Albany, and check that its output matches the regular expressions
+function(run_albany RUN)
+  message("Running the command:")
+  message("${TEST_PROG} " " ${TEST_ARGS}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                  OUTPUT_VARIABLE ALBANY_OUTPUT
+                  RESULT_VARIABLE HAD_ERROR)
+
+  file(WRITE ${TEST_NAME}_${RUN}.out "${ALBANY_OUTPUT}")
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run: test failed")
+  endif()
+
+  foreach(PATTERN ${ARGN})
+    if(NOT ALBANY_OUTPUT MATCHES "${PATTERN}")
+      message(FATAL_ERROR "Test failed: no match for ${PATTERN} in the output of run ${RUN}")
+    endif()
+  endforeach()
+
+  set(ALBANY_OUTPUT "${ALBANY_OUTPUT}" PARENT_SCOPE)
+endfunction()
+
+# 1. Time every candidate, one per run
+
+file(REMOVE ${CACHE_FILE})
+
+list(LENGTH CANDIDATES NUM_CANDIDATES)
+math(EXPR LAST "${NUM_CANDIDATES} - 1")
+foreach(I RANGE ${LAST})
+  list(GET CANDIDATES ${I} CANDIDATE)
+  if(I LESS LAST)
+    math(EXPR J "${I} + 1")
+    list(GET CANDIDATES ${J} NEXT)
+    run_albany(${I} "timing Workset Size ${CANDIDATE}\n"
+                    "the next run times Workset Size ${NEXT}\n")
+  else()
+    run_albany(${I} "timing Workset Size ${CANDIDATE}\n"
+                    "chose Workset Size [0-9]+")
+  endif()
+endforeach()
+
+# 2. The chosen size is one of the candidates, and the next run uses it
+
+string(REGEX MATCH "chose Workset Size ([0-9]+)" CHOSEN "${ALBANY_OUTPUT}")
+set(CHOSEN ${CMAKE_MATCH_1})
+list(FIND CANDIDATES ${CHOSEN} INDEX)
+if(INDEX EQUAL -1)
+  message(FATAL_ERROR "Test failed: chose Workset Size ${CHOSEN}, not a candidate")
+endif()
+
+run_albany(cached "Workset Size ${CHOSEN} from ")
+if(ALBANY_OUTPUT MATCHES "timing Workset Size")
+  message(FATAL_ERROR "Test failed: the cached run tuned again")
+endif()
+
+# 3. A cache file without a choice or timings is stale
+
+file(WRITE ${CACHE_FILE} "Workset Size Autotune:\n  Fingerprint:\n    Number of Processes: 0\n")
+list(GET CANDIDATES 0 FIRST)
+run_albany(stale "is stale, tuning again\n"
+                 "timing Workset Size ${FIRST}\n")
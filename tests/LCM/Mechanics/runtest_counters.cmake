@@ -0,0 +1,84 @@
+# Run Albany, and check the counters of the performance summary that it
+# writes with "Enable TimeMonitor Output: true".
+#
+# CHECKS is a list of checks separated by '|', each the name of a counter, a
+# comparison '=' or '>', and a value, e.g.
+#
+#   -DCHECKS=Albany Residual Reuse: Hits>0|Albany State Fields: Copied=0
+#
+# A counter that is not in the summary was never incremented, and is 0.
+#
+# With BASELINE_ARGS, TEST_PROG also runs with these arguments, and the
+# Exodus file OUTPUT of the first run is compared with the file BASELINE of
+# the second one with SEACAS_EXODIFF and the command file EXODIFF_COMMANDS.
+
+# 1. Run the program
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                OUTPUT_VARIABLE ALBANY_OUTPUT
+                RESULT_VARIABLE HAD_ERROR)
+
+file(WRITE ${TEST_NAME}.out "${ALBANY_OUTPUT}")
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Albany didn't run: test failed")
+endif()
+
+# 2. Check the counters
+
+string(FIND "${ALBANY_OUTPUT}" "\"Counter\",\"Value\"" SUMMARY)
+if(SUMMARY EQUAL -1)
+  message(FATAL_ERROR "No counter summary in the output of Albany")
+endif()
+
+string(REPLACE "|" ";" CHECKS "${CHECKS}")
+foreach(CHECK ${CHECKS})
+  if(NOT CHECK MATCHES "^(.+)([=>])([0-9]+)$")
+    message(FATAL_ERROR "Cannot parse the check ${CHECK}")
+  endif()
+  set(NAME ${CMAKE_MATCH_1})
+  set(OPERATOR ${CMAKE_MATCH_2})
+  set(EXPECTED ${CMAKE_MATCH_3})
+
+  set(VALUE 0)
+  if(ALBANY_OUTPUT MATCHES "\"${NAME}\",\"([0-9]+)\"")
+    set(VALUE ${CMAKE_MATCH_1})
+  endif()
+
+  message("${NAME}: ${VALUE}")
+  if(OPERATOR STREQUAL "=" AND NOT VALUE EQUAL EXPECTED)
+    message(FATAL_ERROR "Test failed: ${NAME} is ${VALUE}, not ${EXPECTED}")
+  endif()
+  if(OPERATOR STREQUAL ">" AND NOT VALUE GREATER EXPECTED)
+    message(FATAL_ERROR "Test failed: ${NAME} is ${VALUE}, not more than ${EXPECTED}")
+  endif()
+endforeach()
+
+# 3. Compare with the baseline run
+
+if(DEFINED BASELINE_ARGS)
+  message("Running the baseline command:")
+  message("${TEST_PROG} " " ${BASELINE_ARGS}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${BASELINE_ARGS}
+                  OUTPUT_FILE ${TEST_NAME}_baseline.out
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run the baseline: test failed")
+  endif()
+
+  if(NOT SEACAS_EXODIFF)
+    message(FATAL_ERROR "Cannot find exodiff")
+  endif()
+
+  EXECUTE_PROCESS(COMMAND ${SEACAS_EXODIFF} -file ${EXODIFF_COMMANDS} ${OUTPUT} ${BASELINE}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Test failed: ${OUTPUT} differs from ${BASELINE}")
+  endif()
+endif()
@@ -0,0 +1,47 @@
+# Run Albany, and check that its output matches regular expressions.
+#
+# PATTERNS is a list of regular expressions separated by '|', all of which
+# must match the output, e.g.
+#
+#   "-DPATTERNS=>>> Albany Memory Tracker|Preconditioner +[0-9.]+"
+#
+# With FILE, the file written by Albany must also match FILE_PATTERNS.
+
+# 1. Run the program
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                OUTPUT_VARIABLE ALBANY_OUTPUT
+                RESULT_VARIABLE HAD_ERROR)
+
+file(WRITE ${TEST_NAME}.out "${ALBANY_OUTPUT}")
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Albany didn't run: test failed")
+endif()
+
+# 2. Check the output
+
+string(REPLACE "|" ";" PATTERNS "${PATTERNS}")
+foreach(PATTERN ${PATTERNS})
+  if(NOT ALBANY_OUTPUT MATCHES "${PATTERN}")
+    message(FATAL_ERROR "Test failed: no match for ${PATTERN} in the output of Albany")
+  endif()
+endforeach()
+
+# 3. Check the file
+
+if(FILE)
+  if(NOT EXISTS ${FILE})
+    message(FATAL_ERROR "Test failed: Albany didn't write ${FILE}")
+  endif()
+  file(READ ${FILE} FILE_CONTENTS)
+  string(REPLACE "|" ";" FILE_PATTERNS "${FILE_PATTERNS}")
+  foreach(PATTERN ${FILE_PATTERNS})
+    if(NOT FILE_CONTENTS MATCHES "${PATTERN}")
+      message(FATAL_ERROR "Test failed: no match for ${PATTERN} in ${FILE}")
+    endif()
+  endforeach()
+endif()
@@ -0,0 +1,81 @@
+#! /usr/bin/env python3
+
+# Write a version 4.1 ascii gmsh mesh as a version 2.2 mesh, ascii or binary.
+#
+#   msh41_to_msh22.py box.msh box_v22.msh
+#   msh41_to_msh22.py --binary box.msh box_v22_binary.msh
+#
+# The elements keep the tag of their entity, as both their physical and
+# elementary tags, so the boundaries of the 2.2 mesh have the names of the
+# surfaces of the 4.1 mesh (BoundaryNodeSet1, BoundarySideSet2, ...).
+
+import struct
+import sys
+
+
+def read_section(lines, marker):
+    start = lines.index(marker) + 1
+    return lines[start:lines.index("$End" + marker[1:], start)]
+
+
+def read_msh41(name):
+    with open(name) as f:
+        lines = [line.strip() for line in f]
+
+    nodes = {}
+    section = read_section(lines, "$Nodes")
+    num_blocks = int(section[0].split()[0])
+    k = 1
+    for _ in range(num_blocks):
+        n = int(section[k].split()[3])
+        tags = [int(t) for t in section[k + 1:k + 1 + n]]
+        for i, tag in enumerate(tags):
+            nodes[tag] = [float(x) for x in section[k + 1 + n + i].split()]
+        k += 1 + 2 * n
+
+    blocks = []
+    section = read_section(lines, "$Elements")
+    num_blocks = int(section[0].split()[0])
+    k = 1
+    for _ in range(num_blocks):
+        _, tag, type, n = [int(v) for v in section[k].split()]
+        elements = [[int(v) for v in line.split()] for line in section[k + 1:k + 1 + n]]
+        blocks.append((tag, type, elements))
+        k += 1 + n
+    return nodes, blocks
+
+
+def write_msh22(name, nodes, blocks, binary):
+    num_elements = sum(len(elements) for _, _, elements in blocks)
+    with open(name, "wb") as f:
+        f.write(b"$MeshFormat\n2.2 %d 8\n" % binary)
+        if binary:
+            f.write(struct.pack("<i", 1) + b"\n")
+        f.write(b"$EndMeshFormat\n$Nodes\n%d\n" % len(nodes))
+        for tag in sorted(nodes):
+            if binary:
+                f.write(struct.pack("<i3d", tag, *nodes[tag]))
+            else:
+                f.write(("%d %r %r %r\n" % (tag, *nodes[tag])).encode())
+        if binary:
+            f.write(b"\n")
+        f.write(b"$EndNodes\n$Elements\n%d\n" % num_elements)
+        for tag, type, elements in blocks:
+            if binary:
+                f.write(struct.pack("<3i", type, len(elements), 2))
+            for element in elements:
+                record = [element[0], tag, tag] + element[1:]
+                if binary:
+                    f.write(struct.pack("<%di" % len(record), *record))
+                else:
+                    f.write(("%d %d 2 %s\n" % (element[0], type, " ".join(str(v) for v in record[1:]))).encode())
+        if binary:
+            f.write(b"\n")
+        f.write(b"$EndElements\n")
+
+
+if __name__ == "__main__":
+    binary = "--binary" in sys.argv
+    args = [a for a in sys.argv[1:] if a != "--binary"]
+    nodes, blocks = read_msh41(args[0])
+    write_msh22(args[1], nodes, blocks, binary)
@@ -0,0 +1,37 @@
+#! /usr/bin/env python3
+
+# Write an ascii field file of a mesh whose entity GIDs go from 0 to n - 1,
+# scalar or vector but not layered, as a binary field file.
+#
+#   ascii_to_binary_field.py dummy_field.ascii dummy_field.bin
+#
+# The entities of the ascii file are in GID order, so the binary file lists
+# the GIDs 0, 1, ..., n - 1. See src/disc/Albany_BinaryFieldFile.hpp for the
+# format; the values are written little endian, the native order of the
+# machines that run the tests.
+
+import struct
+import sys
+
+
+def read_ascii(name):
+    with open(name) as f:
+        lines = [line.split() for line in f if line.strip()]
+    header = [int(v) for v in lines[0]]
+    num_entities = header[0]
+    num_columns = header[1] if len(header) > 1 else 1
+    values = [float(v) for line in lines[1:] for v in line]
+    assert len(values) == num_entities * num_columns
+    return num_entities, num_columns, values
+
+
+def write_binary(name, num_entities, num_columns, values):
+    with open(name, "wb") as f:
+        f.write(b"ALBFIELD")
+        f.write(struct.pack("<3q", num_entities, num_columns, 0))
+        f.write(struct.pack("<%dq" % num_entities, *range(num_entities)))
+        f.write(struct.pack("<%dd" % len(values), *values))
+
+
+if __name__ == "__main__":
+    write_binary(sys.argv[2], *read_ascii(sys.argv[1]))
@@ -0,0 +1,34 @@
+# Load the same fields from ascii and binary field files, and compare the
+# meshes written. Both runs use the same decomposition, so the files of each
+# process are compared with each other.
+
+foreach(FORMAT ascii bin)
+  execute_process(COMMAND ${TEST_PROG} input_field_file_${FORMAT}.yaml
+                  RESULT_VARIABLE HAD_ERROR)
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run with the ${FORMAT} field files: test failed")
+  endif()
+endforeach()
+
+if(NOT SEACAS_EXODIFF)
+  message(FATAL_ERROR "Cannot find exodiff")
+endif()
+
+set(ASCII_FILES populated_mesh_ascii.exo)
+if(DEFINED MPIMNP AND ${MPIMNP} GREATER 1)
+  set(ASCII_FILES "")
+  math(EXPR LAST_RANK "${MPIMNP} - 1")
+  foreach(RANK RANGE ${LAST_RANK})
+    list(APPEND ASCII_FILES populated_mesh_ascii.exo.${MPIMNP}.${RANK})
+  endforeach()
+endif()
+
+foreach(ASCII_FILE IN LISTS ASCII_FILES)
+  string(REPLACE "_ascii" "_bin" BINARY_FILE ${ASCII_FILE})
+  execute_process(
+    COMMAND ${SEACAS_EXODIFF} -file exodiff_commands ${ASCII_FILE} ${BINARY_FILE}
+    RESULT_VARIABLE HAD_ERROR)
+  if(HAD_ERROR)
+    message(FATAL_ERROR "The fields of ${ASCII_FILE} and ${BINARY_FILE} differ: test failed")
+  endif()
+endforeach()